@@ -13,9 +13,14 @@
 // Headers
 #include <iostream>
 
+#include <boost/algorithm/string/replace.hpp>
+
 #include "../../AgeLengths/Manager.h"
+#include "../../DerivedQuantities/DerivedQuantity.h"
+#include "../../DerivedQuantities/Manager.h"
 #include "../../ObjectiveFunction/ObjectiveFunction.h"
 #include "../../Estimates/Manager.h"
+#include "../../Model/Managers.h"
 #include "../../Model/Models/Age.h"
 #include "../../TestResources/TestFixtures/InternalEmptyModel.h"
 #include "../../TestResources/Models/TwoSexHalfAges.h"
@@ -314,6 +319,53 @@ TEST_F(InternalEmptyModel, AgeLengths_Data_Mean_Mean) {
   EXPECT_DOUBLE_EQ(11875.652543263464, obj_function.score());
 }
 
+/**
+ * The initialisation uses the mean of the years and the first year uses the
+ * nearest year with data, so the mean weights used for the derived quantity
+ * must change between them
+ */
+TEST_F(InternalEmptyModel, AgeLengths_Data_NearestNeighbour_Mean_Derived_Quantity) {
+  string configuration = age_length_data_external_mean_internal_mean;
+  boost::replace_first(configuration, "external_gaps mean", "external_gaps nearest_neighbour");
+  // the data runs to the final year so only the years before 1977 are filled
+  boost::replace_first(configuration, "\n2000 35.31", "\n2002 35.31");
+  AddConfigurationLine(configuration, __FILE__, 33);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  DerivedQuantity* dq = model_->managers()->derived_quantity()->GetDerivedQuantity("ssb");
+  ASSERT_NE(nullptr, dq);
+  EXPECT_DOUBLE_EQ(3629864.6854353133, dq->GetLastValueFromInitialisation(0));
+  EXPECT_DOUBLE_EQ(2585210.5506066042, dq->GetValue(1975));
+  EXPECT_DOUBLE_EQ(4904618.9796355339, dq->GetValue(2002));
+}
+
+/**
+ * Length based selectivities must use the initialisation mean lengths
+ * in the initialisation and the first year's mean lengths after it
+ */
+TEST_F(InternalEmptyModel, AgeLengths_Data_NearestNeighbour_Mean_Length_Based_Selectivities) {
+  string configuration = age_length_data_external_mean_internal_mean;
+  boost::replace_first(configuration, "external_gaps mean", "external_gaps nearest_neighbour");
+  // the data runs to the final year so only the years before 1977 are filled
+  boost::replace_first(configuration, "\n2000 35.31", "\n2002 35.31");
+  boost::replace_all(configuration, "a50 5\nato95 2", "length_based true\na50 35\nato95 10");
+  boost::replace_all(configuration, "a50 9\nato95 4", "length_based true\na50 28\nato95 10");
+  AddConfigurationLine(configuration, __FILE__, 33);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  ObjectiveFunction& obj_function = model_->objective_function();
+  EXPECT_DOUBLE_EQ(13097.683359226237, obj_function.score());
+
+  DerivedQuantity* dq = model_->managers()->derived_quantity()->GetDerivedQuantity("ssb");
+  ASSERT_NE(nullptr, dq);
+  EXPECT_DOUBLE_EQ(4457223.8519888734, dq->GetLastValueFromInitialisation(0));
+  EXPECT_DOUBLE_EQ(2344814.1949396227, dq->GetValue(1975));
+}
+
 } /* namespace estimates */
 } /* namespace niwa */
 #endif
@@ -14,6 +14,7 @@
 
 #include "../../LengthWeights/Manager.h"
 #include "../../Model/Managers.h"
+#include "../../Model/SharedData.h"
 #include "../../TimeSteps/Manager.h"
 #include "../../Utilities/To.h"
 
@@ -57,8 +58,10 @@ void Data::DoBuild() {
 
   LOG_FINE() << "Building age length block " << label_;
   length_weight_ = model_->managers()->length_weight()->GetLengthWeight(length_weight_label_);
-  if (!length_weight_)
+  if (!length_weight_) {
     LOG_ERROR_P(PARAM_LENGTH_WEIGHT) << "(" << length_weight_label_ << ") could not be found. Have you defined it?";
+  } else
+    length_weight_->SubscribeToRebuildCache(this);
   if (!data_table_)
     LOG_CODE_ERROR() << "!data_table_";
   if (model_->run_mode() == RunMode::kProjection)
@@ -103,11 +106,17 @@ void Data::DoBuild() {
   if (columns[0] != PARAM_YEAR)
     LOG_ERROR_P(PARAM_DATA) << "first column label must be 'year'. First column label was '" << columns[0] << "'";
 
+  // If the model on another thread has built the mean lengths we use them
+  string key = "age_length." + label_ + ".mean_lengths";
+  mean_lengths_ = model_->shared_data()->Find<MeanLengths>(key);
+  if (mean_lengths_)
+    return;
+
   /**
    * Build our data_by_year map so we can fill the gaps
    * and use it in the model
    */
-  vector<vector<string>>& data = data_table_->data();
+  const vector<vector<string>>& data = data_table_->data();
   vector<Double> total_length(model_->age_spread(), 0.0);
   Double number_of_years = 0.0;
 
@@ -159,7 +168,12 @@ void Data::DoBuild() {
   // Do our timestep interpolation
   InterpolateTimeStepsForAllYears();
 
-
+  // Share the mean lengths, we don't need the rest of the data now they're built
+  MeanLengths mean_lengths;
+  mean_lengths.by_time_step_age_.swap(data_by_age_time_step_);
+  mean_lengths.by_year_age_time_step_.swap(mean_length_by_year_);
+  mean_lengths_ = model_->shared_data()->Share(key, std::move(mean_lengths));
+  data_by_year_.clear();
 }
 
 /**
@@ -419,9 +433,9 @@ void Data::FillInternalGaps() {
  */
 Double Data::mean_length(unsigned time_step, unsigned age) {
   if (model_->state() == State::kInitialise)
-    return data_by_age_time_step_[time_step][age];
+    return InitialisationMeanLength(time_step, age);
   unsigned year = model_->current_year();
-  return mean_length_by_year_[year][age][time_step];
+  return YearMeanLength(year, time_step, age);
 }
 
 /**
@@ -434,7 +448,7 @@ Double Data::mean_length(unsigned time_step, unsigned age) {
 Double Data::mean_weight(unsigned time_step, unsigned age) {
   unsigned year = model_->current_year();
   Double size   = this->mean_length(time_step, age);
-  return length_weight_->mean_weight(size, distribution_, cvs_[year][time_step][age]);
+  return length_weight_->mean_weight(size, distribution_, cv(year, time_step, age));
 }
 
 /**
@@ -447,10 +461,45 @@ Double Data::mean_weight(unsigned time_step, unsigned age) {
  */
 Double Data::GetMeanLength(unsigned year, unsigned time_step, unsigned age) {
   if (model_->state() == State::kInitialise)
-    return data_by_age_time_step_[time_step][age];
+    return InitialisationMeanLength(time_step, age);
 
-  return mean_length_by_year_[year][age][time_step];
+  return YearMeanLength(year, time_step, age);
+}
 
+/**
+ * Return the mean length used in the initialisation for a time_step and age.
+ * Mean lengths that were not built are 0.0
+ *
+ * @param time_step time_step
+ * @param age The age of the population we want the mean length for
+ * @return mean length
+ */
+Double Data::InitialisationMeanLength(unsigned time_step, unsigned age) const {
+  auto time_step_iter = mean_lengths_->by_time_step_age_.find(time_step);
+  if (time_step_iter == mean_lengths_->by_time_step_age_.end())
+    return 0.0;
+  auto age_iter = time_step_iter->second.find(age);
+  return age_iter == time_step_iter->second.end() ? 0.0 : age_iter->second;
+}
+
+/**
+ * Return the mean length for a year, time_step and age.
+ * Mean lengths that were not built are 0.0
+ *
+ * @param year The year we want the mean length for
+ * @param time_step time_step
+ * @param age The age of the population we want the mean length for
+ * @return mean length
+ */
+Double Data::YearMeanLength(unsigned year, unsigned time_step, unsigned age) const {
+  auto year_iter = mean_lengths_->by_year_age_time_step_.find(year);
+  if (year_iter == mean_lengths_->by_year_age_time_step_.end())
+    return 0.0;
+  auto age_iter = year_iter->second.find(age);
+  if (age_iter == year_iter->second.end())
+    return 0.0;
+  auto time_step_iter = age_iter->second.find(time_step);
+  return time_step_iter == age_iter->second.end() ? 0.0 : time_step_iter->second;
 }
 
 } /* namespace agelengths */
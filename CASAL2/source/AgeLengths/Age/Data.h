@@ -47,6 +47,17 @@ private:
   void                        FillInternalGaps();
   void                        InterpolateTimeStepsForInitialConditions();
   void                        InterpolateTimeStepsForAllYears();
+  Double                      InitialisationMeanLength(unsigned time_step, unsigned age) const;
+  Double                      YearMeanLength(unsigned year, unsigned time_step, unsigned age) const;
+
+  /**
+   * The mean lengths never change once they have been built so they
+   * are shared with the models on the other threads
+   */
+  struct MeanLengths {
+    map<unsigned, map<unsigned, Double>> by_time_step_age_; // used in the initialisation
+    map<unsigned, map<unsigned, map<unsigned, Double>>> by_year_age_time_step_;
+  };
 
   // members
   parameters::Table*            data_table_ = nullptr;
@@ -61,10 +72,11 @@ private:
   unsigned                      ageing_index_ = 0;
   vector<Double>                means_;
   string                        length_weight_label_;
-  const LengthWeight*           length_weight_ = nullptr;
+  LengthWeight*                 length_weight_ = nullptr;
   vector<unsigned>              steps_to_figure_;
   unsigned                      number_time_steps_;
   unsigned                      final_year_;
+  shared_ptr<const MeanLengths> mean_lengths_;
 };
 
 } /* namespace agelengths */
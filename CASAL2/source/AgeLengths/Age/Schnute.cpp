@@ -58,8 +58,10 @@ Schnute::Schnute(shared_ptr<Model> model) : AgeLength(model) {
  */
 void Schnute::DoBuild() {
   length_weight_ = model_->managers()->length_weight()->GetLengthWeight(length_weight_label_);
-  if (!length_weight_)
+  if (!length_weight_) {
     LOG_ERROR_P(PARAM_LENGTH_WEIGHT) << "(" << length_weight_label_ << ") could not be found. Have you defined it?";
+  } else
+    length_weight_->SubscribeToRebuildCache(this);
 
   // Build up our mean_length_ container.
   unsigned min_age = model_->min_age();
@@ -112,7 +114,7 @@ Double Schnute::mean_weight(unsigned time_step, unsigned age) {
   unsigned year = model_->current_year();
   Double size = mean_length_[time_step][age];
   //LOG_FINE() << "year = " << year << " age " << age << " time step " << time_step << " cv = " <<  cvs_[year][age][time_step];
-  Double mean_weight = length_weight_->mean_weight(size, distribution_, cvs_[year][time_step][age]);
+  Double mean_weight = length_weight_->mean_weight(size, distribution_, cv(year, time_step, age));
   return mean_weight;
 }
 
@@ -55,8 +55,10 @@ VonBertalanffy::VonBertalanffy(shared_ptr<Model> model) : AgeLength(model) {
  */
 void VonBertalanffy::DoBuild() {
   length_weight_ = model_->managers()->length_weight()->GetLengthWeight(length_weight_label_);
-  if (!length_weight_)
+  if (!length_weight_) {
     LOG_ERROR_P(PARAM_LENGTH_WEIGHT) << "(" << length_weight_label_ << ") could not be found. Have you defined it?";
+  } else
+    length_weight_->SubscribeToRebuildCache(this);
 
   // Build up our mean_length_ container.
   DoRebuildCache();
@@ -92,7 +94,7 @@ Double VonBertalanffy::mean_weight(unsigned time_step, unsigned age) {
   unsigned year = model_->current_year();
   Double size = mean_length_[time_step][age];
   Double mean_weight = 0.0; //
-  mean_weight = length_weight_->mean_weight(size, distribution_, cvs_[year][time_step][age]);// make a map [key = age]
+  mean_weight = length_weight_->mean_weight(size, distribution_, cv(year, time_step, age));// make a map [key = age]
   return mean_weight;
 }
 
@@ -15,6 +15,7 @@
 // headers
 #include "AgeLength.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "../Model/Managers.h"
@@ -96,48 +97,116 @@ void AgeLength::Build() {
 
 /**
  * BuildCV function
- * populates a 3d map of cv's by year, age and time_step
+ * populates a flat [year][time_step][age] table of cv's
+ *
+ * The table is only rebuilt when the values it is built from (cv_first, cv_last
+ * and the mean lengths when interpolating by length) or its shape have changed
+ * since the last time it was built.
  */
 void AgeLength::BuildCV() {
   unsigned min_age = model_->min_age();
   unsigned max_age = model_->max_age();
+  vector<unsigned> years = model_->years();
+  unsigned time_step_count = model_->time_steps().size();
+  unsigned age_count = (max_age - min_age) + 1;
+  bool cv_last_defined = parameters_.Get(PARAM_CV_LAST)->has_been_defined(); // TODO: Fix this #this test is robust but not compatible with testing framework, blah
+
+  vector<Double> inputs = { cv_first_, cv_last_ };
+  if (cv_last_defined && by_length_) {
+    for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter) {
+      for (unsigned age = min_age; age <= max_age; ++age)
+        inputs.push_back(this->mean_length(step_iter, age));
+    }
+  }
 
-  vector<unsigned> years(model_->years().size() + 1,0);
-  unsigned year_ndx = 1;
-  for (unsigned year : model_->years()) {
-    years[year_ndx] = year;
-    ++year_ndx;
+  unsigned first_year = years.size() == 0 ? 0 : years[0];
+#ifndef USE_AUTODIFF
+  if (cv_first_year_ == first_year && cv_year_count_ == years.size() && cv_time_step_count_ == time_step_count
+      && cv_min_age_ == min_age && cv_age_count_ == age_count && cv_inputs_ == inputs) {
+    LOG_FINEST() << "cv lookup table for " << label_ << " has not changed";
+    return;
   }
-  vector<string> time_steps = model_->time_steps();
-
-  for (unsigned year : years) {
-    for (unsigned step_iter = 0; step_iter < time_steps.size(); ++step_iter) {
-      if (!parameters_.Get(PARAM_CV_LAST)->has_been_defined()) { // TODO: Fix this #this test is robust but not compatible with testing framework, blah
-        //If cv_last_ is not defined in the input then assume cv_first_ represents the cv for all age classes i.e constant cv
-        for (unsigned age = min_age; age <= max_age; ++age)
-          cvs_[year][step_iter][age] = (cv_first_);
-
-      } else if (by_length_) {  // if passed the first test we have a min and max CV. So ask if this is linear interpolated by length at age
-        for (unsigned age = min_age; age <= max_age; ++age) {
-          cvs_[year][step_iter][age] = ((this->mean_length(step_iter, age) - this->mean_length(step_iter, min_age)) * (cv_last_ - cv_first_)
-              / (this->mean_length(step_iter, max_age) - this->mean_length(step_iter, min_age)) + cv_first_);
-        }
-      } else {
-        // else Do linear interpolation between cv_first_ and cv_last_ based on age class
-        for (unsigned age = min_age; age <= max_age; ++age)
-          cvs_[year][step_iter][age] = (cv_first_ + (cv_last_ - cv_first_) * (age - min_age) / (max_age - min_age));
-
-      } // if (!parameters_.Get(PARAM_CV_LAST)->has_been_defined()) {
-    } // for (unsigned step_iter = 0; step_iter < time_steps.size(); ++step_iter)
-  } // for (unsigned year : years) {
+#endif
+
+  cv_first_year_      = first_year;
+  cv_year_count_      = years.size();
+  cv_time_step_count_ = time_step_count;
+  cv_min_age_         = min_age;
+  cv_age_count_       = age_count;
+  cv_inputs_          = inputs;
+  cvs_.resize(cv_year_count_ * cv_time_step_count_ * cv_age_count_);
+  if (cvs_.size() == 0)
+    return;
+
+  // The cv's are the same in every year so we build the first year and copy it
+  for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter) {
+    Double* step_cvs = &cvs_[step_iter * age_count];
+    if (!cv_last_defined) {
+      //If cv_last_ is not defined in the input then assume cv_first_ represents the cv for all age classes i.e constant cv
+      for (unsigned age = min_age; age <= max_age; ++age)
+        step_cvs[age - min_age] = (cv_first_);
+
+    } else if (by_length_) {  // if passed the first test we have a min and max CV. So ask if this is linear interpolated by length at age
+      for (unsigned age = min_age; age <= max_age; ++age) {
+        step_cvs[age - min_age] = ((this->mean_length(step_iter, age) - this->mean_length(step_iter, min_age)) * (cv_last_ - cv_first_)
+            / (this->mean_length(step_iter, max_age) - this->mean_length(step_iter, min_age)) + cv_first_);
+      }
+    } else {
+      // else Do linear interpolation between cv_first_ and cv_last_ based on age class
+      for (unsigned age = min_age; age <= max_age; ++age)
+        step_cvs[age - min_age] = (cv_first_ + (cv_last_ - cv_first_) * (age - min_age) / (max_age - min_age));
+
+    } // if (!cv_last_defined) {
+  } // for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter)
+
+  unsigned year_size = time_step_count * age_count;
+  for (unsigned year_index = 1; year_index < cv_year_count_; ++year_index)
+    std::copy(cvs_.begin(), cvs_.begin() + year_size, cvs_.begin() + year_index * year_size);
+}
+
+/**
+ * Return the cv for a year, time step and age. Anything outside
+ * of the years and ages the model covers has a cv of 0.0
+ *
+ * @param year The year
+ * @param time_step The time step index
+ * @param age The age (not the index)
+ * @return The cv
+ */
+Double AgeLength::cv(unsigned year, unsigned time_step, unsigned age) {
+  if (year < cv_first_year_ || age < cv_min_age_ || time_step >= cv_time_step_count_)
+    return 0.0;
+  unsigned year_index = year - cv_first_year_;
+  unsigned age_index  = age - cv_min_age_;
+  if (year_index >= cv_year_count_ || age_index >= cv_age_count_)
+    return 0.0;
+  return cvs_[(year_index * cv_time_step_count_ + time_step) * cv_age_count_ + age_index];
 }
 
 /**
  * Reset the age length class.
+ *
+ * The revision is only incremented when one of our parameters has changed since
+ * the last reset (e.g. new estimates or -i values), so the mean weights, the
+ * length based selectivities and the partition's mean lengths and age length
+ * proportions calculated from us are kept between model runs when they would
+ * be the same. When a parameter has changed our mean lengths and cv's are rebuilt.
  */
 void AgeLength::Reset() {
-  if (is_estimated_) {
-    LOG_FINEST() << "We are re-building cv lookup table.";
+  vector<Double> inputs;
+  for (auto addressable : addressables_)
+    inputs.push_back(*addressable.second);
+#ifdef USE_AUTODIFF
+  bool changed = true;
+#else
+  bool changed = inputs != reset_inputs_;
+#endif
+  reset_inputs_ = inputs;
+
+  if (changed) {
+    ++revision_;
+    LOG_FINEST() << "We are re-building the mean length cache and cv lookup table.";
+    DoRebuildCache();
     BuildCV();
   }
   DoReset();
@@ -147,6 +216,7 @@ void AgeLength::Reset() {
  * ReBuild Cache: called by the time_varying class.
  */
 void AgeLength::RebuildCache() {
+  ++revision_;
   BuildCV();
   DoRebuildCache();
 }
@@ -41,11 +41,13 @@ public:
 
   // accessors
   virtual Double              GetMeanLength(unsigned year, unsigned time_step, unsigned age) = 0;
-  virtual Double              cv(unsigned year, unsigned time_step, unsigned age) { return cvs_[year][time_step][age]; };
+  virtual Double              cv(unsigned year, unsigned time_step, unsigned age);
   virtual string              distribution_label() { return distribution_label_; };
   Distribution                distribution() const { return distribution_; }
   bool                        casal_normal_cdf() const { return casal_normal_cdf_; }
   bool                        varies_by_years() const { return varies_by_year_; }
+  bool                        has_cv(unsigned year) const { return year >= cv_first_year_ && year - cv_first_year_ < cv_year_count_; }
+  unsigned                    revision() const { return revision_; }
 
   // Methods
   virtual Double              mean_weight(unsigned time_step, unsigned age) = 0;
@@ -71,8 +73,16 @@ protected:
   Distribution                distribution_;
   bool                        casal_normal_cdf_ = false;
   bool                        varies_by_year_ = false;
+  unsigned                    revision_ = 0; // incremented every time the values we return may have changed
 
-  map<unsigned, map<unsigned, map<unsigned, Double>>>       cvs_;  //cvs[year][time_step][age]
+  vector<Double>              cvs_; // cvs_[year][time_step][age] stored flat, see cv()
+  unsigned                    cv_first_year_ = 0;
+  unsigned                    cv_year_count_ = 0;
+  unsigned                    cv_time_step_count_ = 0;
+  unsigned                    cv_min_age_ = 0;
+  unsigned                    cv_age_count_ = 0;
+  vector<Double>              cv_inputs_; // values the cvs_ were last built from
+  vector<Double>              reset_inputs_; // values of our addressables at the last reset
 };
 
 } /* namespace niwa */
@@ -94,7 +94,7 @@ void Data::DoBuild() {
     age_.push_back(utilities::ToInline<string, unsigned>(columns[i]));
   }
 
-  vector<vector<string>>& data = data_table_->data();
+  const vector<vector<string>>& data = data_table_->data();
   vector<Double> total_weight(model_->age_spread(), 0.0);
   Double number_of_years = 0.0;
   for (vector<string> row : data) {
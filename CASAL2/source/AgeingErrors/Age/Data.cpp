@@ -31,6 +31,8 @@ namespace ageingerrors {
 Data::Data(shared_ptr<Model> model) : AgeingError(model) {
   data_table_ = new parameters::Table(PARAM_TABLE);
   parameters_.BindTable(PARAM_TABLE, data_table_, "Table of data specifying the ageing misclassification matrix", "", false);
+
+  share_mis_matrix_ = true;
 }
 
 /**
@@ -44,7 +46,7 @@ Data::~Data() {
  *
  */
 void Data::DoBuild() {
-  auto data = data_table_->data();
+  const auto& data = data_table_->data();
   if (data.size() != age_spread_) {
     LOG_ERROR_P(PARAM_TABLE) << "number of rows provided " << data.size() << " does not match the age spread for the model " << age_spread_;
     return;
@@ -29,7 +29,7 @@ namespace ageingerrors {
  * Note: The constructor is parsed to generate Latex for the documentation.
  */
 None::None(shared_ptr<Model> model) : AgeingError(model) {
-
+  share_mis_matrix_ = true;
 }
 
 /**
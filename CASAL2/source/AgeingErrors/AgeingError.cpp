@@ -13,6 +13,7 @@
 #include "AgeingError.h"
 
 #include "../Model/Model.h"
+#include "../Model/SharedData.h"
 
 // Namespaces
 namespace niwa {
@@ -51,13 +52,28 @@ void AgeingError::Validate() {
 
 /**
  * Build an Empty misclassification matrix that will be populated by a child method
+ *
+ * If the matrix never changes once it has been built then it is shared with
+ * the models on the other threads, so it is only built by the first model.
  */
 void AgeingError::Build() {
+  string key = "ageing_error." + label_ + ".mis_matrix";
+  if (share_mis_matrix_) {
+    shared_mis_matrix_ = model_->shared_data()->Find<vector<vector<Double>>>(key);
+    if (shared_mis_matrix_)
+      return;
+  }
+
   mis_matrix_.resize(age_spread_);
   for (unsigned i = 0; i < age_spread_; ++i)
     mis_matrix_[i].resize(age_spread_, 0);
 
   DoBuild();
+
+  if (share_mis_matrix_) {
+    shared_mis_matrix_ = model_->shared_data()->Share(key, std::move(mis_matrix_));
+    mis_matrix_.clear();
+  }
 }
 
 } /* namespace niwa */
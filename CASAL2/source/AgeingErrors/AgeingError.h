@@ -45,7 +45,7 @@ public:
   unsigned                    min_age() const { return min_age_; }
   unsigned                    max_age() const { return max_age_; }
   bool                        plus_group() const { return plus_group_; }
-  vector<vector<Double> >&    mis_matrix() { return mis_matrix_; }
+  const vector<vector<Double> >& mis_matrix() const { return shared_mis_matrix_ ? *shared_mis_matrix_ : mis_matrix_; }
 
 protected:
   // Methods
@@ -60,6 +60,8 @@ protected:
   bool                        plus_group_ = false;
   unsigned                    age_spread_ = 0;
   vector<vector<Double> >     mis_matrix_;
+  bool                        share_mis_matrix_ = false; // true if the matrix never changes once built
+  shared_ptr<const vector<vector<Double> > > shared_mis_matrix_;
 };
 
 } /* namespace niwa */
@@ -107,7 +107,7 @@ void Nuisance::DoBuild() {
  *
  * @return this function will solve for q given the comparison structure.
  */
-void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comparisons, string_view likelihood) {
+void Nuisance::CalculateQ(map<unsigned, observations::ComparisonColumns>& comparisons, string_view likelihood) {
   LOG_TRACE();
   LOG_FINEST() << "Converting nuisance q with prior = " << prior_type_ << " and likelihood = " << likelihood;
   if (likelihood != PARAM_NORMAL && likelihood != PARAM_LOGNORMAL) {
@@ -123,14 +123,15 @@ void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comp
     // iterate over each year
     for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
       // Iterate over each category
-      for (observations::Comparison& comparison : year_iterator->second) {
+      observations::ComparisonColumns& columns = year_iterator->second;
+      for (unsigned i = 0; i < columns.size(); ++i) {
 
-        Double cv = comparison.error_value_;
-        if (comparison.error_value_ > 0.0 && comparison.process_error_ > 0.0)
-          cv =  sqrt(comparison.error_value_ * comparison.error_value_ + comparison.process_error_ * comparison.process_error_);
+        Double cv = columns.error_value_[i];
+        if (columns.error_value_[i] > 0.0 && columns.process_error_[i] > 0.0)
+          cv =  sqrt(columns.error_value_[i] * columns.error_value_[i] + columns.process_error_[i] * columns.process_error_[i]);
 
-        s1 += comparison.observed_ / (cv * cv * comparison.expected_);
-        s2 += pow(comparison.observed_ / (cv * comparison.expected_), 2);
+        s1 += columns.observed_[i] / (cv * cv * columns.expected_[i]);
+        s2 += pow(columns.observed_[i] / (cv * columns.expected_[i]), 2);
         n++;
       }
     }
@@ -142,18 +143,19 @@ void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comp
   double n = 0;
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
     // Iterate over each category
-    for (observations::Comparison& comparison : year_iterator->second) {
-      if (comparison.expected_ <= math::ZERO)
+    observations::ComparisonColumns& columns = year_iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      if (columns.expected_[i] <= math::ZERO)
         LOG_WARNING() << "Expected less than " << math::ZERO << " you may want to check this.";
-      comparison.expected_ = math::ZeroFun(comparison.expected_, math::ZERO);
+      columns.expected_[i] = math::ZeroFun(columns.expected_[i], math::ZERO);
         n++;
-        Double cv = comparison.error_value_;
-        if (comparison.error_value_ > 0.0 && comparison.process_error_ > 0.0)
-          cv =  sqrt(comparison.error_value_ * comparison.error_value_ + comparison.process_error_ * comparison.process_error_);
+        Double cv = columns.error_value_[i];
+        if (columns.error_value_[i] > 0.0 && columns.process_error_[i] > 0.0)
+          cv =  sqrt(columns.error_value_[i] * columns.error_value_[i] + columns.process_error_[i] * columns.process_error_[i]);
 
         Double sigma = sqrt(log(1 + cv * cv));
 
-        s3 += log(comparison.observed_ / comparison.expected_)/ (sigma * sigma);
+        s3 += log(columns.observed_[i] / columns.expected_[i])/ (sigma * sigma);
         s4 += 1 / (sigma * sigma);
       }
     }
@@ -165,15 +167,16 @@ void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comp
     double n = 0;
     for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
       // Iterate over each category
-      for (observations::Comparison& comparison : year_iterator->second) {
-        comparison.expected_ = math::ZeroFun(comparison.expected_, math::ZERO);
+      observations::ComparisonColumns& columns = year_iterator->second;
+      for (unsigned i = 0; i < columns.size(); ++i) {
+        columns.expected_[i] = math::ZeroFun(columns.expected_[i], math::ZERO);
           n++;
-          Double cv = comparison.error_value_;
-          if (comparison.error_value_ > 0.0 && comparison.process_error_ > 0.0)
-            cv =  sqrt(comparison.error_value_ * comparison.error_value_ + comparison.process_error_ * comparison.process_error_);
+          Double cv = columns.error_value_[i];
+          if (columns.error_value_[i] > 0.0 && columns.process_error_[i] > 0.0)
+            cv =  sqrt(columns.error_value_[i] * columns.error_value_[i] + columns.process_error_[i] * columns.process_error_[i]);
 
-          s1 += comparison.observed_ / (cv * cv * comparison.expected_);
-          s2 += pow(comparison.observed_ / (cv * comparison.expected_), 2);
+          s1 += columns.observed_[i] / (cv * cv * columns.expected_[i]);
+          s2 += pow(columns.observed_[i] / (cv * columns.expected_[i]), 2);
         }
       }
       LOG_FINEST() << "S1 = " << s1 << " S2 = " << s2;
@@ -184,18 +187,19 @@ void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comp
     double n = 0;
     for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
       // Iterate over each category
-      for (observations::Comparison& comparison : year_iterator->second) {
-        comparison.expected_ = math::ZeroFun(comparison.expected_, math::ZERO);
+      observations::ComparisonColumns& columns = year_iterator->second;
+      for (unsigned i = 0; i < columns.size(); ++i) {
+        columns.expected_[i] = math::ZeroFun(columns.expected_[i], math::ZERO);
           n++;
-          Double cv = comparison.error_value_;
-          if (comparison.error_value_ > 0.0 && comparison.process_error_ > 0.0)
-            cv =  sqrt(comparison.error_value_ * comparison.error_value_ + comparison.process_error_ * comparison.process_error_);
+          Double cv = columns.error_value_[i];
+          if (columns.error_value_[i] > 0.0 && columns.process_error_[i] > 0.0)
+            cv =  sqrt(columns.error_value_[i] * columns.error_value_[i] + columns.process_error_[i] * columns.process_error_[i]);
 
 
           Double sigma = sqrt(log(1 + cv * cv));
           LOG_FINEST() << "Sigma = " << sigma;
-          LOG_FINEST() << "E = " << comparison.expected_;
-          s3 += log(comparison.observed_ /  comparison.expected_) / (sigma * sigma);
+          LOG_FINEST() << "E = " << columns.expected_[i];
+          s3 += log(columns.observed_[i] /  columns.expected_[i]) / (sigma * sigma);
           s4 += 1 / (sigma * sigma);
         }
       }
@@ -207,17 +211,18 @@ void Nuisance::CalculateQ(map<unsigned, vector<observations::Comparison> >& comp
       double n = 0;
       for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
         // Iterate over each category
-        for (observations::Comparison& comparison : year_iterator->second) {
-          comparison.expected_ = math::ZeroFun(comparison.expected_, math::ZERO);
+        observations::ComparisonColumns& columns = year_iterator->second;
+        for (unsigned i = 0; i < columns.size(); ++i) {
+          columns.expected_[i] = math::ZeroFun(columns.expected_[i], math::ZERO);
             n++;
-            Double cv = comparison.error_value_;
-            if (comparison.error_value_ > 0.0 && comparison.process_error_ > 0.0)
-              cv =  sqrt(comparison.error_value_ * comparison.error_value_ + comparison.process_error_ * comparison.process_error_);
+            Double cv = columns.error_value_[i];
+            if (columns.error_value_[i] > 0.0 && columns.process_error_[i] > 0.0)
+              cv =  sqrt(columns.error_value_[i] * columns.error_value_[i] + columns.process_error_[i] * columns.process_error_[i]);
 
             Double sigma = sqrt(log(1 + cv * cv));
-            LOG_FINEST() << "obs = " <<  comparison.observed_ << " exp = " <<  comparison.expected_ << " sigma = " << sigma;
+            LOG_FINEST() << "obs = " <<  columns.observed_[i] << " exp = " <<  columns.expected_[i] << " sigma = " << sigma;
 
-            s3 += log(comparison.observed_ / comparison.expected_) / (sigma * sigma);
+            s3 += log(columns.observed_[i] / columns.expected_[i]) / (sigma * sigma);
             s4 += 1 / (sigma * sigma);
           }
         }
@@ -18,7 +18,7 @@
 
 // headers
 #include "../../Catchabilities/Catchability.h"
-#include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 
 // namespaces
 namespace niwa {
@@ -34,7 +34,7 @@ public:
   virtual                     ~Nuisance() {};
   void                        DoValidate() final {};
   void                        DoBuild() final;
-  void                        CalculateQ(map<unsigned, vector<observations::Comparison> >& comparisons, string_view likelihood);
+  void                        CalculateQ(map<unsigned, observations::ComparisonColumns>& comparisons, string_view likelihood);
 
 private:
   // members
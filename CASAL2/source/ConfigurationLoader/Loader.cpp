@@ -14,6 +14,7 @@
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <thread>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim_all.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -178,14 +179,32 @@ void Loader::ParseFileLines() {
 }
 
 /**
+ * Build the objects for each model from the blocks we have loaded.
  *
+ * When there is more than one model (i.e. the models for the threads) each
+ * model is built on its own thread. Our blocks are only read while building
+ * and each model has its own count of inline definitions so they get the same
+ * labels as the master model.
+ *
+ * @param model_list The models to build
  */
 void Loader::Build(vector<shared_ptr<Model>>& model_list) {
-	for (auto model : model_list) {
-		for (auto& block : blocks_) {
-			ParseBlock(model, block);
-		}
+	auto build_model = [this](shared_ptr<Model> model) {
+		map<string, unsigned> inline_count;
+		for (auto& block : blocks_)
+			ParseBlock(model, block, inline_count);
+	};
+
+	if (model_list.size() == 1) {
+		build_model(model_list[0]);
+		return;
 	}
+
+	vector<std::thread> threads;
+	for (auto model : model_list)
+		threads.push_back(std::thread(build_model, model));
+	for (auto& thread : threads)
+		thread.join();
 }
 
 /**
@@ -193,9 +212,11 @@ void Loader::Build(vector<shared_ptr<Model>>& model_list) {
  * configuration data. A block definition starts with an
  * @block line.
  *
+ * @param model The model to create the objects in
  * @param block Vector of block's line definitions
+ * @param inline_count The number of inline definitions created for each parent
  */
-void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
+void Loader::ParseBlock(shared_ptr<Model> model, const vector<FileLine> &block, map<string, unsigned>& inline_count) {
 	LOG_TRACE();
 	if (block.size() == 0)
 		LOG_CODE_ERROR()
@@ -322,6 +343,7 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
 	bool loading_table = false;
 	bool loading_columns = false;
 	string table_label = "";
+	parameters::Table* current_table = nullptr;
 
 	// Iterate the loaded file lines for this block
 	for (FileLine file_line : block) {
@@ -331,7 +353,7 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
 			continue; // Skip @block definition
 
 		string parent_label = block_label == "" ? block_type : block_label;
-		HandleInlineDefinitions(model, file_line, parent_label);
+		HandleInlineDefinitions(model, file_line, parent_label, inline_count);
 
 		current_line = file_line.line_;
 
@@ -359,26 +381,26 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
 						<< ": table parameter requires a valid label. Please use alphanumeric characters and underscores only";
 
 			table_label = util::ToLowercase(line_parts[1]);
-			current_table_ = object->parameters().GetTable(table_label);
-			if (!current_table_)
+			current_table = object->parameters().GetTable(table_label);
+			if (!current_table)
 				LOG_FATAL()
 				<< "At line " << file_line.line_number_ << " in " << file_line.file_name_ << ": table " << table_label << " is not a supported table label.";
-			current_table_->set_file_name(file_line.file_name_);
-			current_table_->set_line_number(file_line.line_number_);
+			current_table->set_file_name(file_line.file_name_);
+			current_table->set_line_number(file_line.line_number_);
 
 		} else if (loading_table && loading_columns) {
 			/**
 			 * Loading column headers from the table if they exist.
 			 */
 			vector<string> values(line_parts.begin(), line_parts.end());
-			if (!current_table_)
+			if (!current_table)
 				LOG_CODE_ERROR()
 				<< "!current_table";
 
-			if (current_table_->requires_comlums())
-				current_table_->AddColumns(values);
+			if (current_table->requires_comlums())
+				current_table->AddColumns(values);
 			else
-				current_table_->AddRow(values);
+				current_table->AddRow(values);
 			loading_columns = false;
 
 		} else if (loading_table && parameter_type != PARAM_END_TABLE) {
@@ -388,13 +410,13 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
 			vector<string> values(line_parts.begin(), line_parts.end());
 
 			// We're loading a standard row of data for the table
-			if (current_table_->requires_comlums() && values.size() != current_table_->column_count()) {
+			if (current_table->requires_comlums() && values.size() != current_table->column_count()) {
 				LOG_FATAL()
 				<< "At line " << file_line.line_number_ << " in " << file_line.file_name_ << ": Table data does not contain the correct number of columns. Expected ("
-						<< current_table_->column_count() << ") : Actual (" << values.size() << ")\n" << boost::join(values, ", ");
+						<< current_table->column_count() << ") : Actual (" << values.size() << ")\n" << boost::join(values, ", ");
 			}
 
-			current_table_->AddRow(values);
+			current_table->AddRow(values);
 
 		} else if (loading_table && parameter_type == PARAM_END_TABLE) {
 			// We've found the end of our table.
@@ -403,7 +425,7 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
 
 			loading_table = false;
 			loading_columns = false;
-			current_table_ = nullptr;
+			current_table = nullptr;
 
 		} else {
 			/**
@@ -450,7 +472,7 @@ void Loader::ParseBlock(shared_ptr<Model> model, vector<FileLine> &block) {
  *
  * All labels created will be prefixed with <parent>.
  */
-void Loader::HandleInlineDefinitions(shared_ptr<Model> model, FileLine &file_line, const string &parent_label) {
+void Loader::HandleInlineDefinitions(shared_ptr<Model> model, FileLine &file_line, const string &parent_label, map<string, unsigned>& inline_count) {
 	vector<string> replacements = { "one", "two", "three", "four", "five", "six", "seven", "eight", "nine" };
 
 	/**
@@ -510,9 +532,9 @@ void Loader::HandleInlineDefinitions(shared_ptr<Model> model, FileLine &file_lin
 				full_definition = file_line.line_.substr(space_loc + 1, second_inline_bracket - space_loc);
 
 			} else {
-				unsigned index = inline_count_[block_type + "." + parent_label];
+				unsigned index = inline_count[block_type + "." + parent_label];
 				string s_index = index < replacements.size() ? replacements[index] : utilities::ToInline<unsigned, string>(++index);
-				++inline_count_[block_type + "." + parent_label];
+				++inline_count[block_type + "." + parent_label];
 
 				label = parent_label + string(".") + s_index;
 				full_definition = file_line.line_.substr(first_inline_bracket, second_inline_bracket - first_inline_bracket + 1);
@@ -549,7 +571,7 @@ void Loader::HandleInlineDefinitions(shared_ptr<Model> model, FileLine &file_lin
 					inline_block.push_back(new_line);
 				}
 
-				ParseBlock(model, inline_block);
+				ParseBlock(model, inline_block, inline_count);
 			}
 			LOG_FINEST() << "first_inline_bracket: " << first_inline_bracket << "; second_inline_bracket: " << second_inline_bracket;
 
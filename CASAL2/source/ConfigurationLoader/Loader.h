@@ -63,15 +63,13 @@ public:
 
 private:
   // Methods
-  void                        ParseBlock(shared_ptr<Model> model, vector<FileLine> &block);
-  void                        HandleInlineDefinitions(shared_ptr<Model> model, FileLine& file_line, const string& parent_label);
+  void                        ParseBlock(shared_ptr<Model> model, const vector<FileLine> &block, map<string, unsigned>& inline_count);
+  void                        HandleInlineDefinitions(shared_ptr<Model> model, FileLine& file_line, const string& parent_label, map<string, unsigned>& inline_count);
 
 
   // Members
   vector<FileLine>            file_lines_;
   vector<vector<FileLine>>		blocks_;
-  parameters::Table*          current_table_ = nullptr;
-  map<string, unsigned>       inline_count_;
   string											model_type_ = "";
 };
 
@@ -19,6 +19,7 @@
 // headers
 #include "../BaseClasses/Executor.h"
 #include "../Partition/Accessors/Categories.h"
+#include "../Utilities/Map.h"
 
 // namespaces
 namespace niwa {
@@ -37,6 +38,8 @@ public:
   void                        Validate();
   void                        Build();
   void                        Reset();
+  void                        SaveSnapshot() { snapshot_values_ = values_; }
+  void                        RestoreSnapshot() { utilities::Map::assign(values_, snapshot_values_); }
   Double                      GetValue(unsigned year);
   Double                      GetInitialisationValue(unsigned phase = 0, unsigned index = 0);
   Double                      GetLastValueFromInitialisation(unsigned phase);
@@ -57,6 +60,7 @@ protected:
   unsigned                    current_initialisation_phase_ = 0;
   vector<vector<Double>>      initialisation_values_;
   map<unsigned, Double>       values_;
+  map<unsigned, Double>       snapshot_values_;
   Double                      cache_value_;
   vector<string>              selectivity_labels_;
   vector<Selectivity*>        selectivities_;
@@ -0,0 +1,124 @@
+/**
+ * @file CompiledEquation.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "CompiledEquation.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+
+/**
+ * Simple lookup object that holds named values
+ * and counts how many times they are looked up
+ */
+class TestLookup : public LookupObject<Double> {
+public:
+  Double& LookupValue(const std::string& name) override {
+    ++lookups_;
+    if (values_.find(name) == values_.end())
+      throw std::runtime_error("Unknown name: " + name);
+    return values_[name];
+  }
+
+  map<string, Double> values_;
+  unsigned            lookups_ = 0;
+};
+
+/**
+ * Check the compiled equations give the same values
+ * as the third-party parser
+ */
+TEST(CompiledEquation, MatchesParser) {
+  vector<string> equations = {
+    "1 + 2 * 3", "(1 + 2) * 3", "10 - 4 - 3", "2 * -3", "-2 - -3", "(2 + 3)-1", "a -1", "-a * b",
+    "8 / 4 / 2", ".5 + 1.5e2", "!0 + !a", "a < b", "a > b", "a <= 2", "b >= 3", "a == 2", "a != 2",
+    "a && 0", "a || 0", "0 || 0", "exp(log(a))", "sqrt(b * b)", "min(a, b)", "max(a, b)", "pow(a, b)",
+    "if(a < b, a * 10, b * 10)", "if(a > b && 1, 1, 0) + 5", "1, 2, a + b", "(1, b) * 2",
+    "derived_quantity[ssb].values{2010} / 1000", "min(0.2, derived_quantity[ssb].values{2010} * 0.001)"
+  };
+
+  TestLookup lookup;
+  lookup.values_ = { { "a", 2.0 }, { "b", 3.0 }, { "derived_quantity[ssb].values{2010}", 12345.0 } };
+  map<string, EquationFunction> functions;
+  functions["exp"] = exp;
+  functions["log"] = log;
+  functions["sqrt"] = sqrt;
+
+  Parser<Double, Double, Double> parser(&lookup);
+  parser.AddOneArgumentFunction("exp", exp);
+  parser.AddOneArgumentFunction("log", log);
+  parser.AddOneArgumentFunction("sqrt", sqrt);
+
+  for (const string& equation : equations) {
+    shared_ptr<CompiledEquation> compiled = CompiledEquation::Compile(equation, &lookup, functions);
+    EXPECT_DOUBLE_EQ(parser.Evaluate(equation), compiled->Evaluate()) << equation;
+  }
+}
+
+/**
+ * Check addressables are only looked up when the equation is compiled
+ * and changes to them are seen when the equation is evaluated
+ */
+TEST(CompiledEquation, BindsValues) {
+  TestLookup lookup;
+  lookup.values_ = { { "a", 2.0 }, { "b", 3.0 } };
+  map<string, EquationFunction> functions;
+
+  shared_ptr<CompiledEquation> compiled = CompiledEquation::Compile("a * b + a", &lookup, functions);
+  EXPECT_EQ(3u, lookup.lookups_);
+  EXPECT_DOUBLE_EQ(8.0, compiled->Evaluate());
+
+  lookup.values_["a"] = 4.0;
+  EXPECT_DOUBLE_EQ(16.0, compiled->Evaluate());
+  EXPECT_DOUBLE_EQ(16.0, compiled->Evaluate());
+  EXPECT_EQ(3u, lookup.lookups_);
+}
+
+/**
+ * Check assignments change the value of the addressable
+ */
+TEST(CompiledEquation, Assignments) {
+  TestLookup lookup;
+  lookup.values_ = { { "a", 2.0 }, { "b", 3.0 } };
+  map<string, EquationFunction> functions;
+
+  shared_ptr<CompiledEquation> compiled = CompiledEquation::Compile("a = b * 2, a += 1, a -= 2, a *= 3, a /= 5, a + 1", &lookup, functions);
+  EXPECT_DOUBLE_EQ(4.0, compiled->Evaluate());
+  EXPECT_DOUBLE_EQ(3.0, lookup.values_["a"]);
+}
+
+/**
+ * Check errors in the equation are thrown when it is compiled
+ * and a divide by zero is thrown when it is evaluated
+ */
+TEST(CompiledEquation, Errors) {
+  TestLookup lookup;
+  lookup.values_ = { { "a", 2.0 }, { "zero", 0.0 } };
+  map<string, EquationFunction> functions;
+
+  EXPECT_THROW(CompiledEquation::Compile("1 +", &lookup, functions), std::runtime_error);
+  EXPECT_THROW(CompiledEquation::Compile("(1 + 2", &lookup, functions), std::runtime_error);
+  EXPECT_THROW(CompiledEquation::Compile("1 + 2)", &lookup, functions), std::runtime_error);
+  EXPECT_THROW(CompiledEquation::Compile("unknown(1)", &lookup, functions), std::runtime_error);
+  EXPECT_THROW(CompiledEquation::Compile("a + c", &lookup, functions), std::runtime_error);
+  EXPECT_THROW(CompiledEquation::Compile("1 # 2", &lookup, functions), std::runtime_error);
+
+  shared_ptr<CompiledEquation> compiled = CompiledEquation::Compile("a / zero", &lookup, functions);
+  EXPECT_THROW(compiled->Evaluate(), std::runtime_error);
+  lookup.values_["zero"] = 4.0;
+  EXPECT_DOUBLE_EQ(0.5, compiled->Evaluate());
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,587 @@
+/**
+ * @file CompiledEquation.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "CompiledEquation.h"
+
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+// namespaces
+namespace niwa {
+
+using OpCode = CompiledEquation::OpCode;
+
+/**
+ * This class compiles an equation in to a CompiledEquation. It is a copy of
+ * the recursive descent parser in the third-party library (parser-inl.h) that
+ * emits instructions instead of evaluating the equation as it goes, so the
+ * grammar, precedence and error messages are the same.
+ */
+class EquationCompiler {
+public:
+  enum TokenType {
+    NONE,
+    NAME,
+    NUMBER,
+    END,
+    PLUS = '+',
+    MINUS = '-',
+    MULTIPLY = '*',
+    DIVIDE = '/',
+    ASSIGN = '=',
+    LHPAREN = '(',
+    RHPAREN = ')',
+    COMMA = ',',
+    NOT = '!',
+    LT = '<',
+    GT = '>',
+    LE,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+    ASSIGN_ADD,
+    ASSIGN_SUB,
+    ASSIGN_MUL,
+    ASSIGN_DIV
+  };
+
+  // methods
+  EquationCompiler(CompiledEquation& equation, LookupObject<Double>* lookup_object, const map<string, EquationFunction>& functions)
+    : equation_(equation), lookup_object_(lookup_object), functions_(functions) { };
+
+  void                        Compile();
+
+private:
+  // methods
+  TokenType                   GetToken(bool ignore_sign = false);
+  void                        CommaList(bool get);
+  void                        Expression(bool get);
+  void                        Comparison(bool get);
+  void                        AddSubtract(bool get);
+  void                        Term(bool get);
+  void                        Primary(bool get);
+  void                        Emit(OpCode op_code, int stack_change);
+  void                        CheckToken(TokenType wanted);
+
+  // members
+  CompiledEquation&           equation_;
+  LookupObject<Double>*       lookup_object_ = nullptr;
+  const map<string, EquationFunction>& functions_;
+  const char*                 word_position_ = nullptr;
+  const char*                 word_start_ = nullptr;
+  TokenType                   type_ = NONE;
+  string                      word_ = "";
+  double                      value_ = 0.0;
+  int                         depth_ = 0;
+  int                         max_depth_ = 0;
+};
+
+/**
+ * Compile the equation
+ */
+void EquationCompiler::Compile() {
+  word_position_ = equation_.equation_.c_str();
+  type_ = NONE;
+  CommaList(true);
+  if (type_ != END)
+    throw std::runtime_error("Unexpected text at end of expression: " + string(word_start_));
+
+  equation_.stack_.resize(max_depth_);
+}
+
+/**
+ * Add an instruction to the equation
+ *
+ * @param op_code The operation
+ * @param stack_change The change in the size of the stack after the operation
+ */
+void EquationCompiler::Emit(OpCode op_code, int stack_change) {
+  CompiledEquation::Instruction instruction;
+  instruction.op_code_ = op_code;
+  equation_.instructions_.push_back(instruction);
+
+  depth_ += stack_change;
+  if (depth_ > max_depth_)
+    max_depth_ = depth_;
+}
+
+/**
+ * Check the current token is the one we want
+ */
+void EquationCompiler::CheckToken(TokenType wanted) {
+  if (type_ != wanted) {
+    std::ostringstream s;
+    s << "'" << static_cast<char>(wanted) << "' expected.";
+    throw std::runtime_error(s.str());
+  }
+}
+
+/**
+ * Get the next token from the equation
+ *
+ * @param ignore_sign True if a leading + or - is an operator instead of part of a number
+ * @return The type of the token
+ */
+EquationCompiler::TokenType EquationCompiler::GetToken(bool ignore_sign) {
+  word_ = "";
+
+  while (*word_position_ && isspace(*word_position_))
+    ++word_position_;
+  word_start_ = word_position_;
+
+  if (*word_position_ == 0 && type_ == END)
+    throw std::runtime_error("Unexpected end of expression.");
+
+  unsigned char first_character = *word_position_;
+  if (first_character == 0) {
+    word_ = "<end of expression>";
+    return type_ = END;
+  }
+
+  unsigned char next_character = *(word_position_ + 1);
+
+  // numbers: an optional sign, digits and decimal point then an optional exponent
+  if ((!ignore_sign && (first_character == '+' || first_character == '-') && (isdigit(next_character) || next_character == '.'))
+      || isdigit(first_character)
+      || (first_character == '.' && isdigit(next_character))) {
+    if (first_character == '+' || first_character == '-')
+      ++word_position_;
+    while (isdigit(*word_position_) || *word_position_ == '.')
+      ++word_position_;
+
+    if (*word_position_ == 'e' || *word_position_ == 'E') {
+      ++word_position_;
+      if (*word_position_ == '+' || *word_position_ == '-')
+        ++word_position_;
+      while (isdigit(*word_position_))
+        ++word_position_;
+    }
+
+    word_ = string(word_start_, word_position_ - word_start_);
+    std::istringstream is(word_);
+    is >> value_;
+    if (is.fail() && !is.eof())
+      throw std::runtime_error("Bad numeric literal: " + word_);
+    return type_ = NUMBER;
+  }
+
+  // 2 character comparisons and assignments
+  if (next_character == '=') {
+    switch (first_character) {
+    case '=': type_ = EQ; break;
+    case '<': type_ = LE; break;
+    case '>': type_ = GE; break;
+    case '!': type_ = NE; break;
+    case '+': type_ = ASSIGN_ADD; break;
+    case '-': type_ = ASSIGN_SUB; break;
+    case '*': type_ = ASSIGN_MUL; break;
+    case '/': type_ = ASSIGN_DIV; break;
+    default: type_ = NONE; break;
+    }
+
+    if (type_ != NONE) {
+      word_ = string(word_start_, 2);
+      word_position_ += 2;
+      return type_;
+    }
+  }
+
+  switch (first_character) {
+  case '&':
+    if (next_character == '&') {
+      word_ = string(word_start_, 2);
+      word_position_ += 2;
+      return type_ = AND;
+    }
+    break;
+  case '|':
+    if (next_character == '|') {
+      word_ = string(word_start_, 2);
+      word_position_ += 2;
+      return type_ = OR;
+    }
+    break;
+  case '=':
+  case '<':
+  case '>':
+  case '+':
+  case '-':
+  case '/':
+  case '*':
+  case '(':
+  case ')':
+  case ',':
+  case '!':
+    word_ = string(word_start_, 1);
+    ++word_position_;
+    return type_ = TokenType(first_character);
+  }
+
+  if (!isalpha(first_character) && first_character != '[' && first_character != ']' && first_character != '.' && first_character != '}' && first_character != '{') {
+    if (first_character < ' ') {
+      std::ostringstream s;
+      s << "Unexpected character (decimal " << int(first_character) << ")";
+      throw std::runtime_error(s.str());
+    }
+    throw std::runtime_error("Unexpected character: " + string(1, first_character));
+  }
+
+  // names, e.g. process[recruitment].r0 or derived_quantity[ssb].values{2010}
+  while (isalnum(*word_position_) || *word_position_ == '_' || *word_position_ == '[' || *word_position_ == ']'
+      || *word_position_ == '.' || *word_position_ == '}' || *word_position_ == '{')
+    ++word_position_;
+
+  word_ = string(word_start_, word_position_ - word_start_);
+  return type_ = NAME;
+}
+
+/**
+ * Primary: numbers, addressables, functions, unary operators and brackets
+ */
+void EquationCompiler::Primary(bool get) {
+  if (get)
+    GetToken();
+
+  switch (type_) {
+  case NUMBER: {
+    double value = value_;
+    GetToken(true);
+    Emit(OpCode::kConstant, 1);
+    equation_.instructions_.back().constant_ = value;
+    return;
+  }
+
+  case NAME: {
+    string word = word_;
+    GetToken(true);
+    if (type_ == LHPAREN) {
+      auto function = functions_.find(word);
+      if (function != functions_.end()) {
+        Expression(true);
+        CheckToken(RHPAREN);
+        GetToken(true);
+        Emit(OpCode::kFunction, 0);
+        equation_.instructions_.back().function_ = function->second;
+        return;
+      }
+
+      if (word == "min" || word == "max" || word == "pow") {
+        Expression(true);
+        CheckToken(COMMA);
+        Expression(true);
+        CheckToken(RHPAREN);
+        GetToken(true);
+        Emit(word == "min" ? OpCode::kMin : word == "max" ? OpCode::kMax : OpCode::kPow, -1);
+        return;
+      }
+
+      if (word == "if") {
+        Expression(true);
+        CheckToken(COMMA);
+        Expression(true);
+        CheckToken(COMMA);
+        Expression(true);
+        CheckToken(RHPAREN);
+        GetToken(true);
+        Emit(OpCode::kIf, -2);
+        return;
+      }
+
+      throw std::runtime_error("Function '" + word + "' not implemented.");
+    }
+
+    // an addressable, this is bound once here instead of every time we evaluate
+    Double* value = &lookup_object_->LookupValue(word);
+    OpCode op_code = OpCode::kLoad;
+    switch (type_) {
+    case ASSIGN:      op_code = OpCode::kAssign; break;
+    case ASSIGN_ADD:  op_code = OpCode::kAssignAdd; break;
+    case ASSIGN_SUB:  op_code = OpCode::kAssignSubtract; break;
+    case ASSIGN_MUL:  op_code = OpCode::kAssignMultiply; break;
+    case ASSIGN_DIV:  op_code = OpCode::kAssignDivide; break;
+    default: break;
+    }
+
+    if (op_code == OpCode::kLoad)
+      Emit(OpCode::kLoad, 1);
+    else {
+      Expression(true);
+      Emit(op_code, 0);
+    }
+    equation_.instructions_.back().value_ = value;
+    return;
+  }
+
+  case MINUS:
+    Primary(true);
+    Emit(OpCode::kNegate, 0);
+    return;
+
+  case NOT:
+    Primary(true);
+    Emit(OpCode::kNot, 0);
+    return;
+
+  case LHPAREN:
+    CommaList(true);
+    CheckToken(RHPAREN);
+    GetToken(true);
+    return;
+
+  default:
+    throw std::runtime_error("Unexpected token: " + word_);
+  }
+}
+
+/**
+ * Multiply and divide
+ */
+void EquationCompiler::Term(bool get) {
+  Primary(get);
+  while (true) {
+    switch (type_) {
+    case MULTIPLY:
+      Primary(true);
+      Emit(OpCode::kMultiply, -1);
+      break;
+    case DIVIDE:
+      Primary(true);
+      Emit(OpCode::kDivide, -1);
+      break;
+    default:
+      return;
+    }
+  }
+}
+
+/**
+ * Add and subtract
+ */
+void EquationCompiler::AddSubtract(bool get) {
+  Term(get);
+  while (true) {
+    switch (type_) {
+    case PLUS:
+      Term(true);
+      Emit(OpCode::kAdd, -1);
+      break;
+    case MINUS:
+      Term(true);
+      Emit(OpCode::kSubtract, -1);
+      break;
+    default:
+      return;
+    }
+  }
+}
+
+/**
+ * Comparisons
+ */
+void EquationCompiler::Comparison(bool get) {
+  AddSubtract(get);
+  while (true) {
+    OpCode op_code;
+    switch (type_) {
+    case LT: op_code = OpCode::kLessThan; break;
+    case GT: op_code = OpCode::kGreaterThan; break;
+    case LE: op_code = OpCode::kLessThanEqual; break;
+    case GE: op_code = OpCode::kGreaterThanEqual; break;
+    case EQ: op_code = OpCode::kEqual; break;
+    case NE: op_code = OpCode::kNotEqual; break;
+    default:
+      return;
+    }
+    AddSubtract(true);
+    Emit(op_code, -1);
+  }
+}
+
+/**
+ * And and or. Both sides are always evaluated
+ */
+void EquationCompiler::Expression(bool get) {
+  Comparison(get);
+  while (true) {
+    switch (type_) {
+    case AND:
+      Comparison(true);
+      Emit(OpCode::kAnd, -1);
+      break;
+    case OR:
+      Comparison(true);
+      Emit(OpCode::kOr, -1);
+      break;
+    default:
+      return;
+    }
+  }
+}
+
+/**
+ * Comma separated expressions. The value is the last expression
+ */
+void EquationCompiler::CommaList(bool get) {
+  Expression(get);
+  while (type_ == COMMA) {
+    Emit(OpCode::kPop, -1);
+    Expression(true);
+  }
+}
+
+/**
+ * Compile an equation
+ *
+ * @param equation The equation to compile
+ * @param lookup_object The object used to find the addressables in the equation
+ * @param functions The one argument functions that can be used in the equation
+ * @return The compiled equation
+ */
+shared_ptr<CompiledEquation> CompiledEquation::Compile(const string& equation, LookupObject<Double>* lookup_object,
+    const map<string, EquationFunction>& functions) {
+  shared_ptr<CompiledEquation> result(new CompiledEquation(equation));
+  EquationCompiler compiler(*result, lookup_object, functions);
+  compiler.Compile();
+  return result;
+}
+
+/**
+ * Evaluate the equation. The stack was sized when the equation
+ * was compiled so this does not allocate any memory.
+ *
+ * @return The value of the equation
+ */
+Double CompiledEquation::Evaluate() {
+  Double* top = stack_.data(); // one past the top of the stack
+
+  for (const Instruction& instruction : instructions_) {
+    switch (instruction.op_code_) {
+    case OpCode::kConstant:
+      *top++ = instruction.constant_;
+      break;
+    case OpCode::kLoad:
+      *top++ = *instruction.value_;
+      break;
+    case OpCode::kAssign:
+      *instruction.value_ = top[-1];
+      top[-1] = *instruction.value_;
+      break;
+    case OpCode::kAssignAdd:
+      *instruction.value_ += top[-1];
+      top[-1] = *instruction.value_;
+      break;
+    case OpCode::kAssignSubtract:
+      *instruction.value_ -= top[-1];
+      top[-1] = *instruction.value_;
+      break;
+    case OpCode::kAssignMultiply:
+      *instruction.value_ *= top[-1];
+      top[-1] = *instruction.value_;
+      break;
+    case OpCode::kAssignDivide:
+      if (top[-1] == 0.0)
+        throw std::runtime_error("Divide by zero");
+      *instruction.value_ /= top[-1];
+      top[-1] = *instruction.value_;
+      break;
+    case OpCode::kPop:
+      --top;
+      break;
+    case OpCode::kNegate:
+      top[-1] = -top[-1];
+      break;
+    case OpCode::kNot:
+      top[-1] = top[-1] == 0.0 ? 1.0 : 0.0;
+      break;
+    case OpCode::kAdd:
+      top[-2] += top[-1];
+      --top;
+      break;
+    case OpCode::kSubtract:
+      top[-2] -= top[-1];
+      --top;
+      break;
+    case OpCode::kMultiply:
+      top[-2] *= top[-1];
+      --top;
+      break;
+    case OpCode::kDivide:
+      if (top[-1] == 0.0)
+        throw std::runtime_error("Divide by zero");
+      top[-2] /= top[-1];
+      --top;
+      break;
+    case OpCode::kLessThan:
+      top[-2] = top[-2] < top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kGreaterThan:
+      top[-2] = top[-2] > top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kLessThanEqual:
+      top[-2] = top[-2] <= top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kGreaterThanEqual:
+      top[-2] = top[-2] >= top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kEqual:
+      top[-2] = top[-2] == top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kNotEqual:
+      top[-2] = top[-2] != top[-1] ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kAnd:
+      top[-2] = (top[-2] != 0.0 && top[-1] != 0.0) ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kOr:
+      top[-2] = (top[-2] != 0.0 || top[-1] != 0.0) ? 1.0 : 0.0;
+      --top;
+      break;
+    case OpCode::kFunction:
+      top[-1] = instruction.function_(top[-1]);
+      break;
+    case OpCode::kMin:
+      if (!(top[-2] < top[-1]))
+        top[-2] = top[-1];
+      --top;
+      break;
+    case OpCode::kMax:
+      if (!(top[-2] > top[-1]))
+        top[-2] = top[-1];
+      --top;
+      break;
+    case OpCode::kPow:
+      top[-2] = pow(top[-2], top[-1]);
+      --top;
+      break;
+    case OpCode::kIf:
+      if (top[-3] != 0.0)
+        top[-3] = top[-2];
+      else
+        top[-3] = top[-1];
+      top -= 2;
+      break;
+    }
+  }
+
+  return top[-1];
+}
+
+} /* namespace niwa */
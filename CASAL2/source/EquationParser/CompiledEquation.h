@@ -0,0 +1,132 @@
+/**
+ * @file CompiledEquation.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds an equation that has been compiled in to a list of
+ * instructions for a small stack machine. The equation is tokenised and
+ * parsed once, with the same grammar as the third-party equation parser, and
+ * every addressable it uses is looked up once and stored as a pointer.
+ *
+ * Evaluating the equation only walks the instructions, so an equation that is
+ * evaluated every year of every projection does not have to be parsed or have
+ * its addressables found again.
+ *
+ * Errors in the equation are thrown as std::runtime_error when it is compiled.
+ * The only error thrown by Evaluate() is a divide by zero.
+ */
+#ifndef SOURCE_EQUATIONPARSER_COMPILEDEQUATION_H_
+#define SOURCE_EQUATIONPARSER_COMPILEDEQUATION_H_
+
+// headers
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../Utilities/Types.h"
+
+#include <parser.h>
+
+// namespaces
+namespace niwa {
+using std::map;
+using std::shared_ptr;
+using std::string;
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * The type of the one argument functions (e.g. exp, log) that can
+ * be used in an equation. This matches the functions registered
+ * with the third-party parser for each auto-differentiation library
+ */
+#ifdef USE_ADOLC
+typedef adub (*EquationFunction)(const badouble&);
+#elif USE_BETADIFF
+typedef adub (*EquationFunction)(const badouble&);
+#elif USE_CPPAD
+typedef CppAD::AD<double> (*EquationFunction)(const CppAD::AD<double>&);
+#else
+typedef Double (*EquationFunction)(Double);
+#endif
+
+/**
+ * Class definition
+ */
+class CompiledEquation {
+  friend class EquationCompiler;
+public:
+  /**
+   * The operations our stack machine supports
+   */
+  enum class OpCode {
+    kConstant,      // push constant_
+    kLoad,          // push *value_
+    kAssign,        // *value_ = pop, push *value_
+    kAssignAdd,     // *value_ += pop, push *value_
+    kAssignSubtract,
+    kAssignMultiply,
+    kAssignDivide,
+    kPop,           // discard the top of the stack (comma operator)
+    kNegate,
+    kNot,
+    kAdd,
+    kSubtract,
+    kMultiply,
+    kDivide,
+    kLessThan,
+    kGreaterThan,
+    kLessThanEqual,
+    kGreaterThanEqual,
+    kEqual,
+    kNotEqual,
+    kAnd,
+    kOr,
+    kFunction,      // apply function_ to the top of the stack
+    kMin,
+    kMax,
+    kPow,
+    kIf
+  };
+
+  /**
+   * A single instruction
+   */
+  struct Instruction {
+    OpCode            op_code_;
+    Double*           value_ = nullptr;
+    double            constant_ = 0.0;
+    EquationFunction  function_ = nullptr;
+  };
+
+  // methods
+  CompiledEquation() = delete;
+  virtual                     ~CompiledEquation() = default;
+  Double                      Evaluate();
+
+  static shared_ptr<CompiledEquation> Compile(const string& equation, LookupObject<Double>* lookup_object,
+                                  const map<string, EquationFunction>& functions);
+
+  // accessors
+  const string&               equation() const { return equation_; }
+  const vector<Instruction>&  instructions() const { return instructions_; }
+
+private:
+  // methods
+  explicit CompiledEquation(const string& equation) : equation_(equation) { };
+
+  // members
+  string                      equation_ = "";
+  vector<Instruction>         instructions_;
+  vector<Double>              stack_;
+};
+
+} /* namespace niwa */
+
+#endif /* SOURCE_EQUATIONPARSER_COMPILEDEQUATION_H_ */
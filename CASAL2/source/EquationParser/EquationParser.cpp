@@ -23,94 +23,78 @@ namespace niwa {
  */
 EquationParser::EquationParser(shared_ptr<Model> model) : model_(model) {
 #ifdef USE_ADOLC
-  parser_ = new Parser<adouble, adub, const badouble&>(this);
-
-  parser_->AddOneArgumentFunction("abs", fabs);
-  parser_->AddOneArgumentFunction("acos", acos);
-  parser_->AddOneArgumentFunction("asin", asin);
-  parser_->AddOneArgumentFunction("atan", atan);
-  parser_->AddOneArgumentFunction("ceil", ceil);
-  parser_->AddOneArgumentFunction("cos", cos);
-  parser_->AddOneArgumentFunction("cosh", cosh);
-  parser_->AddOneArgumentFunction("exp", exp);
-  parser_->AddOneArgumentFunction("floor", floor);
-  parser_->AddOneArgumentFunction("log", log);
-  parser_->AddOneArgumentFunction("log10", log10);
-  parser_->AddOneArgumentFunction("sin", sin);
-  parser_->AddOneArgumentFunction("sinh", sinh);
-  parser_->AddOneArgumentFunction("sqrt", sqrt);
-  parser_->AddOneArgumentFunction("tan", tan);
-  parser_->AddOneArgumentFunction("tanh", tanh);
+  functions_["abs"] = fabs;
+  functions_["acos"] = acos;
+  functions_["asin"] = asin;
+  functions_["atan"] = atan;
+  functions_["ceil"] = ceil;
+  functions_["cos"] = cos;
+  functions_["cosh"] = cosh;
+  functions_["exp"] = exp;
+  functions_["floor"] = floor;
+  functions_["log"] = log;
+  functions_["log10"] = log10;
+  functions_["sin"] = sin;
+  functions_["sinh"] = sinh;
+  functions_["sqrt"] = sqrt;
+  functions_["tan"] = tan;
+  functions_["tanh"] = tanh;
 
 #elif USE_BETADIFF
-  parser_ = new Parser<adouble, adub, const badouble&>(this);
-
-//  parser_->AddOneArgumentFunction("abs", fabs);
-//  parser_->AddOneArgumentFunction("acos", acos);
-//  parser_->AddOneArgumentFunction("asin", asin);
-//  parser_->AddOneArgumentFunction("atan", atan);
-//  parser_->AddOneArgumentFunction("ceil", ceil);
-//  parser_->AddOneArgumentFunction("cos", cos);
-//  parser_->AddOneArgumentFunction("cosh", cosh);
-//  parser_->AddOneArgumentFunction("exp", exp);
-//  parser_->AddOneArgumentFunction("floor", floor);
-//  parser_->AddOneArgumentFunction("log", log);
-//  parser_->AddOneArgumentFunction("log10", log10);
-//  parser_->AddOneArgumentFunction("sin", sin);
-//  parser_->AddOneArgumentFunction("sinh", sinh);
-//  parser_->AddOneArgumentFunction("sqrt", sqrt);
-//  parser_->AddOneArgumentFunction("tan", tan);
-//  parser_->AddOneArgumentFunction("tanh", tanh);
+//  functions_["abs"] = fabs;
+//  functions_["acos"] = acos;
+//  functions_["asin"] = asin;
+//  functions_["atan"] = atan;
+//  functions_["ceil"] = ceil;
+//  functions_["cos"] = cos;
+//  functions_["cosh"] = cosh;
+//  functions_["exp"] = exp;
+//  functions_["floor"] = floor;
+//  functions_["log"] = log;
+//  functions_["log10"] = log10;
+//  functions_["sin"] = sin;
+//  functions_["sinh"] = sinh;
+//  functions_["sqrt"] = sqrt;
+//  functions_["tan"] = tan;
+//  functions_["tanh"] = tanh;
 
 #elif USE_CPPAD
-  parser_ = new Parser<CppAD::AD<double>, CppAD::AD<double>, const CppAD::AD<double>&>(this);
-
-  parser_->AddOneArgumentFunction("abs", CppAD::abs);
-  parser_->AddOneArgumentFunction("acos", CppAD::acos);
-  parser_->AddOneArgumentFunction("asin", CppAD::asin);
-  parser_->AddOneArgumentFunction("atan", CppAD::atan);
-  parser_->AddOneArgumentFunction("cos", CppAD::cos);
-  parser_->AddOneArgumentFunction("cosh", CppAD::cosh);
-  parser_->AddOneArgumentFunction("exp", CppAD::exp);
-  parser_->AddOneArgumentFunction("fabs", CppAD::fabs);
-  parser_->AddOneArgumentFunction("log", CppAD::log);
-  parser_->AddOneArgumentFunction("log10", CppAD::log10);
-  parser_->AddOneArgumentFunction("sin", CppAD::sin);
-  parser_->AddOneArgumentFunction("sinh", CppAD::sinh);
-  parser_->AddOneArgumentFunction("sqrt", CppAD::sqrt);
-  parser_->AddOneArgumentFunction("tan", CppAD::tan);
-  parser_->AddOneArgumentFunction("tanh", CppAD::tanh);
+  functions_["abs"] = CppAD::abs;
+  functions_["acos"] = CppAD::acos;
+  functions_["asin"] = CppAD::asin;
+  functions_["atan"] = CppAD::atan;
+  functions_["cos"] = CppAD::cos;
+  functions_["cosh"] = CppAD::cosh;
+  functions_["exp"] = CppAD::exp;
+  functions_["fabs"] = CppAD::fabs;
+  functions_["log"] = CppAD::log;
+  functions_["log10"] = CppAD::log10;
+  functions_["sin"] = CppAD::sin;
+  functions_["sinh"] = CppAD::sinh;
+  functions_["sqrt"] = CppAD::sqrt;
+  functions_["tan"] = CppAD::tan;
+  functions_["tanh"] = CppAD::tanh;
 
 #else
-  parser_ = new Parser<Double, Double, Double>(this);
-
-  parser_->AddOneArgumentFunction("abs", fabs);
-  parser_->AddOneArgumentFunction("acos", acos);
-  parser_->AddOneArgumentFunction("asin", asin);
-  parser_->AddOneArgumentFunction("atan", atan);
-  parser_->AddOneArgumentFunction("ceil", ceil);
-  parser_->AddOneArgumentFunction("cos", cos);
-  parser_->AddOneArgumentFunction("cosh", cosh);
-  parser_->AddOneArgumentFunction("exp", exp);
-  parser_->AddOneArgumentFunction("floor", floor);
-  parser_->AddOneArgumentFunction("log", log);
-  parser_->AddOneArgumentFunction("log10", log10);
-  parser_->AddOneArgumentFunction("sin", sin);
-  parser_->AddOneArgumentFunction("sinh", sinh);
-  parser_->AddOneArgumentFunction("sqrt", sqrt);
-  parser_->AddOneArgumentFunction("tan", tan);
-  parser_->AddOneArgumentFunction("tanh", tanh);
+  functions_["abs"] = fabs;
+  functions_["acos"] = acos;
+  functions_["asin"] = asin;
+  functions_["atan"] = atan;
+  functions_["ceil"] = ceil;
+  functions_["cos"] = cos;
+  functions_["cosh"] = cosh;
+  functions_["exp"] = exp;
+  functions_["floor"] = floor;
+  functions_["log"] = log;
+  functions_["log10"] = log10;
+  functions_["sin"] = sin;
+  functions_["sinh"] = sinh;
+  functions_["sqrt"] = sqrt;
+  functions_["tan"] = tan;
+  functions_["tanh"] = tanh;
 #endif
 }
 
-/**
- *
- */
-EquationParser::~EquationParser() {
-  if (parser_ != nullptr)
-    delete parser_;
-}
-
 /**
  * This method will try to find the registered
  * addressable/object that we're looking for
@@ -133,10 +117,25 @@ Double& EquationParser::LookupValue(const std::string& name) {
 
 
 /**
+ * Compile an equation so it can be evaluated many times without
+ * being parsed again. The addressables in the equation are looked up
+ * now so they must exist.
+ *
+ * @param equation The equation to compile
+ * @return The compiled equation
+ */
+shared_ptr<CompiledEquation> EquationParser::Compile(const string& equation) {
+  return CompiledEquation::Compile(equation, this, functions_);
+}
+
+/**
+ * Compile and evaluate an equation
  *
+ * @param equation The equation to evaluate
+ * @return The value of the equation
  */
 Double EquationParser::Parse(string equation) {
-  return parser_->Evaluate(equation);
+  return Compile(equation)->Evaluate();
 }
 
 
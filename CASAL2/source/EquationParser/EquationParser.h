@@ -18,9 +18,11 @@
 #define SOURCE_EQUATIONPARSER_EQUATIONPARSER_H_
 
 // headers
+#include <map>
 #include <string>
 #include <memory>
 
+#include "../EquationParser/CompiledEquation.h"
 #include "../Utilities/NoCopy.h"
 #include "../Utilities/Types.h"
 
@@ -31,6 +33,7 @@ using niwa::utilities::Double;
 // namespaces
 namespace niwa {
 class Model;
+using std::map;
 using std::string;
 using std::shared_ptr;
 
@@ -42,8 +45,9 @@ public:
   // methods
   EquationParser();
   explicit EquationParser(shared_ptr<Model> model);
-  virtual                     ~EquationParser();
+  virtual                     ~EquationParser() = default;
   Double                      Parse(string equation);
+  shared_ptr<CompiledEquation> Compile(const string& equation);
 
   // Callback method for the equation parser to lookup addressables
   Double&                     LookupValue(const std::string& name);
@@ -51,15 +55,7 @@ public:
 private:
     // members
   shared_ptr<Model>                      model_ = nullptr;
-#ifdef USE_ADOLC
-  Parser<adouble, adub, const badouble&>* parser_ = nullptr;
-#elif USE_BETADIFF
-  Parser<adouble, adub, const badouble&>* parser_ = nullptr;
-#elif USE_CPPAD
-  Parser<CppAD::AD<double>, CppAD::AD<double>, const CppAD::AD<double>&>* parser_ = nullptr;
-#else
-  Parser<Double, Double, Double>* parser_ = nullptr;
-#endif
+  map<string, EquationFunction>          functions_;
 
   DISALLOW_COPY_AND_ASSIGN(EquationParser);
 };
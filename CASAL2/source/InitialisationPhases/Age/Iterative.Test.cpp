@@ -0,0 +1,97 @@
+/**
+ * @file Iterative.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "Iterative.h"
+
+#include <boost/algorithm/string/replace.hpp>
+
+#include "../../InitialisationPhases/Manager.h"
+#include "../../Model/Managers.h"
+#include "../../Model/Models/Age.h"
+#include "../../ObjectiveFunction/ObjectiveFunction.h"
+#include "../../TestResources/TestCases/CasalComplex1.h"
+#include "../../TestResources/TestCases/CasalComplex2.h"
+#include "../../TestResources/TestCases/CasalComplex3.h"
+#include "../../TestResources/TestFixtures/InternalEmptyModel.h"
+
+// Namespaces
+namespace niwa {
+namespace initialisationphases {
+namespace age {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * Runs a test case with an Anderson accelerated phase1 and
+ * checks it reaches the same equilibrium, and so the same score,
+ * as running all 200 years of the phase
+ */
+class AcceleratedIterative : public InternalEmptyModel {
+protected:
+  void RunAccelerated(const string& test_case, const string& file_name, double brute_force_score, unsigned expected_years) {
+    string configuration = test_case;
+    boost::replace_first(configuration, "years 200", "years 200\nacceleration anderson\nlambda 1e-12");
+    AddConfigurationLine(configuration, file_name, 31);
+    LoadConfiguration();
+
+    model_->Start(RunMode::kBasic);
+
+    ObjectiveFunction& obj_function = model_->objective_function();
+    EXPECT_NEAR(brute_force_score, obj_function.score(), 1e-4);
+
+    auto phase = dynamic_cast<Iterative*>(model_->managers()->initialisation_phase()->GetInitPhase("phase1"));
+    ASSERT_NE(nullptr, phase);
+    EXPECT_EQ(expected_years, phase->years_executed());
+  }
+};
+
+/**
+ * Ages 2-25 take age_spread() = 24 years to fill. The only
+ * recruitment is at age 3 so age 2 stays empty, but it is
+ * still part of the warm-up. m is 0.1 for both sexes and
+ * fishing is excluded, so both plus groups approach their
+ * equilibrium at the same rate and the first extrapolation
+ * in year 25 solves them. Year 26 is the normal year that
+ * confirms it.
+ */
+TEST_F(AcceleratedIterative, CasalComplex1) {
+  RunAccelerated(testcases::test_cases_casal_complex_1, "CasalComplex1.h", 86017.407059557605, 24 + 2);
+}
+
+/**
+ * Recruitment is at age 2, so all of ages 2-25 fill in the
+ * 24 year warm-up. The von Bertalanffy age lengths are
+ * defined before the phase but do not change the numbers at
+ * age, and m is again 0.1 for both sexes with fishing
+ * excluded, so one extrapolation in year 25 and a confirming
+ * year 26.
+ */
+TEST_F(AcceleratedIterative, CasalComplex2) {
+  RunAccelerated(testcases::test_cases_casal_complex_2, "CasalComplex2.h", 1390.2881519679252, 24 + 2);
+}
+
+/**
+ * The same population as CasalComplex2. The age lengths add a
+ * cv and are by length, which changes the observations but not
+ * the numbers at age. The ages are 2-25 and m is 0.1 for both
+ * sexes, so 24 warm-up years, one extrapolation in year 25 and
+ * a confirming year 26.
+ */
+TEST_F(AcceleratedIterative, CasalComplex3) {
+  RunAccelerated(testcases::test_cases_casal_complex_3, "CasalComplex3.h", 1561.2164727890545, 24 + 2);
+}
+
+} /* namespace age */
+} /* namespace initialisationphases */
+} /* namespace niwa */
+
+#endif /* TESTMODE */
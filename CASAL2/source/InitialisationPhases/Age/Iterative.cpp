@@ -44,6 +44,8 @@ Iterative::Iterative(shared_ptr<Model> model)
   parameters_.Bind<string>(PARAM_EXCLUDE_PROCESSES, &exclude_processes_, "Processes in the annual cycle to be excluded from this initialisation phase", "", true);
   parameters_.Bind<unsigned>(PARAM_CONVERGENCE_YEARS, &convergence_years_, "The iteration (year) when the test for converegence (lambda) is evaluated", "", true);
   parameters_.Bind<Double>(PARAM_LAMBDA, &lambda_, "The maximum value of the absolute sum of differences (lambda) between the partition at year-1 and year that indicates successfull convergence", "", Double(0.0));
+  parameters_.Bind<string>(PARAM_ACCELERATION, &acceleration_, "The method used to accelerate convergence to equilibrium. Convergence is checked every year when this is used", "", PARAM_NONE)->set_allowed_values({PARAM_NONE, PARAM_ANDERSON});
+  parameters_.Bind<bool>(PARAM_WARM_START, &warm_start_, "Start from the equilibrium partition found by the previous run of the model. Convergence is checked every year when this is used. The partition the phase finishes with then depends on the previous run, so the objective function changes by up to lambda between runs with the same parameter values. Use a small lambda with minimisers that difference the objective function. Cannot be used when the model has more than one thread", "", false);
 }
 
 /**
@@ -56,6 +58,23 @@ void Iterative::DoValidate() {
     if (pieces.size() != 2 && pieces.size() != 3)
       LOG_ERROR_P(PARAM_INSERT_PROCESSES) << " value " << insert << " does not match the format time_step(process)=new_process = " << pieces.size();
   }
+
+  if (acceleration_ != PARAM_NONE || warm_start_) {
+    string parameter = acceleration_ != PARAM_NONE ? PARAM_ACCELERATION : PARAM_WARM_START;
+    if (lambda_ <= 0.0)
+      LOG_ERROR_P(PARAM_LAMBDA) << "must be greater than 0 when " << parameter << " is used";
+    if (convergence_years_.size() != 0)
+      LOG_ERROR_P(PARAM_CONVERGENCE_YEARS) << "cannot be used with " << parameter << ". Convergence is checked every year";
+  }
+
+  if (warm_start_ && model_->threads() > 1)
+    LOG_ERROR_P(PARAM_WARM_START) << "cannot be used when the model has more than one thread. Each thread would start from the "
+        << "candidate it happened to run last, so the objective function would change between runs";
+
+#ifdef USE_AUTODIFF
+  if (warm_start_)
+    LOG_ERROR_P(PARAM_WARM_START) << "cannot be used with an auto-differentiation minimiser. The warm started partition does not carry the derivatives of the earlier years";
+#endif
 }
 
 /**
@@ -141,9 +160,18 @@ void Iterative::DoBuild() {
  * Execute our iterative initialisation phases.
  */
 void Iterative::Execute() {
-  if (convergence_years_.size() == 0) {
+  if (acceleration_ != PARAM_NONE || warm_start_) {
+    bool warm_started = warm_start_ && LoadWarmStart();
+    bool converged = ExecuteUntilConverged(warm_started);
+    if (warm_start_ && converged)
+      SaveWarmStart();
+    else if (warm_start_)
+      warm_start_partition_.clear();
+
+  } else if (convergence_years_.size() == 0) {
     timesteps::Manager& time_step_manager = *model_->managers()->time_step();
     time_step_manager.ExecuteInitialisation(label_, years_);
+    years_executed_ = years_;
 
   } else {
     unsigned total_years = 0;
@@ -155,12 +183,14 @@ void Iterative::Execute() {
       total_years += years - (total_years + 1);
       if ((total_years + 1) >= years_) {
         time_step_manager.ExecuteInitialisation(label_, 1);
+        years_executed_ = total_years + 1;
         break;
       }
 
       cached_partition_.BuildCache();
       time_step_manager.ExecuteInitialisation(label_, 1);
       ++total_years;
+      years_executed_ = total_years;
 
       if (CheckConvergence()) {
         LOG_FINEST() << " year Convergence was reached = " << years;
@@ -196,6 +226,107 @@ void Iterative::Execute() {
   }
 }
 
+/**
+ * Execute the annual cycle until the partition converges, checking for
+ * convergence every year. If we have an acceleration the partition is
+ * extrapolated between years with it.
+ *
+ * The extrapolation starts once every age has been filled by recruitment so
+ * only the slow plus group has to be solved for. When we have been warm started
+ * every age is already filled so it starts straight away. Convergence is checked
+ * after a normal year of the annual cycle so the partition we finish with, and
+ * the derived quantities calculated from it, come from the model and not from
+ * an extrapolation.
+ *
+ * @param warm_started True if the partition was loaded from a previous run
+ * @return True if the partition converged
+ */
+bool Iterative::ExecuteUntilConverged(bool warm_started) {
+  timesteps::Manager& time_step_manager = *model_->managers()->time_step();
+  unsigned warm_up_years = warm_started ? 1 : model_->age_spread();
+  anderson_.Reset();
+
+  for (unsigned year = 1; year <= years_; ++year) {
+    cached_partition_.BuildCache();
+    time_step_manager.ExecuteInitialisation(label_, 1);
+
+    years_executed_ = year;
+    if (CheckConvergence()) {
+      LOG_FINE() << "initialisation phase " << label_ << " converged after " << year << " years";
+      return true;
+    }
+    if (acceleration_ != PARAM_ANDERSON || year == years_ || year < warm_up_years)
+      continue;
+
+    acceleration_input_.clear();
+    acceleration_output_.clear();
+    auto cached_category = cached_partition_.begin();
+    for (auto category = partition_.begin(); category != partition_.end(); ++cached_category, ++category) {
+      acceleration_input_.insert(acceleration_input_.end(), (*cached_category).data_.begin(), (*cached_category).data_.end());
+      acceleration_output_.insert(acceleration_output_.end(), (*category)->data_.begin(), (*category)->data_.end());
+    }
+
+    if (!anderson_.Update(acceleration_input_, acceleration_output_))
+      continue;
+
+    unsigned index = 0;
+    for (auto category : partition_) {
+      for (Double& value : category->data_)
+        value = acceleration_output_[index++];
+    }
+  }
+
+  LOG_FINE() << "initialisation phase " << label_ << " did not converge in " << years_ << " years";
+  return false;
+}
+
+/**
+ * Load the partition saved by the previous run of the model if it converged.
+ * The previous run is usually the last candidate tried by the minimiser or MCMC,
+ * so its equilibrium is close to ours and the phase converges in far fewer years.
+ *
+ * The phase still runs until the change over a year is less than lambda, so the
+ * partition we finish with is only the same as a run from an empty partition to
+ * within lambda. It depends on which candidate was run before this one.
+ *
+ * @return True if the partition was loaded
+ */
+bool Iterative::LoadWarmStart() {
+  if (warm_start_partition_.size() != partition_.size())
+    return false;
+
+  unsigned i = 0;
+  for (auto category : partition_) {
+    if (warm_start_partition_[i++].size() != category->data_.size())
+      return false;
+  }
+
+  i = 0;
+  for (auto category : partition_) {
+    const vector<double>& values = warm_start_partition_[i++];
+    for (unsigned j = 0; j < values.size(); ++j)
+      category->data_[j] = values[j];
+  }
+
+  LOG_FINE() << "initialisation phase " << label_ << " warm started from the previous equilibrium";
+  return true;
+}
+
+/**
+ * Save the partition from the start of the year the phase converged in so the
+ * next run of the model can start from it.
+ */
+void Iterative::SaveWarmStart() {
+  warm_start_partition_.resize(partition_.size());
+  unsigned i = 0;
+  for (auto category = cached_partition_.begin(); category != cached_partition_.end(); ++category) {
+    vector<double>& values = warm_start_partition_[i++];
+    values.resize((*category).data_.size());
+    for (unsigned j = 0; j < values.size(); ++j)
+      values[j] = AS_DOUBLE((*category).data_[j]);
+  }
+}
+
 /**
  * Check for convergence on our partition and return true if it exceeds the
  * lambda threshold so we can quit early and save time.
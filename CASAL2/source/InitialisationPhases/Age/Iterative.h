@@ -20,6 +20,7 @@
 #include "../../InitialisationPhases/InitialisationPhase.h"
 #include "../../Partition/Accessors/Categories.h"
 #include "../../Partition/Accessors/Cached/Categories.h"
+#include "../../Utilities/AndersonAcceleration.h"
 
 // namespaces
 namespace niwa {
@@ -40,11 +41,17 @@ public:
   virtual                     ~Iterative() = default;
   void                        Execute() override final;
 
+  // accessors
+  unsigned                    years_executed() const { return years_executed_; }
+
 protected:
   // methods
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   bool                        CheckConvergence();
+  bool                        ExecuteUntilConverged(bool warm_started);
+  bool                        LoadWarmStart();
+  void                        SaveWarmStart();
 
   // members
   unsigned                    years_;
@@ -53,6 +60,13 @@ protected:
   vector<TimeStep*>           time_steps_;
   Double                      lambda_;
   vector<unsigned>            convergence_years_;
+  string                      acceleration_ = PARAM_NONE;
+  utilities::AndersonAcceleration anderson_;
+  vector<Double>              acceleration_input_;
+  vector<Double>              acceleration_output_;
+  unsigned                    years_executed_ = 0;
+  bool                        warm_start_ = false;
+  vector<vector<double>>      warm_start_partition_; // [category][age]
   cached::Categories          cached_partition_;
   accessor::Categories        partition_;
 
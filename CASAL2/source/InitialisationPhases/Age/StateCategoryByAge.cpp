@@ -68,7 +68,7 @@ void StateCategoryByAge::DoValidate() {
   /**
    * Convert the string values to doubles and load them in to a table.
    */
-  vector<vector<string>>& data = n_table_->data();
+  const vector<vector<string>>& data = n_table_->data();
   unsigned row_number = 1;
   for (auto row : data) {
     if (row.size() != column_count_)
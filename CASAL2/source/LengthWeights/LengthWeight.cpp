@@ -35,4 +35,26 @@ void LengthWeight::Validate() {
   DoValidate();
 }
 
+/**
+ * Reset the length weight. If one of our parameters has changed since the last
+ * reset the age lengths using us are notified so they rebuild their mean weights.
+ */
+void LengthWeight::Reset() {
+  vector<Double> inputs;
+  for (auto addressable : addressables_)
+    inputs.push_back(*addressable.second);
+#ifdef USE_AUTODIFF
+  bool changed = true;
+#else
+  bool changed = inputs != reset_inputs_;
+#endif
+  reset_inputs_ = inputs;
+
+  if (changed) {
+    ++revision_;
+    NotifySubscribers();
+  }
+  DoReset();
+}
+
 } /* namespace niwa */
@@ -32,7 +32,8 @@ public:
   virtual                     ~LengthWeight() { };
   void                        Validate();
   void                        Build() { DoBuild(); };
-  void                        Reset() { DoReset(); };
+  void                        Reset();
+  void                        RebuildCache() override { ++revision_; };
 
   virtual void                DoValidate() = 0;
   virtual void                DoBuild() = 0;
@@ -40,8 +41,14 @@ public:
 
   // accessors
   virtual Double              mean_weight(Double size, Distribution distribution, Double cv) const = 0;
+  unsigned                    revision() const { return revision_; }
   // members
   shared_ptr<Model>                      model_ = nullptr;
+
+protected:
+  // members
+  unsigned                    revision_ = 0; // incremented every time the values we return may have changed
+  vector<Double>              reset_inputs_; // values of our addressables at the last reset
 };
 } /* namespace niwa */
 #endif /* LENGTHWEIGHT_H_ */
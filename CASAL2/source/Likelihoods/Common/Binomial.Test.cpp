@@ -19,6 +19,7 @@
 #include "../../Likelihoods/Common/Binomial.h"
 #include "../../Likelihoods/Factory.h"
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // namespaces
@@ -28,6 +29,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, Binomial) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -91,28 +93,33 @@ TEST(Likelihood, Binomial) {
   comparison.process_error_   = 15;
   comparison_list[0].push_back(comparison);
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(columns, 0));
 
   // Check scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ( 1.687807099701715, comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ( 3.522307801439243, comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ( 7.503894929001944, comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ(13.002265158969662, comparison_list[0][3].score_);
-  EXPECT_DOUBLE_EQ(20.091017458126572, comparison_list[0][4].score_);
-  EXPECT_DOUBLE_EQ( 3.939720847325895, comparison_list[0][5].score_);
-  EXPECT_DOUBLE_EQ( 5.256187812442846, comparison_list[0][6].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ( 1.687807099701715, columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ( 3.522307801439243, columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ( 7.503894929001944, columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ(13.002265158969662, columns[0].score_[3]);
+  EXPECT_DOUBLE_EQ(20.091017458126572, columns[0].score_[4]);
+  EXPECT_DOUBLE_EQ( 3.939720847325895, columns[0].score_[5]);
+  EXPECT_DOUBLE_EQ( 5.256187812442846, columns[0].score_[6]);
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(0.14000000000000001, comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(0.28000000000000003, comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(0.26000000000000001, comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(0.5,                 comparison_list[0][3].observed_);
-  EXPECT_DOUBLE_EQ(0.47999999999999998, comparison_list[0][4].observed_);
-  EXPECT_DOUBLE_EQ(0.1111111111111111,  comparison_list[0][5].observed_);
-  EXPECT_DOUBLE_EQ(0.41666666666666669, comparison_list[0][6].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(0.14000000000000001, columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(0.28000000000000003, columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(0.26000000000000001, columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(0.5,                 columns[0].observed_[3]);
+  EXPECT_DOUBLE_EQ(0.47999999999999998, columns[0].observed_[4]);
+  EXPECT_DOUBLE_EQ(0.1111111111111111,  columns[0].observed_[5]);
+  EXPECT_DOUBLE_EQ(0.41666666666666669, columns[0].observed_[6]);
 }
 
 } /* namespace likelihoods */
@@ -36,29 +36,39 @@ Double Binomial::AdjustErrorValue(const Double process_error, const Double error
 }
 
 /**
- * Get our scores from the likelihood
- *
- * @param comparisons A collection of comparisons passed by the observation
+ * Calculate the binomial score for a year of comparisons. Comparisons
+ * with an error value of 0 do not contribute to the score.
  *
+ * @param columns The comparisons for the year
  */
-void Binomial::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-      if (error_value == 0.0) {
-        comparison.adjusted_error_ = error_value;
-        comparison.score_ = 0.0;
-      } else {
-        Double score = math::LnFactorial(error_value)
-                        - math::LnFactorial(error_value * (1.0 - comparison.observed_))
-                        - math::LnFactorial(error_value * comparison.observed_)
-                        + error_value * comparison.observed_ * log(math::ZeroFun(comparison.expected_, comparison.delta_))
-                        + error_value * (1.0 - comparison.observed_) * log(math::ZeroFun(1.0 - comparison.expected_, comparison.delta_));
+void Binomial::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
 
-        comparison.adjusted_error_ = error_value;
-        comparison.score_ = -score * multiplier_;
-      }
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
+
+  for (unsigned i = 0; i < count; ++i) {
+    Double n = adjusted_error[i];
+    if (n == 0.0) {
+      score[i] = 0.0;
+      continue;
     }
+
+    Double value = math::LnFactorial(n)
+                   - math::LnFactorial(n * (1.0 - observed[i]))
+                   - math::LnFactorial(n * observed[i])
+                   + n * observed[i] * log(math::ZeroFun(expected[i], delta[i]))
+                   + n * (1.0 - observed[i]) * log(math::ZeroFun(1.0 - expected[i], delta[i]));
+    score[i] = -value * multiplier;
   }
 }
 
@@ -67,22 +77,23 @@ void Binomial::GetScores(map<unsigned, vector<observations::Comparison> >& compa
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void Binomial::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void Binomial::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      error_value = ceil(AS_DOUBLE(AdjustErrorValue(comparison.process_error_, comparison.error_value_)));
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      error_value = ceil(AS_DOUBLE(AdjustErrorValue(columns.process_error_[i], columns.error_value_[i])));
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = 0.0;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = 0.0;
       else
-        comparison.observed_ = rng.binomial(AS_DOUBLE(comparison.expected_), AS_DOUBLE(error_value)) / error_value;
+        columns.observed_[i] = rng.binomial(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE(error_value)) / error_value;
 
-      comparison.adjusted_error_ = error_value;
+      columns.adjusted_error_[i] = error_value;
     }
   }
 }
@@ -18,6 +18,7 @@
 
 #include "../../Likelihoods/Factory.h"
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // namespaces
@@ -27,6 +28,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, BinomialApprox) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -90,28 +92,33 @@ TEST(Likelihood, BinomialApprox) {
   comparison.process_error_   = 15;
   comparison_list[0].push_back(comparison);
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(columns, 0));
 
   // Check scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ(-3.159984307040009,   comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ(-1.309802234588228,   comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ( 2.025569385058355,   comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ( 6.705430319465856,   comparison_list[0][3].score_);
-  EXPECT_DOUBLE_EQ(13.350841316725985,   comparison_list[0][4].score_);
-  EXPECT_DOUBLE_EQ( 0.91338771800667584, comparison_list[0][5].score_);
-  EXPECT_DOUBLE_EQ( 1.776317543430387,   comparison_list[0][6].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ(-3.159984307040009,   columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ(-1.309802234588228,   columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ( 2.025569385058355,   columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ( 6.705430319465856,   columns[0].score_[3]);
+  EXPECT_DOUBLE_EQ(13.350841316725985,   columns[0].score_[4]);
+  EXPECT_DOUBLE_EQ( 0.91338771800667584, columns[0].score_[5]);
+  EXPECT_DOUBLE_EQ( 1.776317543430387,   columns[0].score_[6]);
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(0.140000000000000, comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(0.28000000000000003, comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(0.26000000000000001, comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(0.5,                 comparison_list[0][3].observed_);
-  EXPECT_DOUBLE_EQ(0.47999999999999998, comparison_list[0][4].observed_);
-  EXPECT_DOUBLE_EQ(0.1111111111111111,  comparison_list[0][5].observed_);
-  EXPECT_DOUBLE_EQ(0.41666666666666669, comparison_list[0][6].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(0.140000000000000, columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(0.28000000000000003, columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(0.26000000000000001, columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(0.5,                 columns[0].observed_[3]);
+  EXPECT_DOUBLE_EQ(0.47999999999999998, columns[0].observed_[4]);
+  EXPECT_DOUBLE_EQ(0.1111111111111111,  columns[0].observed_[5]);
+  EXPECT_DOUBLE_EQ(0.41666666666666669, columns[0].observed_[6]);
 }
 
 } /* namespace likelihoods */
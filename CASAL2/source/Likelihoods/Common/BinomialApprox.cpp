@@ -40,23 +40,28 @@ Double BinomialApprox::AdjustErrorValue(const Double process_error, const Double
 }
 
 /**
- * Get the result from our likelihood
+ * Calculate the approximate binomial score for a year of comparisons
  *
- * @param comparisons A collection of comparisons passed by the observation
+ * @param columns The comparisons for the year
  */
-void BinomialApprox::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-
-      Double std_error = sqrt((math::ZeroFun(comparison.expected_, comparison.delta_)
-                          * math::ZeroFun(1.0 - comparison.expected_, comparison.delta_)) / error_value);
-
-      Double score = log(std_error) + 0.5 * pow((comparison.observed_ - comparison.expected_) / std_error, 2.0);
-      comparison.adjusted_error_ = error_value;
-
-      comparison.score_ = score * multiplier_;
-    }
+void BinomialApprox::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
+
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
+
+  for (unsigned i = 0; i < count; ++i) {
+    Double std_error = sqrt((math::ZeroFun(expected[i], delta[i]) * math::ZeroFun(1.0 - expected[i], delta[i])) / adjusted_error[i]);
+    score[i] = (log(std_error) + 0.5 * pow((observed[i] - expected[i]) / std_error, 2.0)) * multiplier;
   }
 }
 
@@ -65,22 +70,23 @@ void BinomialApprox::GetScores(map<unsigned, vector<observations::Comparison> >&
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void BinomialApprox::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void BinomialApprox::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      error_value = ceil(AS_DOUBLE(AdjustErrorValue(comparison.process_error_, comparison.error_value_)));
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      error_value = ceil(AS_DOUBLE(AdjustErrorValue(columns.process_error_[i], columns.error_value_[i])));
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = 0.0;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = 0.0;
       else
-        comparison.observed_ = rng.binomial(AS_DOUBLE(comparison.expected_), AS_DOUBLE(error_value)) / error_value;
+        columns.observed_[i] = rng.binomial(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE(error_value)) / error_value;
 
-      comparison.adjusted_error_ = error_value;
+      columns.adjusted_error_[i] = error_value;
     }
   }
 }
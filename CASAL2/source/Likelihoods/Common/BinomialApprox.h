@@ -33,8 +33,11 @@ public:
   virtual                     ~BinomialApprox() = default;
   void                        DoValidate() override final { };
   Double                      AdjustErrorValue(const Double process_error, const Double error_value) override final;
-  void                        GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
-  void                        SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
+  void                        SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) override final;
+
+protected:
+  // methods
+  void                        CalculateScores(observations::ComparisonColumns& columns) override final;
 };
 
 } /* namespace likelihoods */
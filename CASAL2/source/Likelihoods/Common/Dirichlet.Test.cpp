@@ -12,6 +12,7 @@
 #include <gtest/gtest.h>
 
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // Namespaces
@@ -21,6 +22,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, Dirichlet) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -94,29 +96,34 @@ TEST(Likelihood, Dirichlet) {
   comparison.delta_           = 1e-5;
   comparison_list[0].push_back(comparison);
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(-269.29109765110968, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(-269.29109765110968, likelihood.GetInitialScore(columns, 0));
 
   // Check Scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ(  8.723231274827508, comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ( 25.278476730160975, comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ( 44.599342238420959, comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ( 65.679477048487513, comparison_list[0][3].score_);
-  EXPECT_DOUBLE_EQ(  1.659118968284150, comparison_list[0][4].score_);
-  EXPECT_DOUBLE_EQ(  1.050921306121904, comparison_list[0][5].score_);
-  EXPECT_DOUBLE_EQ(110.046771629987430, comparison_list[0][6].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ(  8.723231274827508, columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ( 25.278476730160975, columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ( 44.599342238420959, columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ( 65.679477048487513, columns[0].score_[3]);
+  EXPECT_DOUBLE_EQ(  1.659118968284150, columns[0].score_[4]);
+  EXPECT_DOUBLE_EQ(  1.050921306121904, columns[0].score_[5]);
+  EXPECT_DOUBLE_EQ(110.046771629987430, columns[0].score_[6]);
 
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(0.06310697719429153,   comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(0.15200180984615036,   comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(0.47011274483757398,   comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(0.31477846812198418,   comparison_list[0][3].observed_);
-  EXPECT_DOUBLE_EQ(0.41445498365152816,   comparison_list[0][4].observed_);
-  EXPECT_DOUBLE_EQ(0.58554501634847189,   comparison_list[0][5].observed_);
-  EXPECT_DOUBLE_EQ(1.00000000000000000,   comparison_list[0][6].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(0.06310697719429153,   columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(0.15200180984615036,   columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(0.47011274483757398,   columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(0.31477846812198418,   columns[0].observed_[3]);
+  EXPECT_DOUBLE_EQ(0.41445498365152816,   columns[0].observed_[4]);
+  EXPECT_DOUBLE_EQ(0.58554501634847189,   columns[0].observed_[5]);
+  EXPECT_DOUBLE_EQ(1.00000000000000000,   columns[0].observed_[6]);
 }
 
 }
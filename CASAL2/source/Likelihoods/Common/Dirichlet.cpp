@@ -41,21 +41,29 @@ Double Dirichlet::AdjustErrorValue(const Double process_error, const Double erro
 
 
 
-/*
-* Get the result from our likelihood for the observation
-* @param comparisons A collection of comparisons passed by the observation
-*/
-
-void Dirichlet::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-      Double alpha = math::ZeroFun(comparison.expected_,comparison.delta_) * error_value;
-      Double a2_a3 = math::LnGamma(alpha) - ((alpha - 1.0) * log(math::ZeroFun(comparison.observed_,comparison.delta_)));
-
-      comparison.adjusted_error_ = error_value;
-      comparison.score_ = a2_a3 * multiplier_;
-    }
+/**
+ * Calculate the dirichlet score for a year of comparisons
+ *
+ * @param columns The comparisons for the year
+ */
+void Dirichlet::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
+
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
+
+  for (unsigned i = 0; i < count; ++i) {
+    Double alpha = math::ZeroFun(expected[i], delta[i]) * adjusted_error[i];
+    score[i] = (math::LnGamma(alpha) - ((alpha - 1.0) * log(math::ZeroFun(observed[i], delta[i])))) * multiplier;
   }
 }
 
@@ -66,27 +74,33 @@ void Dirichlet::GetScores(map<unsigned, vector<observations::Comparison> >& comp
  * @param comparisons A collection of comparisons passed by the observation
  */
 
-void Dirichlet::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
+void Dirichlet::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
   // instance the random number generator
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-  map<string, Double> totals;
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
+  vector<Double> totals;
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_);
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = 0.0;
+    observations::ComparisonColumns& columns = iterator->second;
+    unsigned category_count = 0;
+    for (unsigned category : columns.category_)
+      category_count = std::max(category_count, category + 1);
+    totals.assign(category_count, 0.0);
+
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      Double error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]);
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = 0.0;
       else
-        comparison.observed_ = rng.gamma(AS_DOUBLE(comparison.expected_) * AS_DOUBLE(error_value));
+        columns.observed_[i] = rng.gamma(AS_DOUBLE(columns.expected_[i]) * AS_DOUBLE(error_value));
 
-      totals[comparison.category_] += comparison.observed_;
-      comparison.adjusted_error_ = error_value;
+      totals[columns.category_[i]] += columns.observed_[i];
+      columns.adjusted_error_[i] = error_value;
     }
 
-    for (observations::Comparison& comparison : iterator->second)
-      comparison.observed_ /= totals[comparison.category_];
+    for (unsigned i = 0; i < columns.size(); ++i)
+      columns.observed_[i] /= totals[columns.category_[i]];
   }
 }
 
@@ -96,15 +110,16 @@ void Dirichlet::SimulateObserved(map<unsigned, vector<observations::Comparison>
  * @param comparisons A collection of comparisons passed by the observation
  */
 
-Double Dirichlet::GetInitialScore(map<unsigned, vector<observations::Comparison> >& comparisons,unsigned year) {
+Double Dirichlet::GetInitialScore(map<unsigned, observations::ComparisonColumns>& comparisons,unsigned year) {
   Double score = 0.0;
   Double a1 = 0.0;
 
-  for (observations::Comparison& comparison : comparisons[year]) {
+  observations::ComparisonColumns& columns = comparisons[year];
+  for (unsigned i = 0; i < columns.size(); ++i) {
     // Calculate score
-    Double temp_score = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-    LOG_FINEST() << "Adding: " << temp_score << " = AdjustErrorValue(" << comparison.process_error_ << ", " << comparison.error_value_ << ")  * " << error_value_multiplier_ << ")";
-    a1 += math::ZeroFun(comparison.expected_, comparison.delta_) * temp_score;
+    Double temp_score = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]) * error_value_multiplier_;
+    LOG_FINEST() << "Adding: " << temp_score << " = AdjustErrorValue(" << columns.process_error_[i] << ", " << columns.error_value_[i] << ")  * " << error_value_multiplier_ << ")";
+    a1 += math::ZeroFun(columns.expected_[i], columns.delta_[i]) * temp_score;
   }
 
   score  = -math::LnGamma(a1);
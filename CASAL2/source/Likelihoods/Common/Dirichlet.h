@@ -28,9 +28,12 @@ public:
   virtual                     ~Dirichlet() = default;
   void                        DoValidate() override final { };
   Double                      AdjustErrorValue(const Double process_error, const Double error_value) override final;
-  void                        SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
-  Double                      GetInitialScore(map<unsigned, vector<observations::Comparison> >& comparisons, unsigned year) override final;
-  void                        GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
+  void                        SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) override final;
+  Double                      GetInitialScore(map<unsigned, observations::ComparisonColumns>& comparisons, unsigned year) override final;
+
+protected:
+  // methods
+  void                        CalculateScores(observations::ComparisonColumns& columns) override final;
 };
 
 } /* namespace likelihoods */
@@ -18,6 +18,7 @@
 
 #include "../../Likelihoods/Factory.h"
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // namespaces
@@ -27,6 +28,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, LogNormal) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -60,30 +62,35 @@ TEST(Likelihood, LogNormal) {
     comparison_list[0].push_back(comparison);
   }
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(columns, 0));
 
   // Check scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ(-9.2103403762649183,  comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ(-9.2103403762649183,  comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ(-9.2103403762649183,  comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ(-9.2103403762649183,  comparison_list[0][3].score_);
-  EXPECT_DOUBLE_EQ(-0.72207704946548157, comparison_list[0][4].score_);
-  EXPECT_DOUBLE_EQ(-0.72207704946548157, comparison_list[0][5].score_);
-  EXPECT_DOUBLE_EQ(-0.72207704946548157, comparison_list[0][6].score_);
-  EXPECT_DOUBLE_EQ(-0.72207704946548157, comparison_list[0][7].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ(-9.2103403762649183,  columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ(-9.2103403762649183,  columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ(-9.2103403762649183,  columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ(-9.2103403762649183,  columns[0].score_[3]);
+  EXPECT_DOUBLE_EQ(-0.72207704946548157, columns[0].score_[4]);
+  EXPECT_DOUBLE_EQ(-0.72207704946548157, columns[0].score_[5]);
+  EXPECT_DOUBLE_EQ(-0.72207704946548157, columns[0].score_[6]);
+  EXPECT_DOUBLE_EQ(-0.72207704946548157, columns[0].score_[7]);
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(0.25001151803908866,   comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(0.25007450179597446,  comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(0.24998621490767847, comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(0.24998315947676214, comparison_list[0][3].observed_);
-  EXPECT_DOUBLE_EQ(0.077455283489012747, comparison_list[0][4].observed_);
-  EXPECT_DOUBLE_EQ(0.18175128229123977, comparison_list[0][5].observed_);
-  EXPECT_DOUBLE_EQ(0.18460806280874451, comparison_list[0][6].observed_);
-  EXPECT_DOUBLE_EQ(0.45561177771504574, comparison_list[0][7].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(0.25001151803908866,   columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(0.25007450179597446,  columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(0.24998621490767847, columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(0.24998315947676214, columns[0].observed_[3]);
+  EXPECT_DOUBLE_EQ(0.077455283489012747, columns[0].observed_[4]);
+  EXPECT_DOUBLE_EQ(0.18175128229123977, columns[0].observed_[5]);
+  EXPECT_DOUBLE_EQ(0.18460806280874451, columns[0].observed_[6]);
+  EXPECT_DOUBLE_EQ(0.45561177771504574, columns[0].observed_[7]);
 }
 
 } /* namespace likelihoods */
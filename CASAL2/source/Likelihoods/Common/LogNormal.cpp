@@ -39,22 +39,29 @@ Double LogNormal::AdjustErrorValue(const Double process_error, const Double erro
 }
 
 /**
- * Get the result from our likelihood
+ * Calculate the lognormal score for a year of comparisons
  *
- * @param comparisons A collection of comparisons passed by the observation
+ * @param columns The comparisons for the year
  */
-void LogNormal::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+void LogNormal::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
 
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-      Double sigma = sqrt(log(1 + error_value * error_value));
-      Double score = log(comparison.observed_ / math::ZeroFun(comparison.expected_, comparison.delta_)) / sigma + 0.5 * sigma;
-      Double final_score = log(sigma) + 0.5 * (score * score);
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
 
-      comparison.adjusted_error_ = error_value;
-      comparison.score_ = final_score * multiplier_;
-    }
+  for (unsigned i = 0; i < count; ++i) {
+    Double sigma = sqrt(log(1 + adjusted_error[i] * adjusted_error[i]));
+    Double z     = log(observed[i] / math::ZeroFun(expected[i], delta[i])) / sigma + 0.5 * sigma;
+    score[i] = (log(sigma) + 0.5 * (z * z)) * multiplier;
   }
 }
 
@@ -63,24 +70,25 @@ void LogNormal::GetScores(map<unsigned, vector<observations::Comparison> >& comp
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void LogNormal::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void LogNormal::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_);
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      Double error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]);
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = comparison.delta_;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = columns.delta_[i];
       else {
-        LOG_FINEST() << "expected = " << comparison.expected_;
-        comparison.observed_ = rng.lognormal(AS_DOUBLE(comparison.expected_), AS_DOUBLE(error_value));
-        LOG_FINEST() << "Simulated = " << comparison.observed_;
+        LOG_FINEST() << "expected = " << columns.expected_[i];
+        columns.observed_[i] = rng.lognormal(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE(error_value));
+        LOG_FINEST() << "Simulated = " << columns.observed_[i];
 
       }
-      comparison.adjusted_error_ = error_value;
+      columns.adjusted_error_[i] = error_value;
     }
   }
 }
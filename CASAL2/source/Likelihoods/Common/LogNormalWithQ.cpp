@@ -44,17 +44,18 @@ Double LogNormalWithQ::AdjustErrorValue(const Double process_error, const Double
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void LogNormalWithQ::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
+void LogNormalWithQ::GetScores(map<unsigned, observations::ComparisonColumns>& comparisons) {
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+    observations::ComparisonColumns& columns = year_iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
 
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
+      Double error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]) * error_value_multiplier_;
       Double sigma = sqrt(log(1 + error_value * error_value));
-      Double score = log(comparison.observed_ / math::ZeroFun(comparison.expected_, comparison.delta_)) / sigma + 0.5 * sigma;
+      Double score = log(columns.observed_[i] / math::ZeroFun(columns.expected_[i], columns.delta_[i])) / sigma + 0.5 * sigma;
       score = log(sigma) + 0.5 * (score * score);
 
-      comparison.adjusted_error_ = error_value;
-      comparison.score_ = score * multiplier_;
+      columns.adjusted_error_[i] = error_value;
+      columns.score_[i] = score * multiplier_;
     }
   }
 }
@@ -64,22 +65,23 @@ void LogNormalWithQ::GetScores(map<unsigned, vector<observations::Comparison> >&
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void LogNormalWithQ::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void LogNormalWithQ::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_);
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]);
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = comparison.delta_;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = columns.delta_[i];
       else
-        comparison.observed_ = rng.lognormal(AS_DOUBLE(comparison.expected_), AS_DOUBLE(error_value));
+        columns.observed_[i] = rng.lognormal(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE(error_value));
 
-      comparison.adjusted_error_ = error_value;
+      columns.adjusted_error_[i] = error_value;
     }
   }
 }
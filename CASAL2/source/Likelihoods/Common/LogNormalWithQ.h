@@ -33,8 +33,8 @@ public:
   virtual                     ~LogNormalWithQ() = default;
   void                        DoValidate() override final { };
   Double                      AdjustErrorValue(const Double process_error, const Double error_value) override final;
-  void                        GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
-  void                        SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) override final;
+  void                        GetScores(map<unsigned, observations::ComparisonColumns>& comparisons) override final;
+  void                        SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) override final;
 };
 
 } /* namespace likelihoods */
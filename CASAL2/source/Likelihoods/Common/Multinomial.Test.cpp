@@ -18,6 +18,7 @@
 
 #include "../../Likelihoods/Factory.h"
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // Namespaces
@@ -27,6 +28,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, Multinomial) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -90,28 +92,33 @@ TEST(Likelihood, Multinomial) {
   comparison.process_error_   = 15;
   comparison_list[0].push_back(comparison);
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(-148.47776695183208, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(-148.47776695183208, likelihood.GetInitialScore(columns, 0));
 
   // Check scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ(16.300417207752272, comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ(12.834681304952547, comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ(10.807355764411724, comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ( 9.368945402152817, comparison_list[0][3].score_);
-  EXPECT_DOUBLE_EQ( 8.253227645581770, comparison_list[0][4].score_);
-  EXPECT_DOUBLE_EQ( 0.516444725003769, comparison_list[0][5].score_);
-  EXPECT_DOUBLE_EQ( 0.872226985105489, comparison_list[0][6].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ(16.300417207752272, columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ(12.834681304952547, columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ(10.807355764411724, columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ( 9.368945402152817, columns[0].score_[3]);
+  EXPECT_DOUBLE_EQ( 8.253227645581770, columns[0].score_[4]);
+  EXPECT_DOUBLE_EQ( 0.516444725003769, columns[0].score_[5]);
+  EXPECT_DOUBLE_EQ( 0.872226985105489, columns[0].score_[6]);
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(7.0,   comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(14.0,  comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(13.0,  comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(25.0,  comparison_list[0][3].observed_);
-  EXPECT_DOUBLE_EQ(24.0,  comparison_list[0][4].observed_);
-  EXPECT_DOUBLE_EQ(1.0,   comparison_list[0][5].observed_);
-  EXPECT_DOUBLE_EQ(5.0,   comparison_list[0][6].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(7.0,   columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(14.0,  columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(13.0,  columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(25.0,  columns[0].observed_[3]);
+  EXPECT_DOUBLE_EQ(24.0,  columns[0].observed_[4]);
+  EXPECT_DOUBLE_EQ(1.0,   columns[0].observed_[5]);
+  EXPECT_DOUBLE_EQ(5.0,   columns[0].observed_[6]);
 }
 
 }
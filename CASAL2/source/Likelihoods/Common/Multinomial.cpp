@@ -41,22 +41,33 @@ Double Multinomial::AdjustErrorValue(const Double process_error, const Double er
 }
 
 /**
+ * Calculate the multinomial score for a year of comparisons
  *
+ * @param columns The comparisons for the year
  */
-void Multinomial::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-
-      Double score = math::LnFactorial(error_value * comparison.observed_)
-                      - error_value * comparison.observed_ * log(math::ZeroFun(comparison.expected_, comparison.delta_));
-
-      comparison.adjusted_error_ = error_value;
-      comparison.score_ = score * multiplier_;
+void Multinomial::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
+
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
+
+  for (unsigned i = 0; i < count; ++i) {
+    score[i] = (math::LnFactorial(adjusted_error[i] * observed[i])
+               - adjusted_error[i] * observed[i] * log(math::ZeroFun(expected[i], delta[i]))) * multiplier;
+  }
 
-			if (isnan(comparison.score_)) {
-				LOG_CODE_ERROR() << "One of the comparison scores came back as NaN... memory bug somewhere";
-			}
+  for (unsigned i = 0; i < count; ++i) {
+    if (isnan(score[i])) {
+      LOG_CODE_ERROR() << "One of the comparison scores came back as NaN... memory bug somewhere";
     }
   }
 }
@@ -67,16 +78,16 @@ void Multinomial::GetScores(map<unsigned, vector<observations::Comparison> >& co
  * @param comparisons A collection of comparisons passed by the observation
  */
 
-Double Multinomial::GetInitialScore(map<unsigned, vector<observations::Comparison> >& comparisons, unsigned year) {
+Double Multinomial::GetInitialScore(map<unsigned, observations::ComparisonColumns>& comparisons, unsigned year) {
   Double score = 0.0;
 
 
  // int stopper = 0;
-  observations::Comparison& comparison = comparisons[year][0];
+  observations::ComparisonColumns& columns = comparisons[year];
     //if (stopper == 1)
     //  break;
-    Double temp_score = -math::LnFactorial(AdjustErrorValue(comparison.process_error_, comparison.error_value_)  * error_value_multiplier_);
-    LOG_FINEST() << "Adding: " << temp_score << " = LnFactorial(AdjustErrorValue(" << comparison.process_error_ << ", " << comparison.error_value_ << ")  * " << error_value_multiplier_ << ")";
+    Double temp_score = -math::LnFactorial(AdjustErrorValue(columns.process_error_[0], columns.error_value_[0])  * error_value_multiplier_);
+    LOG_FINEST() << "Adding: " << temp_score << " = LnFactorial(AdjustErrorValue(" << columns.process_error_[0] << ", " << columns.error_value_[0] << ")  * " << error_value_multiplier_ << ")";
     score += temp_score;
     //stopper += 1;
   //}
@@ -89,24 +100,25 @@ Double Multinomial::GetInitialScore(map<unsigned, vector<observations::Compariso
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void Multinomial::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void Multinomial::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
 
 //    map<string, Double> totals;
-    for (observations::Comparison& comparison : iterator->second) {
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_);
-      comparison.adjusted_error_ = error_value;
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      Double error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]);
+      columns.adjusted_error_[i] = error_value;
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = 0.0;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = 0.0;
       else {
-        LOG_FINEST() << "expected = " << comparison.expected_;
-        comparison.observed_ = rng.binomial(AS_DOUBLE(comparison.expected_), AS_DOUBLE(error_value));
-        LOG_FINEST() << "Simulated = " << comparison.observed_;
+        LOG_FINEST() << "expected = " << columns.expected_[i];
+        columns.observed_[i] = rng.binomial(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE(error_value));
+        LOG_FINEST() << "Simulated = " << columns.observed_[i];
 
       }
 //      totals[comparison.category_] += comparison.observed_;
@@ -18,6 +18,7 @@
 
 #include "../../Likelihoods/Factory.h"
 #include "../../Observations/Comparison.h"
+#include "../../Observations/ComparisonColumns.h"
 #include "../../Utilities/RandomNumberGenerator.h"
 
 // namespaces
@@ -27,6 +28,7 @@ namespace likelihoods {
 using std::cout;
 using std::endl;
 using observations::Comparison;
+using observations::ComparisonColumns;
 
 TEST(Likelihood, Normal) {
   utilities::RandomNumberGenerator::Instance().Reset(31373u);
@@ -70,22 +72,27 @@ TEST(Likelihood, Normal) {
   comparison.process_error_   = 0.20;
   comparison_list[0].push_back(comparison);
 
+  // Load the comparisons in to columns the way an observation saves them
+  map<unsigned, ComparisonColumns> columns;
+  vector<string> category_labels;
+  columns[0].Load(comparison_list[0], category_labels);
+
   // Check initial score
-  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(comparison_list, 0));
+  EXPECT_DOUBLE_EQ(0.0, likelihood.GetInitialScore(columns, 0));
 
   // Check scores
-  likelihood.GetScores(comparison_list);
-  EXPECT_DOUBLE_EQ(12.828313737302302,   comparison_list[0][0].score_);
-  EXPECT_DOUBLE_EQ( 9.9537106387081593,  comparison_list[0][1].score_);
-  EXPECT_DOUBLE_EQ( 4.8283137373023015,  comparison_list[0][2].score_);
-  EXPECT_DOUBLE_EQ( 5.0756618582203545,  comparison_list[0][3].score_);
+  likelihood.GetScores(columns);
+  EXPECT_DOUBLE_EQ(12.828313737302302,   columns[0].score_[0]);
+  EXPECT_DOUBLE_EQ( 9.9537106387081593,  columns[0].score_[1]);
+  EXPECT_DOUBLE_EQ( 4.8283137373023015,  columns[0].score_[2]);
+  EXPECT_DOUBLE_EQ( 5.0756618582203545,  columns[0].score_[3]);
 
   // check simulations
-  likelihood.SimulateObserved(comparison_list);
-  EXPECT_DOUBLE_EQ(557.59511915082294, comparison_list[0][0].observed_);
-  EXPECT_DOUBLE_EQ(976.98119489450221, comparison_list[0][1].observed_);
-  EXPECT_DOUBLE_EQ(431.07888765290096, comparison_list[0][2].observed_);
-  EXPECT_DOUBLE_EQ(392.17240873606607, comparison_list[0][3].observed_);
+  likelihood.SimulateObserved(columns);
+  EXPECT_DOUBLE_EQ(557.59511915082294, columns[0].observed_[0]);
+  EXPECT_DOUBLE_EQ(976.98119489450221, columns[0].observed_[1]);
+  EXPECT_DOUBLE_EQ(431.07888765290096, columns[0].observed_[2]);
+  EXPECT_DOUBLE_EQ(392.17240873606607, columns[0].observed_[3]);
 }
 
 } /* namespace likelihoods */
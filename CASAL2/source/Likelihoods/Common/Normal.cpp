@@ -37,22 +37,29 @@ Double Normal::AdjustErrorValue(const Double process_error, const Double error_v
 }
 
 /**
- * Get the result from our likelihood
+ * Calculate the normal score for a year of comparisons
  *
- * @param comparisons A collection of comparisons passed by the observation
+ * @param columns The comparisons for the year
  */
-void Normal::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+void Normal::CalculateScores(observations::ComparisonColumns& columns) {
+  unsigned      count           = columns.size();
+  const Double* expected        = columns.expected_.data();
+  const Double* observed        = columns.observed_.data();
+  const Double* error_value     = columns.error_value_.data();
+  const Double* process_error   = columns.process_error_.data();
+  const Double* delta           = columns.delta_.data();
+  Double*       adjusted_error  = columns.adjusted_error_.data();
+  Double*       score           = columns.score_.data();
+  Double        error_value_multiplier = error_value_multiplier_;
+  Double        multiplier      = multiplier_;
 
-      Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-      comparison.adjusted_error_ = error_value;
+  for (unsigned i = 0; i < count; ++i)
+    adjusted_error[i] = AdjustErrorValue(process_error[i], error_value[i]) * error_value_multiplier;
 
-      Double sigma = error_value * comparison.expected_;
-      Double score = (comparison.observed_ - comparison.expected_) / math::ZeroFun(error_value * comparison.expected_, comparison.delta_);
-      score = log(sigma) + 0.5 * (score * score);
-      comparison.score_ = score * multiplier_;
-    }
+  for (unsigned i = 0; i < count; ++i) {
+    Double sigma = adjusted_error[i] * expected[i];
+    Double z     = (observed[i] - expected[i]) / math::ZeroFun(sigma, delta[i]);
+    score[i] = (log(sigma) + 0.5 * (z * z)) * multiplier;
   }
 }
 
@@ -61,21 +68,22 @@ void Normal::GetScores(map<unsigned, vector<observations::Comparison> >& compari
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void Normal::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+void Normal::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  utilities::RandomNumberGenerator& rng = Likelihood::rng();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_);
-      comparison.adjusted_error_ = error_value;
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      error_value = AdjustErrorValue(columns.process_error_[i], columns.error_value_[i]);
+      columns.adjusted_error_[i] = error_value;
 
-      if (comparison.expected_ <= 0.0 || error_value <= 0.0)
-        comparison.observed_ = 0.0;
+      if (columns.expected_[i] <= 0.0 || error_value <= 0.0)
+        columns.observed_[i] = 0.0;
       else
-        comparison.observed_ = rng.normal(AS_DOUBLE(comparison.expected_), AS_DOUBLE((comparison.expected_ * error_value)));
+        columns.observed_[i] = rng.normal(AS_DOUBLE(columns.expected_[i]), AS_DOUBLE((columns.expected_[i] * error_value)));
     }
   }
 }
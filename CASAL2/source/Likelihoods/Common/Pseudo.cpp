@@ -33,12 +33,13 @@ Double Pseudo::AdjustErrorValue(const Double process_error, const Double error_v
  *
  * @param comparisons A collection of comparisons passed by the observation
  */
-void Pseudo::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
+void Pseudo::SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) {
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
     LOG_FINE() << "Simulating values for year: " << iterator->first;
-    for (observations::Comparison& comparison : iterator->second) {
-      comparison.observed_ = 0.0;
+    observations::ComparisonColumns& columns = iterator->second;
+    for (unsigned i = 0; i < columns.size(); ++i) {
+      columns.observed_[i] = 0.0;
     }
   }
 }
@@ -13,6 +13,7 @@
 #include "Likelihood.h"
 
 #include "../Model/Model.h"
+#include "../Utilities/RandomNumberGenerator.h"
 
 // namespaces
 namespace niwa {
@@ -32,5 +33,33 @@ void Likelihood::Validate() {
   DoValidate();
 }
 
+/**
+ * Calculate the score for each of the comparisons. Each year of the
+ * observation's columns is handed to the likelihood as a single batch
+ * and the adjusted errors and scores are written back in place.
+ *
+ * @param comparisons A collection of comparisons passed by the observation
+ */
+void Likelihood::GetScores(map<unsigned, observations::ComparisonColumns>& comparisons) {
+  for (auto& year_comparisons : comparisons) {
+    if (year_comparisons.second.size() == 0)
+      continue;
+
+    CalculateScores(year_comparisons.second);
+  }
+}
+
+/**
+ * Return the random number generator to use when simulating
+ * observations. This is the stream belonging to our model so
+ * models on different threads can simulate at the same time.
+ */
+utilities::RandomNumberGenerator& Likelihood::rng() {
+  if (model_ == nullptr)
+    return utilities::RandomNumberGenerator::Instance();
+
+  return model_->rng();
+}
+
 } /* namespace niwa */
 
@@ -18,12 +18,13 @@
 
 // Headers
 #include "../BaseClasses/Object.h"
-#include "../Observations/Comparison.h"
+#include "../Observations/ComparisonColumns.h"
 #include "../Utilities/Types.h"
 
 // Namespaces
 namespace niwa {
 class Model;
+namespace utilities { class RandomNumberGenerator; }
 using niwa::utilities::Double;
 
 /**
@@ -38,9 +39,9 @@ public:
   void                        Build() { };
   void                        Reset() override final { };
   virtual Double              AdjustErrorValue(const Double process_error, const Double error_value) = 0;
-  virtual void                SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) { };
-  virtual Double              GetInitialScore(map<unsigned, vector<observations::Comparison> >& comparisons, unsigned year) { return 0.0; };
-  virtual void                GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) { };
+  virtual void                SimulateObserved(map<unsigned, observations::ComparisonColumns>& comparisons) { };
+  virtual Double              GetInitialScore(map<unsigned, observations::ComparisonColumns>& comparisons, unsigned year) { return 0.0; };
+  virtual void                GetScores(map<unsigned, observations::ComparisonColumns>& comparisons);
   virtual void                DoValidate() { };
 
   // accessors
@@ -49,6 +50,10 @@ public:
   void                        set_type(const string& type) { type_ = type; }
 
 protected:
+  // methods
+  utilities::RandomNumberGenerator& rng();
+  virtual void                CalculateScores(observations::ComparisonColumns& columns) { };
+
   // members
   shared_ptr<Model>                      model_ = nullptr;
   Double                      multiplier_ = 1.0;
@@ -13,6 +13,7 @@
 #include "Logging.h"
 
 #include "../Model/Model.h"
+#include "../Reports/Report.h"
 
 // namespaces
 namespace niwa {
@@ -24,9 +25,9 @@ using std::scoped_lock;
 std::mutex Logging::lock_;
 
 #ifdef TESTMODE
-logger::Severity  Logging::current_log_level_ = logger::Severity::kWarning;
+std::atomic<logger::Severity> Logging::current_log_level_(logger::Severity::kWarning);
 #else
-logger::Severity  Logging::current_log_level_ = logger::Severity::kWarning;
+std::atomic<logger::Severity> Logging::current_log_level_(logger::Severity::kWarning);
 #endif
 
 /**
@@ -36,12 +37,12 @@ Logging::Logging() {
 }
 
 /**
- * Singleton Instance method
+ * Singleton Instance method. The initialisation of a static
+ * local is thread safe so we do not need to lock here.
  *
  * @return static instance of the logging class
  */
 Logging& Logging::Instance() {
-	std::scoped_lock l(lock_);
   static Logging logging;
   return logging;
 }
@@ -62,8 +63,12 @@ void Logging::SetLogLevel(const std::string& log_level) {
     Logging::current_log_level_ = logger::Severity::kMedium;
   else if (log_level != PARAM_NONE) {
     cout << "The log level provided is an invalid log level. " << log_level << " is not supported" << endl;
+    Report::FlushAllFiles();
     exit(-1);
   }
+
+  if (static_cast<int>(Logging::current_log_level_.load()) < CASAL2_MIN_LOG_LEVEL)
+    cout << "This build of CASAL2 does not contain log messages below level " << CASAL2_MIN_LOG_LEVEL << ". Some messages for log level " << log_level << " will not be printed" << endl;
 }
 
 #ifdef TESTMODE
@@ -82,17 +87,32 @@ void Logging::Flush(niwa::logger::Record& record) {
     throw std::string(record.message());
   }
 
-  if (static_cast<int>(record.severity()) >= static_cast<int>(current_log_level_)) {
+  if (record.severity() >= current_log_level_.load()) {
     cerr << record.message();
     cerr.flush();
   }
 }
 #else
+/**
+ * Flush a record. Diagnostic records (below warning) do not take the lock, the
+ * message is built on the calling thread and written to cerr in a single write so
+ * messages from different threads do not mix. Warnings and errors are stored so they
+ * need the lock.
+ */
 void Logging::Flush(niwa::logger::Record& record) {
-	std::scoped_lock l(lock_);
-
   record.BuildMessage();
 
+  if (record.severity() < logger::Severity::kWarning) {
+    if (record.severity() >= current_log_level_.load(std::memory_order_relaxed)) {
+      const string& message = record.message();
+      cerr.write(message.data(), message.size());
+      cerr.flush();
+    }
+    return;
+  }
+
+	std::unique_lock l(lock_);
+
   if (record.severity() == logger::Severity::kWarning)
     warnings_.push_back(record.stream().str());
   else if (record.severity() == logger::Severity::kError)
@@ -103,16 +123,31 @@ void Logging::Flush(niwa::logger::Record& record) {
       cerr << "NOTE: " << errors_.size() << " other errors have been logged above\n";
 
     cerr.flush();
+
+    // Release the lock first as the report thread may log while it holds the report files
+    l.unlock();
+    Report::FlushAllFiles();
     exit(-1);
   }
 
-  if (static_cast<int>(record.severity()) >= static_cast<int>(current_log_level_)) {
+  if (record.severity() >= current_log_level_.load()) {
     cerr << record.message();
     cerr.flush();
   }
 }
 #endif
 
+/**
+ * Get the number of errors that have been logged. This locks so
+ * it can be called while the models on other threads are logging.
+ *
+ * @return The number of errors
+ */
+unsigned Logging::error_count() const {
+	std::scoped_lock l(lock_);
+	return errors_.size();
+}
+
 /**
  *
  */
@@ -16,6 +16,7 @@
 #define SOURCE_LOGGING_LOGGING_H_
 
 // headers
+#include <atomic>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -46,9 +47,10 @@ public:
   // accessors
   std::vector<std::string>&  warnings() { return warnings_; }
   std::vector<std::string>&  errors() { return errors_; }
+  unsigned                   error_count() const;
 
   // static members
-  static logger::Severity     current_log_level_;
+  static std::atomic<logger::Severity> current_log_level_;
   static std::mutex						lock_;
 
 private:
@@ -70,7 +72,20 @@ private:
  * If we're building with TEST defined then we'll blank all of them except LOG_ERROR which
  * will throw an exception
  */
-#define LOG_IF(level) if (level >= Logging::current_log_level_)
+/**
+ * CASAL2_MIN_LOG_LEVEL is the lowest log level compiled in to the application. Any log
+ * statement below it is removed at compile time so it costs nothing, even inside the
+ * inner loops of the model. The values match logger::Severity:
+ * 1 = trace, 2 = finest, 3 = fine, 4 = medium, 5 = warning
+ *
+ * Warnings and errors are never removed.
+ */
+#ifndef CASAL2_MIN_LOG_LEVEL
+#define CASAL2_MIN_LOG_LEVEL 0
+#endif
+
+#define LOG_ENABLED(level) (static_cast<int>(level) >= CASAL2_MIN_LOG_LEVEL || level >= logger::Severity::kWarning)
+#define LOG_IF(level) if constexpr (LOG_ENABLED(level)) if (level >= Logging::current_log_level_.load(std::memory_order_relaxed))
 #define LOG_FOR(level) for(logger::Record r(level, __FILE__, __FUNCTION__, __LINE__); !r.Flush(); Logging::Instance().Flush(r))
 #define LOG_IF_FOR(level) LOG_IF(level) LOG_FOR(level)
 #define LOG_IF_FOR_STREAM(level) LOG_IF_FOR(level) r.stream()
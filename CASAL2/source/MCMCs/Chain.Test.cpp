@@ -0,0 +1,101 @@
+/**
+ * @file Chain.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "Chain.h"
+
+#include <boost/numeric/ublas/matrix.hpp>
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace mcmc {
+
+namespace ublas = boost::numeric::ublas;
+
+/**
+ * Build a link for the chain
+ */
+ChainLink MakeLink(unsigned iteration, vector<Double> values) {
+  ChainLink link;
+  link.iteration_ = iteration;
+  link.values_    = values;
+  return link;
+}
+
+/**
+ * Check the chain only holds the most recent links
+ */
+TEST(Chain, RingBuffer) {
+  Chain chain;
+  chain.set_capacity(3);
+  EXPECT_TRUE(chain.empty());
+
+  for (unsigned i = 1; i <= 5; ++i) {
+    chain.push_back(MakeLink(i, { Double(i) }));
+    EXPECT_EQ(i, chain.back().iteration_);
+  }
+
+  EXPECT_EQ(3u, chain.size());
+  EXPECT_EQ(5u, chain.total());
+  EXPECT_EQ(2u, chain.first_index());
+  for (unsigned i = chain.first_index(); i < chain.total(); ++i)
+    EXPECT_EQ(i + 1, chain.at(i).iteration_);
+
+  chain.clear();
+  EXPECT_TRUE(chain.empty());
+  EXPECT_EQ(0u, chain.size());
+}
+
+/**
+ * Check the running covariance matches the covariance of
+ * every link except the last one
+ */
+TEST(Chain, Covariance) {
+  vector<vector<Double>> values = {
+    { 1.0, 2.0 }, { 2.0, 1.5 }, { 4.0, 3.5 }, { 3.0, 0.5 }, { 5.0, 4.0 }, { 100.0, -100.0 }
+  };
+
+  Chain chain;
+  chain.set_capacity(2);
+  chain.set_track_covariance(true);
+  for (unsigned i = 0; i < values.size(); ++i)
+    chain.push_back(MakeLink(i + 1, values[i]));
+
+  unsigned n = values.size() - 1;
+  vector<Double> means(2, 0.0);
+  for (unsigned k = 0; k < n; ++k) {
+    means[0] += values[k][0] / n;
+    means[1] += values[k][1] / n;
+  }
+
+  ublas::matrix<Double> expected(2, 2);
+  for (unsigned i = 0; i < 2; ++i) {
+    for (unsigned j = 0; j < 2; ++j) {
+      Double sum = 0.0;
+      for (unsigned k = 0; k < n; ++k)
+        sum += (values[k][i] - means[i]) * (values[k][j] - means[j]);
+      expected(i, j) = sum / (n - 1);
+    }
+  }
+
+  ublas::matrix<Double> covariance(2, 2);
+  EXPECT_EQ(n, chain.CalculateCovariance(covariance));
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_DOUBLE_EQ(means[i], chain.means()[i]);
+    for (unsigned j = 0; j < 2; ++j)
+      EXPECT_DOUBLE_EQ(expected(i, j), covariance(i, j));
+  }
+}
+
+} /* namespace mcmc */
+} /* namespace niwa */
+#endif /* TESTMODE */
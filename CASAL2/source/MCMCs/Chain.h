@@ -0,0 +1,210 @@
+/**
+ * @file Chain.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds the links of an MCMC chain. Only the most recent links
+ * are kept, in a ring buffer, as every link is written out by the
+ * mcmc_sample and mcmc_objective reports when it is added. This keeps the
+ * memory used by the chain bounded regardless of the length of the chain.
+ *
+ * Links are numbered from 0 in the order they were added. Only the links from
+ * first_index() to total() - 1 are still held.
+ *
+ * When asked to, the chain keeps a running mean and covariance of the values
+ * of every link except the most recent one so the covariance matrix can be
+ * recalculated from the whole chain without keeping it in memory. The values
+ * of the most recent link are pending until the next link is added, so they
+ * are saved and restored with the running covariance.
+ */
+#ifndef SOURCE_MCMCS_CHAIN_H_
+#define SOURCE_MCMCS_CHAIN_H_
+
+// headers
+#include <vector>
+
+#include "../Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace mcmc {
+
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * Struct definition for a chain link
+ */
+struct ChainLink {
+  unsigned        iteration_;
+  Double          score_;
+  Double          likelihood_;
+  Double          prior_;
+  Double          penalty_;
+  Double          additional_priors_;
+  Double          jacobians_;
+  Double          acceptance_rate_;
+  Double          acceptance_rate_since_adapt_;
+  Double          step_size_;
+  vector<Double>  values_;
+};
+
+/**
+ * Class definition
+ */
+class Chain {
+public:
+  // methods
+  Chain() = default;
+  virtual                     ~Chain() = default;
+
+  /**
+   * Set the number of links to hold. This will remove
+   * any links we are holding.
+   *
+   * @param capacity The number of links to hold
+   */
+  void set_capacity(unsigned capacity) {
+    capacity_ = capacity == 0 ? 1 : capacity;
+    clear();
+  }
+
+  /**
+   * Remove all of the links and reset the running covariance
+   */
+  void clear() {
+    links_.clear();
+    links_.reserve(capacity_);
+    total_ = 0;
+    covariance_count_ = 0;
+    means_.clear();
+    co_moments_.clear();
+    pending_values_.clear();
+  }
+
+  /**
+   * Add a link to the end of the chain. If we are full the oldest link is
+   * overwritten. The storage of the link being overwritten is reused so
+   * adding a link does not allocate memory once the chain is full.
+   *
+   * @param link The link to add
+   */
+  void push_back(const ChainLink& link) {
+    if (track_covariance_ && total_ > 0)
+      AddToCovariance(back().values_);
+    else if (track_covariance_ && !pending_values_.empty())
+      AddToCovariance(pending_values_);
+    pending_values_.clear();
+
+    if (links_.size() < capacity_)
+      links_.push_back(link);
+    else
+      links_[total_ % capacity_] = link;
+    ++total_;
+  }
+
+  /**
+   * Calculate the covariance of the values of every link except the most
+   * recent one.
+   *
+   * @param covariance The matrix to fill. It must already be the correct size
+   * @return The number of links used, the covariance is only filled if this is more than 1
+   */
+  template<typename Matrix>
+  unsigned CalculateCovariance(Matrix& covariance) const {
+    if (covariance_count_ < 2)
+      return covariance_count_;
+
+    unsigned size = means_.size();
+    for (unsigned i = 0; i < size; ++i) {
+      for (unsigned j = 0; j <= i; ++j) {
+        Double value = co_moments_[i * (i + 1) / 2 + j] / (covariance_count_ - 1);
+        covariance(i, j) = value;
+        covariance(j, i) = value;
+      }
+    }
+
+    return covariance_count_;
+  }
+
+  // accessors
+  unsigned                    size() const { return links_.size(); }
+  unsigned                    total() const { return total_; }
+  unsigned                    first_index() const { return total_ - links_.size(); }
+  bool                        empty() const { return total_ == 0; }
+  unsigned                    capacity() const { return capacity_; }
+  ChainLink&                  back() { return links_[(total_ - 1) % capacity_]; }
+  const ChainLink&            back() const { return links_[(total_ - 1) % capacity_]; }
+  const ChainLink&            at(unsigned index) const { return links_[index % capacity_]; }
+  bool                        track_covariance() const { return track_covariance_; }
+  void                        set_track_covariance(bool value) { track_covariance_ = value; }
+  unsigned                    covariance_count() const { return covariance_count_; }
+  const vector<Double>&       means() const { return means_; }
+  const vector<Double>&       co_moments() const { return co_moments_; }
+  const vector<Double>&       pending_values() const { return total_ > 0 ? back().values_ : pending_values_; }
+
+  /**
+   * Restore the running covariance, e.g. when resuming from a checkpoint
+   *
+   * @param count The number of links the covariance is made from
+   * @param means The mean of each value
+   * @param co_moments The lower triangle of the sum of the products of the deviations from the means
+   * @param pending_values The values of the most recent link, added when the next link is added
+   */
+  void set_covariance(unsigned count, const vector<Double>& means, const vector<Double>& co_moments, const vector<Double>& pending_values) {
+    covariance_count_ = count;
+    means_ = means;
+    co_moments_ = co_moments;
+    pending_values_ = pending_values;
+  }
+
+private:
+  /**
+   * Add a set of values to the running mean and covariance. This uses
+   * Welford's algorithm so it is stable for long chains.
+   *
+   * @param values The values to add
+   */
+  void AddToCovariance(const vector<Double>& values) {
+    unsigned size = values.size();
+    if (covariance_count_ == 0) {
+      means_.assign(size, 0.0);
+      co_moments_.assign(size * (size + 1) / 2, 0.0);
+      deltas_.assign(size, 0.0);
+    }
+    deltas_.resize(size);
+
+    ++covariance_count_;
+    for (unsigned i = 0; i < size; ++i) {
+      deltas_[i] = values[i] - means_[i];
+      means_[i] += deltas_[i] / covariance_count_;
+    }
+    for (unsigned i = 0; i < size; ++i) {
+      Double* row = &co_moments_[i * (i + 1) / 2];
+      Double difference = values[i] - means_[i];
+      for (unsigned j = 0; j <= i; ++j)
+        row[j] += deltas_[j] * difference;
+    }
+  }
+
+  // members
+  unsigned                    capacity_ = 1;
+  unsigned                    total_ = 0;
+  vector<ChainLink>           links_;
+  bool                        track_covariance_ = false;
+  unsigned                    covariance_count_ = 0;
+  vector<Double>              means_;
+  vector<Double>              co_moments_; // lower triangle [i * (i + 1) / 2 + j]
+  vector<Double>              pending_values_;
+  vector<Double>              deltas_;
+};
+
+} /* namespace mcmc */
+} /* namespace niwa */
+
+#endif /* SOURCE_MCMCS_CHAIN_H_ */
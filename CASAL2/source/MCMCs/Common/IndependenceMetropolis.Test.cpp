@@ -0,0 +1,125 @@
+/**
+ * @file IndependenceMetropolis.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "IndependenceMetropolis.h"
+
+#include <cstdio>
+#include <boost/algorithm/string/replace.hpp>
+
+#include "../../ConfigurationLoader/Loader.h"
+#include "../../GlobalConfiguration/GlobalConfiguration.h"
+#include "../../MCMCs/Manager.h"
+#include "../../Model/Models/Age.h"
+#include "../../TestResources/Models/TwoSex.h"
+#include "../../TestResources/TestFixtures/InternalEmptyModel.h"
+#include "../../Utilities/RunParameters.h"
+
+// Namespaces
+namespace niwa {
+namespace mcmcs {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * The chain is checkpointed at 1050 and the covariance matrix is adapted at 1100,
+ * so the resumed chain adapts it from links on both sides of the checkpoint
+ */
+const std::string checkpoint_mcmc =
+R"(length 1300
+keep 1
+start 0
+covariance_adjustment_method none
+adapt_stepsize_at 1200
+adapt_covariance_matrix_at 1100
+checkpoint_file IndependenceMetropolis_Resume_From_Checkpoint.chk
+checkpoint_frequency 1050
+)";
+
+/**
+ * Prepare a model to run the MCMC from the two sex model's estimates
+ * with a diagonal covariance matrix instead of one from the minimiser
+ *
+ * @param model The model to prepare
+ * @param resume Resume the chain from the checkpoint file
+ * @return The MCMC of the model
+ */
+MCMC* PrepareModel(shared_ptr<Model> model, bool resume) {
+  utilities::RunParameters run_parameters;
+  run_parameters.run_mode_          = RunMode::kMCMC;
+  run_parameters.skip_estimation_   = true;
+  run_parameters.create_mpd_file_   = false;
+  run_parameters.resume_mcmc_chain_ = resume;
+  model->global_configuration().set_run_parameters(run_parameters);
+  model->set_run_mode(RunMode::kMCMC);
+  if (!model->PrepareForIterations())
+    return nullptr;
+
+  // q, R0, FishingSel.a50 and FishingSel.ato95
+  MCMC* mcmc = model->managers()->mcmc()->active_mcmc();
+  ublas::matrix<Double>& covariance = mcmc->covariance_matrix();
+  covariance = ublas::zero_matrix<Double>(4, 4);
+  covariance(0, 0) = 1e-10;
+  covariance(1, 1) = 1e9;
+  covariance(2, 2) = 0.1;
+  covariance(3, 3) = 0.1;
+  return mcmc;
+}
+
+/**
+ * Check that a chain resumed from a checkpoint produces the same links
+ * as a chain that ran without stopping, when the covariance matrix is
+ * adapted from the links after the checkpoint is saved
+ */
+TEST_F(InternalEmptyModel, MCMC_IndependenceMetropolis_Resume_From_Checkpoint) {
+  string configuration = testresources::models::two_sex;
+  boost::replace_first(configuration, "length 100", checkpoint_mcmc);
+  AddConfigurationLine(configuration, __FILE__, 28);
+  LoadConfiguration();
+
+  MCMC* mcmc = PrepareModel(model_, false);
+  ASSERT_NE(nullptr, mcmc);
+  model_->Start(RunMode::kMCMC);
+  ASSERT_TRUE(mcmc->recalculate_covariance());
+
+  shared_ptr<Model> resumed_model(new model::Age());
+  resumed_model->global_configuration().flag_skip_config_file();
+  resumed_model->flag_primary_thread_model();
+  configuration::Loader loader;
+  for (auto file_line : configuration_file_)
+    loader.AddFileLine(file_line);
+  loader.LoadConfigFile(resumed_model->global_configuration());
+  loader.ParseFileLines();
+  vector<shared_ptr<Model>> model_list = { resumed_model };
+  loader.Build(model_list);
+
+  MCMC* resumed_mcmc = PrepareModel(resumed_model, true);
+  ASSERT_NE(nullptr, resumed_mcmc);
+  resumed_model->Start(RunMode::kMCMC);
+  std::remove("IndependenceMetropolis_Resume_From_Checkpoint.chk");
+
+  const mcmc::Chain& chain = mcmc->chain();
+  const mcmc::Chain& resumed_chain = resumed_mcmc->chain();
+  ASSERT_EQ(1300u, chain.back().iteration_);
+  ASSERT_EQ(250u, resumed_chain.size());
+  for (unsigned i = 0; i < resumed_chain.size(); ++i) {
+    const mcmc::ChainLink& link = chain.at(chain.total() - resumed_chain.size() + i);
+    const mcmc::ChainLink& resumed_link = resumed_chain.at(i);
+    ASSERT_EQ(link.iteration_, resumed_link.iteration_);
+    EXPECT_DOUBLE_EQ(link.score_, resumed_link.score_) << "at iteration " << link.iteration_;
+    for (unsigned j = 0; j < link.values_.size(); ++j)
+      EXPECT_DOUBLE_EQ(link.values_[j], resumed_link.values_[j]) << "at iteration " << link.iteration_;
+  }
+}
+
+} /* namespace mcmcs */
+} /* namespace niwa */
+#endif /* TESTMODE */
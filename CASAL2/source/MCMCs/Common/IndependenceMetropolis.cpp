@@ -144,7 +144,7 @@ void IndependenceMetropolis::GenerateRandomStart() {
  * Fill the candidates with an attempt using a multivariate normal
  */
 void IndependenceMetropolis::FillMultivariateNormal(Double step_size) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
 
   vector<Double>  normals(estimate_count_ , 0.0);
   for (unsigned i = 0; i < estimate_count_; ++i) {
@@ -179,7 +179,7 @@ void IndependenceMetropolis::FillMultivariateNormal(Double step_size) {
  * Fill candidates with an attempt using a multivariate
  */
 void IndependenceMetropolis::FillMultivariateT(Double step_size) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
 
   vector<Double>  normals(estimate_count_, 0.0);
   vector<Double>  chisquares(estimate_count_, 0.0);
@@ -249,43 +249,20 @@ void IndependenceMetropolis::UpdateCovarianceMatrix() {
     if (std::find(adapt_covariance_matrix_.begin(), adapt_covariance_matrix_.end(), jumps_) == adapt_covariance_matrix_.end())
       return;
     recalculate_covariance_ = true;
-    LOG_MEDIUM() << "Re calculating covariance matrix, after " << chain_.size() << " iterations";
+    LOG_MEDIUM() << "Re calculating covariance matrix, after " << chain_.total() << " iterations";
     // modify the covaraince matrix this algorithm is stolen from CASAL, maybe not the best place to take it from
-    //number of parameters
-    int n_params = chain_[0].values_.size();
-    // number of iterations
-    int n_iter = chain_.size() - 1;
-    LOG_MEDIUM() << "Number of parameters = " << n_params << ", number of iterations used to recalculate covariance = " << n_iter;
+    // The chain keeps a running covariance of every link except the last one so we don't have to hold the whole chain
+    int n_params = estimate_count_;
     // temp covariance matrix
     ublas::matrix<Double> temp_covariance = covariance_matrix_;
-    // Mean parameter vector
-    vector<Double> mean_var(n_params, 1.0);
-    for (int i = 0; i < n_params; ++i) {
-      Double sx = 0.0;
-      for (int k = 0; k < n_iter; ++k) {
-       sx +=  chain_[k].values_[i];
-      }
-      mean_var[i] = sx / n_iter;
-
-      LOG_MEDIUM() << "Total = " << sx << "\n";
-      LOG_MEDIUM() << "Mean = " << mean_var[i]  << "\n";
+    // number of iterations
+    unsigned n_iter = chain_.CalculateCovariance(temp_covariance);
+    LOG_MEDIUM() << "Number of parameters = " << n_params << ", number of iterations used to recalculate covariance = " << n_iter;
+    for (unsigned i = 0; i < chain_.means().size(); ++i)
+      LOG_MEDIUM() << "Mean = " << chain_.means()[i];
+    // we only adapt the covariance matrix once so we no longer need the running covariance
+    chain_.set_track_covariance(false);
 
-      Double sxx = 0.0;
-      for (int k = 0; k < n_iter; ++k) {
-       sxx += pow(chain_[k].values_[i] - mean_var[i],2);
-      }
-      Double var = sxx / (n_iter - 1);
-      temp_covariance(i,i) = var;
-      for (int j = 0; j < i; j++){
-        Double sxy = 0;
-        for (int k = 0; k < n_iter; k++){
-          sxy += (chain_[k].values_[i] - mean_var[i]) * (chain_[k].values_[j] - mean_var[j]);
-        }
-        Double cov = (sxy / (n_iter - 1));
-        temp_covariance(i,j) = cov;
-        temp_covariance(j,i) = cov;
-      }
-    }
     for (int i = 0; i < n_params; ++i){
       for (int k = 0; k < n_params; ++k){
         LOG_MEDIUM() << "row =  " << i << " " << " col = " << k << " " << temp_covariance(i,k);
@@ -364,6 +341,20 @@ void IndependenceMetropolis::DoValidate() {
     LOG_ERROR_P(PARAM_DF) << "(" << df_ << ") cannot be less or equal to 0";
   if (start_ < 0.0)
     LOG_ERROR_P(PARAM_START) << "(" << start_ << ") cannot be less than 0";
+
+  /**
+   * The convergence diagnostics for multiple chains assume the chains start
+   * from points that are overdispersed relative to the posterior. So each chain
+   * draws its own random start, at twice the standard deviation of the
+   * covariance matrix unless the user has asked for something else.
+   */
+  if (chains_ > 1) {
+    if (!parameters_.Get(PARAM_START)->has_been_defined())
+      start_ = 2.0;
+    else if (start_ == 0.0)
+      LOG_ERROR_P(PARAM_START) << "(" << start_ << ") must be greater than 0 when " << PARAM_CHAINS << " (" << chains_
+        << ") is greater than 1 so that each chain starts from a different random point";
+  }
   if (step_size_ < 0.0)
     LOG_ERROR_P(PARAM_STEP_SIZE) << "(" << step_size_ << ") cannot be less than 0.0";
 }
@@ -395,6 +386,12 @@ void IndependenceMetropolis::DoBuild() {
 
   if (step_size_ == 0.0)
     step_size_ = 2.4 * pow((Double)active_estimates, -0.5);
+
+  // The chain only needs to keep a running covariance if we are going to adapt the covariance matrix
+  for (unsigned adapt : adapt_covariance_matrix_) {
+    if (adapt > 1)
+      chain_.set_track_covariance(true);
+  }
 }
 
 /**
@@ -403,13 +400,15 @@ void IndependenceMetropolis::DoBuild() {
 void IndependenceMetropolis::DoExecute() {
   candidates_.resize(estimate_count_);
   is_enabled_estimate_.resize(estimate_count_);
-  vector<Double> previous_untransformed_candidates = candidates_;
+  previous_untransformed_candidates_.resize(estimate_count_);
 
 
   // Transform any parameters so that candidates are in the same space as the covariance matrix.
   model_->managers()->estimate_transformation()->TransformEstimatesForObjectiveFunction();
   for (unsigned i = 0; i < estimate_count_; ++i) {
-    candidates_[i] = AS_DOUBLE(estimates_[i]->value());
+    // when resuming from a checkpoint the candidates have been loaded from it
+    if (!resume_from_checkpoint_)
+      candidates_[i] = AS_DOUBLE(estimates_[i]->value());
 
     if (estimates_[i]->lower_bound() == estimates_[i]->upper_bound() || estimates_[i]->mcmc_fixed())
       is_enabled_estimate_[i] = false;
@@ -417,102 +416,129 @@ void IndependenceMetropolis::DoExecute() {
       is_enabled_estimate_[i] = true;
   }
 
-  if (!model_->global_configuration().resume()) {
-    LOG_MEDIUM() << "not resuming";
-    BuildCovarianceMatrix();
-    LOG_MEDIUM() << "Building Covariance matrix";
-    successful_jumps_ = starting_iteration_;
-  }
-  // Set jumps = starting iteration if it is resuming
-  unsigned jumps_since_last_adapt = 1;
-  if (model_->global_configuration().resume()) {
-    for (unsigned i = 0; i < adapt_step_size_.size(); ++i) {
-      if (adapt_step_size_[i] < starting_iteration_) {
-        jumps_since_last_adapt = adapt_step_size_[i];
-        LOG_FINE() << "Chain last adapted at " << jumps_since_last_adapt;
-      }
+  ObjectiveFunction& obj_function = model_->objective_function();
+  Double score = 0.0;
+  Double penalty = 0.0;
+  Double prior = 0.0;
+  Double likelihood = 0.0;
+  Double additional_prior = 0.0;
+  Double jacobian = 0.0;
+
+  if (resume_from_checkpoint_) {
+    /**
+     * Everything we need to continue the chain, including the Cholesky decomposition
+     * of the covariance matrix and the state of the random number generator, was
+     * loaded from the checkpoint. So we carry on from the iteration after it
+     */
+    LOG_MEDIUM() << "Resuming MCMC from checkpoint " << checkpoint_file_ << " at iteration " << jumps_;
+    for (unsigned i = 0; i < estimate_count_; ++i)
+      estimates_[i]->set_value(previous_candidates_[i]);
+    model_->managers()->estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+  } else {
+    if (!model_->global_configuration().resume()) {
+      LOG_MEDIUM() << "not resuming";
+      BuildCovarianceMatrix();
+      LOG_MEDIUM() << "Building Covariance matrix";
+      successful_jumps_ = starting_iteration_;
     }
-    jumps_= starting_iteration_;
-    jumps_since_adapt_ = jumps_ - jumps_since_last_adapt;
-
-    Double temp_success_jumps = (Double)jumps_since_adapt_ * acceptance_rate_since_last_adapt_;
-
-    if (!utilities::To<Double, unsigned>(temp_success_jumps, successful_jumps_since_adapt_))
-      LOG_ERROR() << "Could not convert " << temp_success_jumps << " to an unsigned";
+    // Set jumps = starting iteration if it is resuming
+    unsigned jumps_since_last_adapt = 1;
+    if (model_->global_configuration().resume()) {
+      for (unsigned i = 0; i < adapt_step_size_.size(); ++i) {
+        if (adapt_step_size_[i] < starting_iteration_) {
+          jumps_since_last_adapt = adapt_step_size_[i];
+          LOG_FINE() << "Chain last adapted at " << jumps_since_last_adapt;
+        }
+      }
+      jumps_= starting_iteration_;
+      jumps_since_adapt_ = jumps_ - jumps_since_last_adapt;
 
-    LOG_FINE() << "jumps = " << jumps_ << "jumps since last adapt " << jumps_since_adapt_ << " successful jumps since last adapt " << successful_jumps_since_adapt_ << " step size " << step_size_ << " successful jumps " << successful_jumps_;
-  }
+      Double temp_success_jumps = (Double)jumps_since_adapt_ * acceptance_rate_since_last_adapt_;
 
-  LOG_MEDIUM() << "applying Cholesky decomposition";
-  if (!DoCholeskyDecmposition())
-    LOG_FATAL() << "Cholesky decomposition failed. Cannot continue MCMC";
+      if (!utilities::To<Double, unsigned>(temp_success_jumps, successful_jumps_since_adapt_))
+        LOG_ERROR() << "Could not convert " << temp_success_jumps << " to an unsigned";
 
-  if (start_ > 0.0) {
-    // Take into account any transformations so that when we compare with bounds we are in correct space, when: prior_applies_to_transform true
-    GenerateRandomStart();
-  }
-  for(unsigned i = 0; i < estimate_count_; ++i)
-  	estimates_[i]->set_value(candidates_[i]);
+      LOG_FINE() << "jumps = " << jumps_ << "jumps since last adapt " << jumps_since_adapt_ << " successful jumps since last adapt " << successful_jumps_since_adapt_ << " step size " << step_size_ << " successful jumps " << successful_jumps_;
+    }
 
-  /**
-   * Get the objective score
-   */
-  // Do a quick restore so that estimates are in a space the model wants
-  model_->managers()->estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
-  model_->FullIteration();
-  // For reporting purposes
-  for (unsigned i = 0; i < estimate_count_; ++i) {
-    previous_untransformed_candidates[i] = AS_DOUBLE(estimates_[i]->value());
-  }
-  ObjectiveFunction& obj_function = model_->objective_function();
-  obj_function.CalculateScore();
+    LOG_MEDIUM() << "applying Cholesky decomposition";
+    if (!DoCholeskyDecmposition())
+      LOG_FATAL() << "Cholesky decomposition failed. Cannot continue MCMC";
 
-  Double score = AS_DOUBLE(obj_function.score());
-  Double penalty = AS_DOUBLE(obj_function.penalties());
-  Double prior = AS_DOUBLE(obj_function.priors());
-  Double likelihood = AS_DOUBLE(obj_function.likelihoods());
-  Double additional_prior = AS_DOUBLE(obj_function.additional_priors());
-  Double jacobian = AS_DOUBLE(obj_function.jacobians());
+    if (start_ > 0.0) {
+      // Take into account any transformations so that when we compare with bounds we are in correct space, when: prior_applies_to_transform true
+      GenerateRandomStart();
+    }
+    for(unsigned i = 0; i < estimate_count_; ++i)
+      estimates_[i]->set_value(candidates_[i]);
+
+    /**
+     * Get the objective score
+     */
+    // Do a quick restore so that estimates are in a space the model wants
+    model_->managers()->estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+    model_->FullIteration();
+    // For reporting purposes
+    for (unsigned i = 0; i < estimate_count_; ++i) {
+      previous_untransformed_candidates_[i] = AS_DOUBLE(estimates_[i]->value());
+    }
+    obj_function.CalculateScore();
+
+    score = AS_DOUBLE(obj_function.score());
+    penalty = AS_DOUBLE(obj_function.penalties());
+    prior = AS_DOUBLE(obj_function.priors());
+    likelihood = AS_DOUBLE(obj_function.likelihoods());
+    additional_prior = AS_DOUBLE(obj_function.additional_priors());
+    jacobian = AS_DOUBLE(obj_function.jacobians());
+
+    /**
+     * Store first location
+     */
+    {
+      jumps_++;
+      jumps_since_adapt_++;
+      mcmc::ChainLink new_link;
+      new_link.iteration_                     = jumps_;
+      new_link.penalty_                       = AS_DOUBLE(obj_function.penalties());
+      new_link.score_                         = AS_DOUBLE(obj_function.score());
+      new_link.prior_                         = AS_DOUBLE(obj_function.priors());
+      new_link.likelihood_                    = AS_DOUBLE(obj_function.likelihoods());
+      new_link.additional_priors_             = AS_DOUBLE(obj_function.additional_priors());
+      new_link.jacobians_                     = AS_DOUBLE(obj_function.jacobians());
+      new_link.acceptance_rate_               = 0;
+      new_link.acceptance_rate_since_adapt_   = 0;
+      new_link.step_size_                     = step_size_;
+      new_link.values_                        = previous_untransformed_candidates_;
+      chain_.push_back(new_link);
+      // Print first value
+      model_->managers()->report()->Execute(model_->pointer(), State::kIterationComplete);
 
-  /**
-   * Store first location
-   */
-  {
-    jumps_++;
-    jumps_since_adapt_++;
-    mcmc::ChainLink new_link;
-    new_link.iteration_                     = jumps_;
-    new_link.penalty_                       = AS_DOUBLE(obj_function.penalties());
-    new_link.score_                         = AS_DOUBLE(obj_function.score());
-    new_link.prior_                         = AS_DOUBLE(obj_function.priors());
-    new_link.likelihood_                    = AS_DOUBLE(obj_function.likelihoods());
-    new_link.additional_priors_             = AS_DOUBLE(obj_function.additional_priors());
-    new_link.jacobians_                     = AS_DOUBLE(obj_function.jacobians());
-    new_link.acceptance_rate_               = 0;
-    new_link.acceptance_rate_since_adapt_   = 0;
-    new_link.step_size_                     = step_size_;
-    new_link.values_                        = previous_untransformed_candidates;
-    chain_.push_back(new_link);
-    // Print first value
-		model_->managers()->report()->Execute(model_->pointer(), State::kIterationComplete);
+    }
 
+    previous_candidates_ = candidates_;
+    previous_score_ = score;
+    previous_prior_ = prior;
+    previous_likelihood_ = likelihood;
+    previous_penalty_ = penalty;
+    previous_additional_prior_ = additional_prior;
+    previous_jacobian_ = jacobian;
   }
 
   /**
    * Now we start the MCMC process
    */
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   LOG_MEDIUM() << "MCMC Starting";
   LOG_MEDIUM() << "Covariance matrix has rows = " << covariance_matrix_.size1() << " and cols = " << covariance_matrix_.size2();
   LOG_MEDIUM() << "Estimate Count: " << estimate_count_;
 
-  vector<Double> previous_candidates = candidates_;
-  Double previous_score = score;
-  Double previous_prior = prior;
-  Double previous_likelihood = likelihood;
-  Double previous_penalty = penalty;
-  Double previous_additional_prior = additional_prior;
-  Double previous_jacobian = jacobian;
+  if (resume_from_checkpoint_ && jumps_ >= length_) {
+    LOG_MEDIUM() << "The chain was already complete when the checkpoint was saved";
+    return;
+  }
+
+  // The link is reused for every keep so its values don't need to be reallocated
+  mcmc::ChainLink new_link;
   do {
     // Check If we need to update the step size
     UpdateStepSize();
@@ -553,61 +579,107 @@ void IndependenceMetropolis::DoExecute() {
 
       Double ratio = 1.0;
 
-      if (score >= previous_score) {
-        ratio = exp(previous_score - score);
+      if (score >= previous_score_) {
+        ratio = exp(previous_score_ - score);
       }
 
       // Check if we accept this jump
       if (math::IsEqual(ratio, 1.0) || rng.uniform() < ratio) {
-        LOG_MEDIUM() << "Accept: Possible. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score;
+        LOG_MEDIUM() << "Accept: Possible. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score_;
         // Accept this jump
         successful_jumps_++;
         successful_jumps_since_adapt_++;
         // So these become our last step values so save them.
-        previous_candidates = candidates_;
-        previous_score = score;
-        previous_prior = prior;
-        previous_likelihood = likelihood;
-        previous_penalty = penalty;
-        previous_additional_prior = additional_prior;
-        previous_jacobian = jacobian;
+        previous_candidates_ = candidates_;
+        previous_score_ = score;
+        previous_prior_ = prior;
+        previous_likelihood_ = likelihood;
+        previous_penalty_ = penalty;
+        previous_additional_prior_ = additional_prior;
+        previous_jacobian_ = jacobian;
         // For reporting purposes
         for (unsigned i = 0; i < estimate_count_; ++i) {
-          previous_untransformed_candidates[i] = AS_DOUBLE(estimates_[i]->value());
+          previous_untransformed_candidates_[i] = AS_DOUBLE(estimates_[i]->value());
         }
       } else {
       	// reject this jump reset
-        candidates_ = previous_candidates;
+        candidates_ = previous_candidates_;
 
-      	LOG_MEDIUM() << "Reject: Possible. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score;
+      	LOG_MEDIUM() << "Reject: Possible. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score_;
       }
     } else {
-    	LOG_MEDIUM() << "Reject: Bounds. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score;
+    	LOG_MEDIUM() << "Reject: Bounds. Iteration = " << jumps_ << ", score = " << score << " Previous score " << previous_score_;
       // Reject this attempt but still record the chain if it lands on a keep
-      candidates_ = previous_candidates;
+      candidates_ = previous_candidates_;
     }
 
 		if (jumps_ % keep_ == 0) {
 			// Record the score, and its compontent parts if the successful jump divided by keep has no remainder
 			// i.e this proposed candidate is a 'keep' iteration
-			mcmc::ChainLink new_link;
 			new_link.iteration_ = jumps_;
-			new_link.penalty_ = previous_penalty;
-			new_link.score_ = previous_score;
-			new_link.prior_ = previous_prior;
-			new_link.likelihood_ = previous_likelihood;
-			new_link.additional_priors_ = previous_additional_prior;
-			new_link.jacobians_ = previous_jacobian;
+			new_link.penalty_ = previous_penalty_;
+			new_link.score_ = previous_score_;
+			new_link.prior_ = previous_prior_;
+			new_link.likelihood_ = previous_likelihood_;
+			new_link.additional_priors_ = previous_additional_prior_;
+			new_link.jacobians_ = previous_jacobian_;
 			new_link.acceptance_rate_ = Double(successful_jumps_) / Double(jumps_);
 			new_link.acceptance_rate_since_adapt_ = Double(successful_jumps_since_adapt_) / Double(jumps_since_adapt_);
 			new_link.step_size_ = step_size_;
-			new_link.values_ = previous_untransformed_candidates;
+			new_link.values_ = previous_untransformed_candidates_;
 			chain_.push_back(new_link);
 			//LOG_MEDIUM() << "Storing: Successful Jumps " << successful_jumps_ << " Jumps : " << jumps_;
 			model_->managers()->report()->Execute(model_->pointer(), State::kIterationComplete);
 		}
+
+		if (checkpoint_file_ != "" && jumps_ % checkpoint_frequency_ == 0)
+		  WriteCheckpoint();
   } while (jumps_ < length_);
 }
 
+/**
+ * Write the state of the chain to the checkpoint
+ *
+ * @param stream The checkpoint file
+ */
+void IndependenceMetropolis::DoWriteCheckpoint(std::ostream& stream) {
+  WriteUnsigned(stream, jumps_);
+  WriteUnsigned(stream, jumps_since_adapt_);
+  WriteUnsigned(stream, successful_jumps_since_adapt_);
+  WriteDoubles(stream, candidates_);
+  WriteDoubles(stream, previous_candidates_);
+  WriteDoubles(stream, previous_untransformed_candidates_);
+  WriteDouble(stream, previous_score_);
+  WriteDouble(stream, previous_prior_);
+  WriteDouble(stream, previous_likelihood_);
+  WriteDouble(stream, previous_penalty_);
+  WriteDouble(stream, previous_additional_prior_);
+  WriteDouble(stream, previous_jacobian_);
+}
+
+/**
+ * Load the state of the chain from the checkpoint
+ *
+ * @param stream The checkpoint file
+ * @return true on success, false on failure
+ */
+bool IndependenceMetropolis::DoLoadCheckpoint(std::istream& stream) {
+  bool success = ReadUnsigned(stream, jumps_)
+    && ReadUnsigned(stream, jumps_since_adapt_)
+    && ReadUnsigned(stream, successful_jumps_since_adapt_)
+    && ReadDoubles(stream, candidates_)
+    && ReadDoubles(stream, previous_candidates_)
+    && ReadDoubles(stream, previous_untransformed_candidates_)
+    && ReadDouble(stream, previous_score_)
+    && ReadDouble(stream, previous_prior_)
+    && ReadDouble(stream, previous_likelihood_)
+    && ReadDouble(stream, previous_penalty_)
+    && ReadDouble(stream, previous_additional_prior_)
+    && ReadDouble(stream, previous_jacobian_);
+
+  return success && candidates_.size() == estimate_count_ && previous_candidates_.size() == estimate_count_
+      && previous_untransformed_candidates_.size() == estimate_count_;
+}
+
 } /* namespace mcmcs */
 } /* namespace niwa */
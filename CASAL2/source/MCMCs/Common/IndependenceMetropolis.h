@@ -35,6 +35,8 @@ protected:
   // methods
   void                        DoValidate() override final;
   void                        DoBuild() override final;
+  void                        DoWriteCheckpoint(std::ostream& stream) override final;
+  bool                        DoLoadCheckpoint(std::istream& stream) override final;
   bool                        DoCholeskyDecmposition();
   void                        GenerateRandomStart();
   void                        FillMultivariateNormal(Double step_size);
@@ -58,6 +60,14 @@ protected:
   string                      proposal_distribution_ = "";
   unsigned                    df_ = 0;
   vector<Double>              candidates_;
+  vector<Double>              previous_candidates_;
+  vector<Double>              previous_untransformed_candidates_;
+  Double                      previous_score_ = 0;
+  Double                      previous_prior_ = 0;
+  Double                      previous_likelihood_ = 0;
+  Double                      previous_penalty_ = 0;
+  Double                      previous_additional_prior_ = 0;
+  Double                      previous_jacobian_ = 0;
   vector<bool>                is_enabled_estimate_;
   vector<unsigned>            adapt_step_size_;
   vector<unsigned>            adapt_covariance_matrix_;
@@ -11,20 +11,31 @@
 // headers
 #include "MCMC.h"
 
+#include <cstdio>
+#include <fstream>
+#include <functional>
+
 #include "../ConfigurationLoader/MPD.h"
 #include "../Estimates/Manager.h"
 #include "../EstimateTransformations/Manager.h"
 #include "../GlobalConfiguration/GlobalConfiguration.h"
+#include "../MCMCs/Manager.h"
 #include "../Model/Managers.h"
 #include "../Model/Model.h"
 #include "../Reports/Manager.h"
 #include "../Reports/Common/MCMCObjective.h"
 #include "../Reports/Common/MCMCSample.h"
+#include "../ThreadPool/ThreadPool.h"
+#include "../Utilities/RandomNumberGenerator.h"
 
 
 // namespaces
 namespace niwa {
 
+// The first bytes of a checkpoint file and the version of the layout that follows
+const string   kCheckpointMagic   = "CASAL2_MCMC_CHECKPOINT";
+const unsigned kCheckpointVersion = 2;
+
 /**
  * Constructor
  */
@@ -39,6 +50,10 @@ MCMC::MCMC(shared_ptr<Model> model) : model_(model) {
   parameters_.Bind<string>(PARAM_COVARIANCE_ADJUSTMENT_METHOD, &correlation_method_, "Method for adjusting small variances in the covariance proposal matrix"
       , "", PARAM_CORRELATION)->set_allowed_values({PARAM_COVARIANCE, PARAM_CORRELATION,PARAM_NONE});
   parameters_.Bind<Double>(PARAM_CORRELATION_ADJUSTMENT_DIFF, &correlation_diff_, "Minimum non-zero variance times the range of the bounds in the covariance matrix of the proposal distribution", "", 0.0001);
+  parameters_.Bind<unsigned>(PARAM_CHAINS, &chains_, "The number of independent chains to run at the same time. Each chain runs on its own thread", "", 1u)->set_lower_bound(1u);
+  parameters_.Bind<unsigned>(PARAM_CHAIN_BUFFER_SIZE, &chain_buffer_size_, "The number of the most recent chain links to keep in memory", "", 10000u)->set_lower_bound(1u);
+  parameters_.Bind<string>(PARAM_CHECKPOINT_FILE, &checkpoint_file_, "The file to save the state of the MCMC to so the chain can be resumed exactly", "", "");
+  parameters_.Bind<unsigned>(PARAM_CHECKPOINT_FREQUENCY, &checkpoint_frequency_, "The number of iterations between saving the state of the MCMC to the checkpoint file", "", 1000u)->set_lower_bound(1u);
 
 }
 
@@ -53,6 +68,12 @@ void MCMC::Validate() {
         << " is not supported. Currently supported values are " << PARAM_CORRELATION << ", " << PARAM_COVARIANCE << " and " << PARAM_NONE;
   if (max_correlation_ <= 0.0 || max_correlation_ > 1.0)
     LOG_ERROR_P(PARAM_MAX_CORRELATION) << "(" << max_correlation_ << ") must be between 0.0 (not inclusive) and 1.0 (inclusive)";
+  if (chains_ > model_->threads())
+    LOG_ERROR_P(PARAM_CHAINS) << "(" << chains_ << ") cannot be greater than the number of threads (" << model_->threads() << ") defined on the @model block";
+  if (chains_ > 1 && model_->global_configuration().resume())
+    LOG_ERROR_P(PARAM_CHAINS) << "(" << chains_ << ") cannot be greater than 1 when resuming an MCMC chain";
+  if (chains_ > 1 && checkpoint_file_ != "")
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << "cannot be used when " << PARAM_CHAINS << " (" << chains_ << ") is greater than 1";
 
   DoValidate();
 }
@@ -139,6 +160,7 @@ void MCMC::Build() {
     model_->managers()->report()->Resume();
   }
 
+  chain_.set_capacity(chain_buffer_size_);
   DoBuild();
 }
 
@@ -154,7 +176,261 @@ void MCMC::Execute() {
   }
 
   LOG_FINEST() << "Running into MCMC now...";
-  DoExecute();
+  if (chains_ > 1)
+    ExecuteChains();
+  else
+    DoExecute();
+}
+
+/**
+ * Run all of our chains at the same time. We are chain 1 and run on the
+ * master model. Chain N runs on the model owned by thread N in the thread pool.
+ *
+ * Every chain starts from our covariance matrix and estimate values but uses
+ * the random number stream of its model and its own chain_, so the chains are
+ * independent and the reports for each chain can be written separately. Each
+ * chain draws its own random starting point from the covariance matrix with
+ * its random number stream (see IndependenceMetropolis::DoValidate).
+ *
+ * The chains are run as tasks on the thread pool. A task may be picked up by
+ * any thread, but each task only uses the model of its own chain so no model
+ * is ever used by two chains.
+ */
+void MCMC::ExecuteChains() {
+  auto thread_pool = model_->thread_pool();
+  if (!thread_pool || thread_pool->Threads().size() < chains_)
+    LOG_FATAL_P(PARAM_CHAINS) << "(" << chains_ << ") requires a model for each chain but only "
+      << (thread_pool ? thread_pool->Threads().size() : 1) << " are available";
+
+  vector<MCMC*> mcmcs;
+  for (unsigned i = 1; i < chains_; ++i) {
+    MCMC* mcmc = thread_pool->Threads()[i]->model()->managers()->mcmc()->active_mcmc();
+    if (!mcmc)
+      LOG_CODE_ERROR() << "(!mcmc) for chain " << i + 1;
+    mcmc->PrepareChain(i + 1, *this);
+    mcmcs.push_back(mcmc);
+  }
+
+  LOG_MEDIUM() << "Running " << chains_ << " MCMC chains";
+  mcmcs.insert(mcmcs.begin(), this);
+  vector<std::function<void(shared_ptr<Model>)>> tasks;
+  for (MCMC* mcmc : mcmcs)
+    tasks.push_back([mcmc](shared_ptr<Model>) { mcmc->DoExecute(); });
+
+  thread_pool->RunTasks(tasks);
+}
+
+/**
+ * Prepare this MCMC to run as one of the extra chains. We copy the
+ * covariance matrix and point estimate from the master chain. The chain
+ * will draw its random starting point around the point estimate.
+ *
+ * @param chain_number The number of this chain (1 is the master chain)
+ * @param master The MCMC running chain 1 on the master model
+ */
+void MCMC::PrepareChain(unsigned chain_number, MCMC& master) {
+  chain_number_       = chain_number;
+  covariance_matrix_  = master.covariance_matrix_;
+  chain_.clear();
+  LOG_FINE() << "MCMC chain " << chain_number << " has random number seed " << model_->random_number_seed();
+
+  vector<Estimate*> estimates = model_->managers()->estimate()->GetIsEstimated();
+  vector<Estimate*> master_estimates = master.model_->managers()->estimate()->GetIsEstimated();
+  if (estimates.size() != master_estimates.size())
+    LOG_CODE_ERROR() << "estimates.size() != master_estimates.size() for chain " << chain_number;
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    estimates[i]->set_value(master_estimates[i]->value());
+}
+
+/**
+ * Save the state of the MCMC to our checkpoint file so the chain can be
+ * resumed from this iteration. The file is written in binary so the values
+ * are restored exactly, including the state of the random number generator.
+ *
+ * We wait for the reports to be written first so the mcmc_sample and
+ * mcmc_objective files are up to date with the checkpoint. The checkpoint
+ * is written to a temporary file and renamed so a run that is stopped while
+ * we are writing leaves the previous checkpoint in place.
+ */
+void MCMC::WriteCheckpoint() {
+  model_->managers()->report()->WaitForReportsToFinish();
+
+  string temp_file_name = checkpoint_file_ + ".tmp";
+  std::ofstream file(temp_file_name.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!file.is_open()) {
+    LOG_WARNING() << "Unable to open the MCMC checkpoint file " << temp_file_name;
+    return;
+  }
+
+  WriteString(file, kCheckpointMagic);
+  WriteUnsigned(file, kCheckpointVersion);
+  WriteUnsigned(file, model_->managers()->estimate()->GetIsEstimatedCount());
+  WriteString(file, model_->rng().state());
+  WriteDouble(file, step_size_);
+  WriteUnsigned(file, successful_jumps_);
+  WriteDouble(file, acceptance_rate_since_last_adapt_);
+  WriteUnsigned(file, recalculate_covariance_ ? 1 : 0);
+  WriteMatrix(file, covariance_matrix_);
+  WriteMatrix(file, covariance_matrix_lt);
+  WriteUnsigned(file, chain_.track_covariance() ? 1 : 0);
+  WriteUnsigned(file, chain_.covariance_count());
+  WriteDoubles(file, chain_.means());
+  WriteDoubles(file, chain_.co_moments());
+  WriteDoubles(file, chain_.pending_values());
+  DoWriteCheckpoint(file);
+  file.close();
+
+  if (file.fail() || std::rename(temp_file_name.c_str(), checkpoint_file_.c_str()) != 0)
+    LOG_WARNING() << "Unable to write the MCMC checkpoint file " << checkpoint_file_;
+}
+
+/**
+ * Load the state of the MCMC from our checkpoint file. The chain
+ * will continue from the iteration the checkpoint was written at.
+ *
+ * @return true on success, false on failure
+ */
+bool MCMC::LoadCheckpoint() {
+  std::ifstream file(checkpoint_file_.c_str(), std::ios_base::in | std::ios_base::binary);
+  if (!file.is_open()) {
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << checkpoint_file_ << " does not exist or could not be opened";
+    return false;
+  }
+
+  string   magic          = "";
+  unsigned version        = 0;
+  unsigned estimate_count = 0;
+  if (!ReadString(file, magic) || magic != kCheckpointMagic || !ReadUnsigned(file, version)) {
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << checkpoint_file_ << " is not an MCMC checkpoint file";
+    return false;
+  }
+  if (version != kCheckpointVersion) {
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << checkpoint_file_ << " is version " << version << " but only version " << kCheckpointVersion << " is supported";
+    return false;
+  }
+  if (!ReadUnsigned(file, estimate_count) || estimate_count != model_->managers()->estimate()->GetIsEstimatedCount()) {
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << checkpoint_file_ << " has " << estimate_count << " estimates but the model has "
+      << model_->managers()->estimate()->GetIsEstimatedCount();
+    return false;
+  }
+
+  string         rng_state              = "";
+  unsigned       recalculate_covariance = 0;
+  unsigned       track_covariance       = 0;
+  unsigned       covariance_count       = 0;
+  vector<Double> means;
+  vector<Double> co_moments;
+  vector<Double> pending_values;
+  bool success = ReadString(file, rng_state)
+    && ReadDouble(file, step_size_)
+    && ReadUnsigned(file, successful_jumps_)
+    && ReadDouble(file, acceptance_rate_since_last_adapt_)
+    && ReadUnsigned(file, recalculate_covariance)
+    && ReadMatrix(file, covariance_matrix_)
+    && ReadMatrix(file, covariance_matrix_lt)
+    && ReadUnsigned(file, track_covariance)
+    && ReadUnsigned(file, covariance_count)
+    && ReadDoubles(file, means)
+    && ReadDoubles(file, co_moments)
+    && ReadDoubles(file, pending_values)
+    && model_->rng().set_state(rng_state)
+    && DoLoadCheckpoint(file);
+  if (!success) {
+    LOG_ERROR_P(PARAM_CHECKPOINT_FILE) << "Failed to read the MCMC state from " << checkpoint_file_ << ". The file is incomplete or corrupt";
+    return false;
+  }
+
+  recalculate_covariance_ = recalculate_covariance == 1;
+  chain_.set_track_covariance(track_covariance == 1);
+  chain_.set_covariance(covariance_count, means, co_moments, pending_values);
+  resume_from_checkpoint_ = true;
+  LOG_FINE() << "Loaded MCMC checkpoint from " << checkpoint_file_;
+  return true;
+}
+
+/**
+ * Methods to write and read the values in a checkpoint file
+ */
+void MCMC::WriteUnsigned(std::ostream& stream, unsigned value) {
+  uint32_t data = value;
+  stream.write(reinterpret_cast<const char*>(&data), sizeof(data));
+}
+
+void MCMC::WriteDouble(std::ostream& stream, Double value) {
+  double data = AS_DOUBLE(value);
+  stream.write(reinterpret_cast<const char*>(&data), sizeof(data));
+}
+
+void MCMC::WriteDoubles(std::ostream& stream, const vector<Double>& values) {
+  WriteUnsigned(stream, values.size());
+  for (Double value : values)
+    WriteDouble(stream, value);
+}
+
+void MCMC::WriteMatrix(std::ostream& stream, const ublas::matrix<Double>& matrix) {
+  WriteUnsigned(stream, matrix.size1());
+  WriteUnsigned(stream, matrix.size2());
+  for (unsigned i = 0; i < matrix.size1(); ++i) {
+    for (unsigned j = 0; j < matrix.size2(); ++j)
+      WriteDouble(stream, matrix(i, j));
+  }
+}
+
+void MCMC::WriteString(std::ostream& stream, const string& value) {
+  WriteUnsigned(stream, value.size());
+  stream.write(value.data(), value.size());
+}
+
+bool MCMC::ReadUnsigned(std::istream& stream, unsigned& value) {
+  uint32_t data = 0;
+  if (!stream.read(reinterpret_cast<char*>(&data), sizeof(data)))
+    return false;
+  value = data;
+  return true;
+}
+
+bool MCMC::ReadDouble(std::istream& stream, Double& value) {
+  double data = 0.0;
+  if (!stream.read(reinterpret_cast<char*>(&data), sizeof(data)))
+    return false;
+  value = data;
+  return true;
+}
+
+bool MCMC::ReadDoubles(std::istream& stream, vector<Double>& values) {
+  unsigned size = 0;
+  if (!ReadUnsigned(stream, size))
+    return false;
+  values.resize(size);
+  for (unsigned i = 0; i < size; ++i) {
+    if (!ReadDouble(stream, values[i]))
+      return false;
+  }
+  return true;
+}
+
+bool MCMC::ReadMatrix(std::istream& stream, ublas::matrix<Double>& matrix) {
+  unsigned size1 = 0;
+  unsigned size2 = 0;
+  if (!ReadUnsigned(stream, size1) || !ReadUnsigned(stream, size2))
+    return false;
+  matrix.resize(size1, size2, false);
+  for (unsigned i = 0; i < size1; ++i) {
+    for (unsigned j = 0; j < size2; ++j) {
+      if (!ReadDouble(stream, matrix(i, j)))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool MCMC::ReadString(std::istream& stream, string& value) {
+  // the largest string we write is the state of the random number generator
+  unsigned size = 0;
+  if (!ReadUnsigned(stream, size) || size > (1u << 16))
+    return false;
+  value.resize(size);
+  return size == 0 || (bool)stream.read(&value[0], size);
 }
 
 
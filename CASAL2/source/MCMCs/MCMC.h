@@ -15,9 +15,11 @@
 #define MCMC_H_
 
 // headers
+#include <iostream>
 #include <boost/numeric/ublas/matrix.hpp>
 
 #include "../BaseClasses/Object.h"
+#include "../MCMCs/Chain.h"
 
 // namespaces
 namespace niwa {
@@ -26,25 +28,6 @@ namespace ublas = boost::numeric::ublas;
 class Minimiser;
 class Model;
 
-/**
- * Struct definition for a chain link
- */
-namespace mcmc {
-struct ChainLink {
-  unsigned        iteration_;
-  Double          score_;
-  Double          likelihood_;
-  Double          prior_;
-  Double          penalty_;
-  Double          additional_priors_;
-  Double          jacobians_;
-  Double          acceptance_rate_;
-  Double          acceptance_rate_since_adapt_;
-  Double          step_size_;
-  vector<Double>  values_;
-};
-}
-
 /**
  * Class definition
  */
@@ -58,9 +41,12 @@ public:
   void                        Build();
   void                        Reset() { };
   void                        Execute();
+  bool                        LoadCheckpoint();
 
   // accessors/mutators
-  vector<mcmc::ChainLink>&    chain() { return chain_; }
+  mcmc::Chain&                chain() { return chain_; }
+  unsigned                    chains() const { return chains_; }
+  unsigned                    chain_number() const { return chain_number_; }
   bool                        active() const { return active_; }
   ublas::matrix<Double>&      covariance_matrix() {return covariance_matrix_;}
   void                        set_starting_iteration(unsigned value) { starting_iteration_ = value; }
@@ -68,15 +54,31 @@ public:
   void                        set_step_size(Double value) { step_size_ = value; }
   void                        set_acceptance_rate_from_last_adapt(Double value) { acceptance_rate_since_last_adapt_ = value; }
   bool                        recalculate_covariance() const { return recalculate_covariance_; }
+  const string&               checkpoint_file() const { return checkpoint_file_; }
 
 protected:
   // pure virtual methods
   virtual void                DoValidate() = 0;
   virtual void                DoBuild() = 0;
   virtual void                DoExecute() = 0;
+  virtual void                DoWriteCheckpoint(std::ostream& stream) { };
+  virtual bool                DoLoadCheckpoint(std::istream& stream) { return true; };
 
   // methods
   void                        BuildCovarianceMatrix();
+  void                        ExecuteChains();
+  void                        PrepareChain(unsigned chain_number, MCMC& master);
+  void                        WriteCheckpoint();
+  static void                 WriteUnsigned(std::ostream& stream, unsigned value);
+  static void                 WriteDouble(std::ostream& stream, Double value);
+  static void                 WriteDoubles(std::ostream& stream, const vector<Double>& values);
+  static void                 WriteMatrix(std::ostream& stream, const ublas::matrix<Double>& matrix);
+  static void                 WriteString(std::ostream& stream, const string& value);
+  static bool                 ReadUnsigned(std::istream& stream, unsigned& value);
+  static bool                 ReadDouble(std::istream& stream, Double& value);
+  static bool                 ReadDoubles(std::istream& stream, vector<Double>& values);
+  static bool                 ReadMatrix(std::istream& stream, ublas::matrix<Double>& matrix);
+  static bool                 ReadString(std::istream& stream, string& value);
 
   // members
   shared_ptr<Model>           model_;
@@ -87,7 +89,13 @@ protected:
   string                      correlation_method_ = "";
   Double                      max_correlation_ = 0;
   Double                      correlation_diff_ = 0;
-  vector<mcmc::ChainLink>     chain_;
+  mcmc::Chain                 chain_;
+  unsigned                    chain_buffer_size_ = 0;
+  unsigned                    chains_ = 1;
+  unsigned                    chain_number_ = 1;
+  string                      checkpoint_file_ = "";
+  unsigned                    checkpoint_frequency_ = 0;
+  bool                        resume_from_checkpoint_ = false;
 
   bool                        active_;
   bool                        print_default_reports_;
@@ -48,6 +48,29 @@ void DESolver::DoValidate() {
  * Execute our DE Solver minimiser engine
  */
 void DESolver::Execute() {
+  Minimise(nullptr);
+}
+
+/**
+ * Execute our DE Solver minimiser engine with each generation
+ * of the population being scored in parallel. With only a single
+ * thread we keep the original (serial) update of the population.
+ *
+ * @param thread_pool The thread pool to score the population with
+ */
+void DESolver::ExecuteThreaded(shared_ptr<ThreadPool> thread_pool) {
+  if (thread_pool->Threads().size() <= 1)
+    Minimise(nullptr);
+  else
+    Minimise(thread_pool);
+}
+
+/**
+ * Run the DE Solver engine
+ *
+ * @param thread_pool The thread pool to use, or nullptr to score candidates on our model
+ */
+void DESolver::Minimise(shared_ptr<ThreadPool> thread_pool) {
   estimates::Manager& estimate_manager = *model_->managers()->estimate();
 
   vector<double>  lower_bounds;
@@ -74,11 +97,15 @@ void DESolver::Execute() {
   }
 
   // Setup Engine
-  desolver::CallBack solver = desolver::CallBack(model_, start_values.size(), population_size_, tolerance_);
-  solver.Setup(start_values, lower_bounds, upper_bounds, kBest1Exp, difference_scale_, crossover_probability_);
+  std::unique_ptr<desolver::CallBack> solver;
+  if (thread_pool)
+    solver.reset(new desolver::CallBack(model_, thread_pool, start_values.size(), population_size_, tolerance_));
+  else
+    solver.reset(new desolver::CallBack(model_, start_values.size(), population_size_, tolerance_));
+  solver->Setup(start_values, lower_bounds, upper_bounds, kBest1Exp, difference_scale_, crossover_probability_);
 
   // Solver
-  if (solver.Solve(max_generations_)) {
+  if (solver->Solve(max_generations_)) {
     result_ = MinimiserResult::kSuccess;
     LOG_FINE() << "DE Solver has successfully converged";
   } else {
@@ -39,8 +39,12 @@ public:
   void                        DoBuild() override final { };
   void                        DoReset() override final { };
   void                        Execute() override final;
+  void                        ExecuteThreaded(shared_ptr<ThreadPool> thread_pool) override final;
 
 private:
+  // Methods
+  void                        Minimise(shared_ptr<ThreadPool> thread_pool);
+
   // Members
   unsigned                    population_size_;
   double                      crossover_probability_;
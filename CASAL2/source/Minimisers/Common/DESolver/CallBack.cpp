@@ -32,6 +32,17 @@ CallBack::CallBack(shared_ptr<Model> model, unsigned vector_size, unsigned popul
   model_(model) {
 }
 
+/**
+ * Threaded constructor. Each generation of the population
+ * will be scored in parallel across the thread pool.
+ */
+CallBack::CallBack(shared_ptr<Model> model, shared_ptr<ThreadPool> thread_pool, unsigned vector_size, unsigned population_size, double tolerance)
+  : niwa::minimisers::desolver::Engine(vector_size, population_size, tolerance),
+  model_(model),
+  thread_pool_(thread_pool) {
+  batch_generations_ = true;
+}
+
 /**
  * Destructor
  */
@@ -65,6 +76,21 @@ double CallBack::EnergyFunction(vector<double> test_solution) {
   return objective.score();
 }
 
+/**
+ * Score a generation of test solutions across our thread pool
+ *
+ * @param test_solutions The test solutions to use
+ * @param scores The score from the energy function for each test solution
+ */
+void CallBack::BatchEnergyFunction(const vector<vector<double>>& test_solutions, vector<double>& scores) {
+  if (!thread_pool_) {
+    Engine::BatchEnergyFunction(test_solutions, scores);
+    return;
+  }
+
+  thread_pool_->RunCandidates(test_solutions, scores);
+}
+
 } /* namespace desolver */
 } /* namespace minimisers */
 } /* namespace niwa */
@@ -20,6 +20,7 @@
 // Headers
 #include "../../../Minimisers/Common/DESolver/Engine.h"
 #include "../../../Model/Model.h"
+#include "../../../ThreadPool/ThreadPool.h"
 #include "../../../Utilities/Types.h"
 
 // Namespaces
@@ -34,12 +35,15 @@ class CallBack : public niwa::minimisers::desolver::Engine {
 public:
   // Methods
   CallBack(shared_ptr<Model> model, unsigned vector_size, unsigned population_size, double tolerance);
+  CallBack(shared_ptr<Model> model, shared_ptr<ThreadPool> thread_pool, unsigned vector_size, unsigned population_size, double tolerance);
   virtual                     ~CallBack();
   double                      EnergyFunction(vector<double> test_solution) override final;
+  void                        BatchEnergyFunction(const vector<vector<double>>& test_solutions, vector<double>& scores) override final;
 
 private:
   // Members
   shared_ptr<Model>                    model_;
+  shared_ptr<ThreadPool>               thread_pool_;
 };
 
 } /* namespace desolver */
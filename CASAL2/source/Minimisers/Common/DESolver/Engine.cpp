@@ -181,36 +181,37 @@ bool Engine::Solve(unsigned max_generations) {
 
   for (unsigned i = 0; i < max_generations; ++i) {
     LOG_MEDIUM() << "DESolver: current generation: " << (i+1) << "\n";
-    for (unsigned j = 0; j < population_size_; ++j) {
-      // Build our Trial Solution
-      (this->*calculate_solution_)(j);
+    if (batch_generations_) {
+      /**
+       * Build every trial solution for this generation from the current population
+       * first, then score them as a single batch before doing the selection.
+       */
+      vector<vector<double>> trial_solutions(population_size_);
+      for (unsigned j = 0; j < population_size_; ++j) {
+        (this->*calculate_solution_)(j);
+        trial_solutions[j] = current_values_;
+      }
 
-      trial_energy_ = EnergyFunction(current_values_);
-      if (trial_energy_ < population_energy_[j]) {
-        // Copy solution to our Population
-        population_energy_[j] = trial_energy_;
-        population_[j].assign(current_values_.begin(), current_values_.end());
+      vector<double> trial_energies(population_size_, 0.0);
+      BatchEnergyFunction(trial_solutions, trial_energies);
 
-        // Is this a new all-time low for our search?
-        if (trial_energy_ < best_energy_) {
+      for (unsigned j = 0; j < population_size_; ++j) {
+        current_values_ = trial_solutions[j];
+        trial_energy_   = trial_energies[j];
+        if (SelectTrial(j))
           new_best_energy = true;
-          // Copy the solution to our best.
-          best_energy_ = trial_energy_;
-          best_solution_.assign(current_values_.begin(), current_values_.end());
-
+      }
 
-          LOG_MEDIUM() << "Objective function value: " << trial_energy_;
+    } else {
+      for (unsigned j = 0; j < population_size_; ++j) {
+        // Build our Trial Solution
+        (this->*calculate_solution_)(j);
 
-//          if(!(pConfig->getQuietMode())) {
-//            LOG_MEDIUM() << "Current estimates: ";
-//            for (int k = 0; k < (int)vBestSolution.size(); ++k)
-//              LOG_MEDIUM() << vBestSolution[k] << " ";
-//            LOG_MEDIUM();
-//            LOG_MEDIUM() << "Objective function value: " << dTrialEnergy << "\n";
-//          }
-        }
-      }
-    } // end for()
+        trial_energy_ = EnergyFunction(current_values_);
+        if (SelectTrial(j))
+          new_best_energy = true;
+      } // end for()
+    }
 
     // If we have a new Best, lets generate a gradient.
     if (new_best_energy)
@@ -239,6 +240,47 @@ bool Engine::Solve(unsigned max_generations) {
   return false;
 }
 
+/**
+ * Score a batch of trial solutions. By default these are
+ * run one after the other through the EnergyFunction.
+ *
+ * @param test_solutions The trial solutions to score
+ * @param scores The score for each trial solution
+ */
+void Engine::BatchEnergyFunction(const vector<vector<double>>& test_solutions, vector<double>& scores) {
+  scores.resize(test_solutions.size());
+  for (unsigned i = 0; i < test_solutions.size(); ++i)
+    scores[i] = EnergyFunction(test_solutions[i]);
+}
+
+/**
+ * Compare the current trial solution against the population member it
+ * was built from and replace the member if the trial has a lower energy.
+ *
+ * @param candidate The index of the population member
+ * @return True if the trial solution is a new all-time best
+ */
+bool Engine::SelectTrial(unsigned candidate) {
+  if (trial_energy_ >= population_energy_[candidate])
+    return false;
+
+  // Copy solution to our Population
+  population_energy_[candidate] = trial_energy_;
+  population_[candidate].assign(current_values_.begin(), current_values_.end());
+
+  // Is this a new all-time low for our search?
+  if (trial_energy_ < best_energy_) {
+    // Copy the solution to our best.
+    best_energy_ = trial_energy_;
+    best_solution_.assign(current_values_.begin(), current_values_.end());
+
+    LOG_MEDIUM() << "Objective function value: " << trial_energy_;
+    return true;
+  }
+
+  return false;
+}
+
 /**
  *
  */
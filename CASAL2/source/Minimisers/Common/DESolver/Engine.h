@@ -65,9 +65,15 @@ public:
                                   double crossover_prob);
   virtual bool                Solve(unsigned max_generations);
   virtual double              EnergyFunction(vector<double> test_solution) = 0;
+  virtual void                BatchEnergyFunction(const vector<vector<double>>& test_solutions, vector<double>& scores);
+
+protected:
+  // Members
+  bool                        batch_generations_ = false;
 
 private:
   // Methods
+  bool                        SelectTrial(unsigned candidate);
   void                        SelectSamples(unsigned candidate);
   bool                        GenerateGradient();
   void                        ScaleValues();
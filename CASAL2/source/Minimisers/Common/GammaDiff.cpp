@@ -36,10 +36,32 @@ GammaDiff::GammaDiff(shared_ptr<Model> model) : Minimiser(model) {
  */
 void GammaDiff::Execute() {
   LOG_TRACE();
+  gammadiff::CallBack  call_back(model_);
+  Minimise(call_back);
+}
+
+/**
+ * Execute the minimiser to solve the model. The candidates
+ * used to calculate the gradient are run in parallel across
+ * the thread pool.
+ *
+ * @param thread_pool The thread pool to run the gradient candidates with
+ */
+void GammaDiff::ExecuteThreaded(shared_ptr<ThreadPool> thread_pool) {
+  LOG_TRACE();
+  gammadiff::CallBack  call_back(model_, thread_pool);
+  Minimise(call_back);
+}
+
+/**
+ * Run the minimiser engine using the call back to evaluate the model
+ *
+ * @param call_back The call back that will run our candidates
+ */
+void GammaDiff::Minimise(gammadiff::CallBack& call_back) {
   // Variables
   LOG_FINE() << "model_: " << model_;
 
-  gammadiff::CallBack  call_back(model_);
   estimates::Manager* estimate_manager = model_->managers()->estimate();
   LOG_FINE() << "estimate_manager: " << estimate_manager;
 
@@ -23,6 +23,9 @@
 // namespaces
 namespace niwa {
 namespace minimisers {
+namespace gammadiff {
+class CallBack;
+} /* namespace gammadiff */
 
 //**********************************************************************
 //
@@ -37,8 +40,12 @@ public:
   void                        DoBuild() override final { };
   void                        DoReset() override final { };
   void                        Execute() override final;
+  void                        ExecuteThreaded(shared_ptr<ThreadPool> thread_pool) override final;
 
 private:
+  // Methods
+  void                        Minimise(gammadiff::CallBack& call_back);
+
   // Members
   int                         max_iterations_;
   int                         max_evaluations_;
@@ -29,6 +29,14 @@ namespace gammadiff {
 CallBack::CallBack(shared_ptr<Model> model) : model_(model) {
 }
 
+/**
+ * Threaded Constructor. Single candidates are run on the
+ * minimiser's model and batches of candidates are spread
+ * across the thread pool.
+ */
+CallBack::CallBack(shared_ptr<Model> model, shared_ptr<ThreadPool> thread_pool) : model_(model), thread_pool_(thread_pool) {
+}
+
 //**********************************************************************
 // double CGammaDiffCallback::operator()(const vector<double>& Parameters)
 // Operatior() for Minimiser CallBack
@@ -56,6 +64,24 @@ double CallBack::operator()(const vector<double>& Parameters) {
   return objective.score();
 }
 
+/**
+ * Run a batch of candidates. If we have a thread pool these will be run
+ * in parallel, otherwise they're run one after the other on our model.
+ *
+ * @param Parameters The candidates to run
+ * @param scores The objective score for each candidate
+ */
+void CallBack::operator()(const vector<vector<double>>& Parameters, vector<double>& scores) {
+  if (thread_pool_) {
+    thread_pool_->RunCandidates(Parameters, scores);
+    return;
+  }
+
+  scores.resize(Parameters.size());
+  for (unsigned i = 0; i < Parameters.size(); ++i)
+    scores[i] = (*this)(Parameters[i]);
+}
+
 } /* namespace gammadiff */
 } /* namespace minimiser */
 } /* namespace niwa */
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "../../../Model/Model.h"
+#include "../../../ThreadPool/ThreadPool.h"
 
 // namespaces
 namespace niwa {
@@ -35,11 +36,14 @@ using std::vector;
 class CallBack {
 public:
   CallBack(shared_ptr<Model> model);
+  CallBack(shared_ptr<Model> model, shared_ptr<ThreadPool> thread_pool);
   virtual                     ~CallBack() = default;
   double                      operator()(const vector<double>& Parameters);
+  void                        operator()(const vector<vector<double>>& Parameters, vector<double>& scores);
 
 private:
   shared_ptr<Model>                    model_;
+  shared_ptr<ThreadPool>               thread_pool_;
 };
 
 } /* namespace gammadiff */
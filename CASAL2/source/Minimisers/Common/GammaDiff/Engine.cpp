@@ -178,10 +178,14 @@ double Engine::optimise_finite_differences(gammadiff::CallBack& objective, vecto
     // This will loop through each variable changing it once
     // to see how the other variables change.
     // There-by generating our co-variance
+    // The candidates are built first and then run as a single batch
+    // so they can be spread across threads
     if (clMinimiser.getResult() >= 1) { // 1 = Gradient Required
       long double dOrigValue;
-      long double dStepSizeI;
-      long double dScoreI;
+      vector<long double> vStepSizes(iVectorSize, 0.0);
+      vector<double> vPenalties;
+      vector<int> vCandidateIndexes;
+      vector<vector<double>> vCandidates;
 
       for (int i = 0; i < iVectorSize; ++i) {
         if (math::IsEqual(vLowerBounds[i], vUpperBounds[i])) {
@@ -189,24 +193,34 @@ double Engine::optimise_finite_differences(gammadiff::CallBack& objective, vecto
 
         } else {
           // Workout how much to change the variable by
-          dStepSizeI  = dStepSize * ((vScaledValues[i] > 0) ? 1 : -1);
+          vStepSizes[i]  = dStepSize * ((vScaledValues[i] > 0) ? 1 : -1);
 
           // Backup Orig Value, and Assign New Var
           dOrigValue        = vScaledValues[i];
-          vScaledValues[i]  += dStepSizeI;
-          dStepSizeI        = vScaledValues[i] - dOrigValue;
+          vScaledValues[i]  += vStepSizes[i];
+          vStepSizes[i]     = vScaledValues[i] - dOrigValue;
 
           dPenalty = 0.0;
           buildCurrentValues();
+          vCandidates.push_back(vCurrentValues);
+          vPenalties.push_back(dPenalty);
+          vCandidateIndexes.push_back(i);
 
-          dScoreI = objective(vCurrentValues);
-          dScoreI += dPenalty;
-
-          // Populate Gradient, and Restore Orig Value
-          vGradientValues[i]  = (dScoreI - dScore) / dStepSizeI;
+          // Restore Orig Value
           vScaledValues[i]    = dOrigValue;
         }
       }
+
+      vector<double> vScores(vCandidates.size(), 0.0);
+      objective(vCandidates, vScores);
+
+      // Populate Gradient
+      for (unsigned j = 0; j < vCandidates.size(); ++j) {
+        int i = vCandidateIndexes[j];
+        long double dScoreI = vScores[j];
+        dScoreI += vPenalties[j];
+        vGradientValues[i]  = (dScoreI - dScore) / vStepSizes[i];
+      }
       // Gradient Finished
     }
     // Call our Function Minimiser
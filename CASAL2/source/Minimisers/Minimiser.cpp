@@ -23,8 +23,10 @@
 #include <boost/numeric/ublas/lu.hpp>
 
 #include "../Estimates/Manager.h"
+#include "../EstimateTransformations/Manager.h"
 #include "../Logging/Logging.h"
 #include "../Model/Model.h"
+#include "../ThreadPool/ThreadPool.h"
 #include "../Utilities/Math.h"
 
 // Namespaces
@@ -43,6 +45,8 @@ Minimiser::Minimiser(shared_ptr<Model> model) : model_(model) {
   parameters_.Bind<string>(PARAM_TYPE, &type_, "The type of minimiser to use", "");
   parameters_.Bind<bool>(PARAM_ACTIVE, &active_, "Indicates if this minimiser is active", "", false);
   parameters_.Bind<bool>(PARAM_COVARIANCE, &build_covariance_, "Indicates if a covariance matrix should be generated", "", true);
+  parameters_.Bind<bool>(PARAM_NUMERICAL_HESSIAN, &numerical_hessian_, "Indicates if the hessian should be recalculated at the MPD with central finite differences", "", false);
+  parameters_.Bind<double>(PARAM_NUMERICAL_HESSIAN_STEP_SIZE, &numerical_hessian_step_size_, "The relative step size used when calculating the numerical hessian", "", 1e-4)->set_lower_bound(0.0, false);
 
   hessian_ = 0;
   hessian_size_ = 0;
@@ -88,6 +92,97 @@ void Minimiser::Build() {
   DoBuild();
 }
 
+/**
+ * Replace the hessian from the minimiser with one calculated by central finite
+ * differences at the current estimate values (the MPD). The hessian is in the
+ * same (transformed) space as the minimiser's hessian.
+ *
+ *   H(i,i) = (f(+h_i) - 2f(x) + f(-h_i)) / (h_i * h_i)
+ *   H(i,j) = (f(+h_i,+h_j) - f(+h_i,-h_j) - f(-h_i,+h_j) + f(-h_i,-h_j)) / (4 * h_i * h_j)
+ *
+ * Every candidate (1 + 2n + 2n(n-1) of them) is run as a single batch across
+ * the thread pool. Only the upper triangle is calculated and it is mirrored
+ * so the hessian is symmetric.
+ *
+ * @param thread_pool The thread pool to run the candidates with
+ */
+void Minimiser::BuildNumericalHessian(shared_ptr<ThreadPool> thread_pool) {
+  if (hessian_ == 0)
+    LOG_CODE_ERROR() << "Cannot build the numerical hessian as the hessian has not been allocated";
+
+  LOG_FINE() << "Building numerical hessian";
+  model_->managers()->estimate_transformation()->TransformEstimates();
+  vector<Estimate*> estimates = model_->managers()->estimate()->GetIsEstimated();
+  if (estimates.size() != hessian_size_)
+    LOG_CODE_ERROR() << "(estimates.size() != hessian_size_)";
+
+  unsigned n = hessian_size_;
+  vector<double> mpd(n, 0.0);
+  vector<double> step(n, 0.0);
+  for (unsigned i = 0; i < n; ++i) {
+    mpd[i] = AS_DOUBLE(estimates[i]->value());
+    double lower = AS_DOUBLE(estimates[i]->lower_bound());
+    double upper = AS_DOUBLE(estimates[i]->upper_bound());
+
+    // keep the step inside of the bounds so the model is still valid
+    step[i] = numerical_hessian_step_size_ * (fabs(mpd[i]) > 1.0 ? fabs(mpd[i]) : 1.0);
+    step[i] = (mpd[i] - lower) < step[i] ? (mpd[i] - lower) : step[i];
+    step[i] = (upper - mpd[i]) < step[i] ? (upper - mpd[i]) : step[i];
+    if (step[i] <= 0.0)
+      LOG_WARNING() << "The estimate " << estimates[i]->parameter() << " is on a bound so its row of the numerical hessian will be zero";
+  }
+
+  // Build our candidates: [0] is the MPD, then +h/-h for each parameter, then the
+  // 4 corner points for each pair of parameters (i < j)
+  vector<vector<double>> candidates;
+  candidates.reserve(1 + 2 * n + 2 * n * (n - 1));
+  candidates.push_back(mpd);
+  for (unsigned i = 0; i < n; ++i) {
+    for (double sign : { 1.0, -1.0 }) {
+      candidates.push_back(mpd);
+      candidates.back()[i] += sign * step[i];
+    }
+  }
+  for (unsigned i = 0; i < n; ++i) {
+    for (unsigned j = i + 1; j < n; ++j) {
+      for (double sign_i : { 1.0, -1.0 }) {
+        for (double sign_j : { 1.0, -1.0 }) {
+          candidates.push_back(mpd);
+          candidates.back()[i] += sign_i * step[i];
+          candidates.back()[j] += sign_j * step[j];
+        }
+      }
+    }
+  }
+
+  LOG_MEDIUM() << "Running " << candidates.size() << " candidates for the numerical hessian";
+  vector<double> scores(candidates.size(), 0.0);
+  thread_pool->RunCandidates(candidates, scores);
+
+  double score = scores[0];
+  for (unsigned i = 0; i < n; ++i) {
+    hessian_[i][i] = 0.0;
+    if (step[i] > 0.0)
+      hessian_[i][i] = (scores[1 + 2 * i] - 2.0 * score + scores[2 + 2 * i]) / (step[i] * step[i]);
+  }
+
+  unsigned index = 1 + 2 * n;
+  for (unsigned i = 0; i < n; ++i) {
+    for (unsigned j = i + 1; j < n; ++j, index += 4) {
+      double value = 0.0;
+      if (step[i] > 0.0 && step[j] > 0.0)
+        value = (scores[index] - scores[index + 1] - scores[index + 2] + scores[index + 3]) / (4.0 * step[i] * step[j]);
+      hessian_[i][j] = value;
+      hessian_[j][i] = value;
+    }
+  }
+
+  // The thread pool may have run candidates on our model, so put the MPD back
+  for (unsigned i = 0; i < n; ++i)
+    estimates[i]->set_value(mpd[i]);
+  model_->managers()->estimate_transformation()->RestoreEstimates();
+}
+
 /**
  * Build the covariance matrix to be used by our MCMC
  */
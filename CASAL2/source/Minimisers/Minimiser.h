@@ -55,6 +55,7 @@ public:
   void                        Build();
   void                        Reset() { DoReset(); };
   void                        BuildCovarianceMatrix();
+  void                        BuildNumericalHessian(shared_ptr<ThreadPool> thread_pool);
 
   // pure methods
   virtual void                DoValidate() = 0;
@@ -65,6 +66,7 @@ public:
 
   // Acessors
   bool                        active() const { return active_; }
+  bool                        numerical_hessian() const { return numerical_hessian_; }
   void                        set_active(bool new_value) { active_ = new_value; }
   ublas::matrix<double>&      covariance_matrix() { return covariance_matrix_; }
   ublas::matrix<double>&      correlation_matrix() { return correlation_matrix_; }
@@ -79,6 +81,8 @@ protected:
   double**                    hessian_ = nullptr;
   unsigned                    hessian_size_;
   bool                        build_covariance_;
+  bool                        numerical_hessian_;
+  double                      numerical_hessian_step_size_;
   ublas::matrix<double>       covariance_matrix_;
   ublas::matrix<double>       correlation_matrix_;
   MinimiserResult::Type       result_ = MinimiserResult::kInvalid;
@@ -252,4 +252,51 @@ void Managers::Reset() {
   time_varying_->Reset();
 }
 
+/**
+ * Check if the state of the model at the end of a year can be stored
+ * with SaveSnapshot(). This is only possible when every process stores
+ * the state it changes and none of the time varying objects draw new
+ * values each time the model is reset.
+ *
+ * @return true if the snapshot can be used
+ */
+bool Managers::SupportsSnapshot() {
+  for (auto process : process_->objects()) {
+    if (!process->supports_snapshot())
+      return false;
+  }
+
+  return !time_varying_->HasStochasticValues();
+}
+
+/**
+ * Store the state of the objects that change as the model is iterated
+ * through the years. Used by projections so the historical years
+ * only need to be run once.
+ */
+void Managers::SaveSnapshot() {
+  LOG_TRACE();
+  penalty_->SaveSnapshot();
+  for (auto derived_quantity : derived_quantity_->objects())
+    derived_quantity->SaveSnapshot();
+  for (auto process : process_->objects())
+    process->SaveSnapshot();
+  for (auto project : project_->objects())
+    project->SaveSnapshot();
+}
+
+/**
+ * Restore the state stored by SaveSnapshot()
+ */
+void Managers::RestoreSnapshot() {
+  LOG_TRACE();
+  penalty_->RestoreSnapshot();
+  for (auto derived_quantity : derived_quantity_->objects())
+    derived_quantity->RestoreSnapshot();
+  for (auto process : process_->objects())
+    process->RestoreSnapshot();
+  for (auto project : project_->objects())
+    project->RestoreSnapshot();
+}
+
 } /* namespace niwa */
@@ -90,6 +90,7 @@ public:
 
   void set_minimiser(shared_ptr<minimisers::Manager> manager) { minimiser_ = manager; }
   void set_reports(shared_ptr<reports::Manager> manager) { report_ = manager; }
+  bool                        SupportsSnapshot();
 
 protected:
   // methods
@@ -97,6 +98,8 @@ protected:
   void                        Validate();
   void                        Build();
   void                        Reset();
+  void                        SaveSnapshot();
+  void                        RestoreSnapshot();
 
   // members
   shared_ptr<Model>                   model_;
@@ -24,6 +24,7 @@
 #include "Factory.h"
 #include "Managers.h"
 #include "Objects.h"
+#include "SharedData.h"
 #include "../Categories/Categories.h"
 #include "../ConfigurationLoader/EstimableValuesLoader.h"
 #include "../ConfigurationLoader/MCMCObjective.h"
@@ -45,6 +46,7 @@
 #include "../Reports/Manager.h"
 #include "../Simulates/Manager.h"
 #include "../TimeSteps/Manager.h"
+#include "../ThreadPool/ThreadPool.h"
 #include "../TimeVarying/Manager.h"
 #include "../Utilities/RandomNumberGenerator.h"
 #include "../Utilities/To.h"
@@ -67,6 +69,8 @@ Model::Model() {
 		"Define the units for the base weight. This will be the default unit of any weight input parameters ", "grams, kgs or tonnes", PARAM_TONNES)->set_allowed_values(
 		{ PARAM_GRAMS, PARAM_TONNES, PARAM_KGS });
 	parameters_.Bind<unsigned>(PARAM_THREADS, &threads_, "The number of threads to use for this model", "", 1u)->set_lower_bound(1);
+	parameters_.Bind<bool>(PARAM_PROJECTION_REUSE_HISTORY, &reuse_projection_history_,
+		"Run the historical years once for each set of parameter values in projection mode and reuse them for the following projections. The reports from the historical years are then only produced for the first projection", "true, false", false);
 
 	global_configuration_ = new GlobalConfiguration();
 }
@@ -81,6 +85,7 @@ Model::~Model() {
 	delete categories_;
 	delete partition_;
 	delete objective_function_;
+	delete rng_;
 }
 
 /**
@@ -182,6 +187,17 @@ EquationParser& Model::equation_parser() {
 	return *equation_parser_;
 }
 
+/**
+ * Return the read-only data shared by the models on each thread.
+ * If we have not been given one by the Runner we create our own.
+ */
+shared_ptr<SharedData> Model::shared_data() {
+	if (!shared_data_)
+		shared_data_.reset(new SharedData());
+
+	return shared_data_;
+}
+
 Categories* Model::categories() {
 	if (categories_ == nullptr)
 		categories_ = new Categories(pointer());
@@ -189,6 +205,45 @@ Categories* Model::categories() {
 	return categories_;
 }
 
+/**
+ * Return the random number generator for this model. Each thread
+ * model has its own stream so they can draw random numbers at the same time.
+ * Models without their own stream (the master model) use the global generator.
+ */
+utilities::RandomNumberGenerator& Model::rng() {
+	if (rng_ == nullptr)
+		return utilities::RandomNumberGenerator::Instance();
+
+	return *rng_;
+}
+
+/**
+ * Seed the random number stream for this model. The stream is taken
+ * from the model id so the master model (id 1) is stream 0 and keeps using
+ * the global generator seeded with the master seed. Every other model
+ * gets its own generator seeded from the master seed and its stream number.
+ *
+ * @param seed The master random number seed
+ */
+void Model::set_random_number_seed(unsigned seed) {
+	unsigned stream = id_ > 1 ? id_ - 1 : 0;
+	delete rng_;
+	rng_ = nullptr;
+
+	if (stream == 0)
+		utilities::RandomNumberGenerator::Instance().Reset(seed);
+	else
+		rng_ = new utilities::RandomNumberGenerator(utilities::RandomNumberGenerator::StreamSeed(seed, stream));
+	LOG_FINE() << "Model " << id_ << " has random number stream " << stream << " with seed " << rng().seed();
+}
+
+/**
+ * Return the seed used for this model's random number stream
+ */
+unsigned Model::random_number_seed() {
+	return rng().seed();
+}
+
 /**
  * This method will prepare the model for iterations to be run.
  * This takes the model through the Startup, Validation and Build states.
@@ -201,7 +256,7 @@ bool Model::PrepareForIterations() {
 	LOG_TRACE();
 
 	Logging &logging = Logging::Instance();
-	if (logging.errors().size() > 0) {
+	if (logging.error_count() > 0) {
 		logging.FlushErrors();
 		return false;
 	}
@@ -232,7 +287,7 @@ bool Model::PrepareForIterations() {
 	LOG_FINE() << "Model: State Change to Validate";
 	state_ = State::kValidate;
 	Validate();
-	if (logging.errors().size() > 0) {
+	if (logging.error_count() > 0) {
 		logging.FlushErrors();
 		return false;
 	}
@@ -242,7 +297,7 @@ bool Model::PrepareForIterations() {
 	LOG_FINE() << "Model: State Change to Build";
 	state_ = State::kBuild;
 	Build();
-	if (logging.errors().size() > 0) {
+	if (logging.error_count() > 0) {
 		logging.FlushErrors();
 		return false;
 	}
@@ -251,7 +306,7 @@ bool Model::PrepareForIterations() {
 	LOG_FINE() << "Model: State Change to Verify";
 	state_ = State::kVerify;
 	Verify();
-	if (logging.errors().size() > 0) {
+	if (logging.error_count() > 0) {
 		logging.FlushErrors();
 		return false;
 	}
@@ -277,9 +332,11 @@ bool Model::Start(RunMode::Type run_mode) {
 	// TODO: Remove this later
 	/**
 	 * We're hacking this in for now because the unit tests do not know about
-	 * the runner and threading yet.
+	 * the runner and threading yet. Tests that create thread models have
+	 * already prepared the master model.
 	 */
-	PrepareForIterations();
+	if (state_ == State::kStartUp)
+		PrepareForIterations();
 #endif
 
 	LOG_TRACE();
@@ -440,6 +497,12 @@ void Model::Reset() {
 	partition_->Reset();
 	categories_->Reset();
 	managers_->Reset();
+
+	// Rebuild the mean lengths and age length proportions of the categories whose age length has changed
+	if (categories()->HasAgeLengths()) {
+		partition_->BuildMeanLengthData();
+		if (length_bins_.size() > 0) partition_->BuildAgeLengthProportions();
+	}
 }
 
 /**
@@ -449,108 +512,150 @@ void Model::RunBasic() {
 	LOG_TRACE();
 	Estimables &estimables = *managers_->estimables();
 	bool single_step = global_configuration_->single_step();
-	vector<string> single_step_addressables;
-	vector<Double*> estimable_targets;
-	// Create an instance of all categories
-	niwa::partition::accessors::All all_view(pointer());
+
+	/**
+	 * Each set of values in the -i file is independent so we can run them across the
+	 * thread pool. The first set is run here so any reports that print a header on their
+	 * first execution (e.g. tabular reports) still have it at the top of their output.
+	 * The reports manager then writes the output for the remaining sets in order.
+	 */
+	unsigned serial_values = adressable_values_count_;
+	if (thread_pool_ && thread_pool_->Threads().size() > 1 && !single_step && addressable_values_file_ && adressable_values_count_ > 1)
+		serial_values = 1;
 
 	// Model is about to run
-	for (unsigned i = 0; i < adressable_values_count_; ++i) {
+	for (unsigned i = 0; i < serial_values; ++i) {
 		if (addressable_values_file_) {
 			estimables.LoadValues(i);
 			Reset();
 		}
 
-		/**
-		 * Running the model now
-		 */
-		LOG_FINE() << "Model: State change to Execute";
-		state_ = State::kInitialise;
-		current_year_ = start_year_;
-		// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-			(*iterator)->UpdateMeanLengthData();
-		}
-		initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
-		init_phase_manager.Execute();
-		managers_->report()->Execute(pointer(), State::kInitialise);
+		RunBasicIteration();
+	}
 
-		state_ = State::kExecute;
+	if (serial_values == adressable_values_count_)
+		return;
+
+	auto reports = managers_->report();
+	reports->WaitForReportsToFinish();
+
+	vector<std::function<void(shared_ptr<Model>)>> tasks;
+	for (unsigned i = serial_values; i < adressable_values_count_; ++i) {
+		unsigned iteration = i - serial_values;
+		tasks.push_back([i, iteration, reports](shared_ptr<Model> model) {
+			reports->StartIteration(model, iteration, "");
+			model->managers_->estimables()->LoadValues(i);
+			model->Reset();
+			model->RunBasicIteration();
+			reports->EndIteration(model);
+		});
+	}
 
-		/**
-		 * Handle single step now
-		 */
+	reports->StartIterations();
+	thread_pool_->RunTasks(tasks);
+	reports->WaitForReportsToFinish();
+}
+
+/**
+ * Run a single iteration of the model from the start year to the final year
+ * calculating the observation scores and objective function.
+ */
+void Model::RunBasicIteration() {
+	bool single_step = global_configuration_->single_step();
+	vector<string> single_step_addressables;
+	vector<Double*> estimable_targets;
+	// Create an instance of all categories
+	niwa::partition::accessors::All all_view(pointer());
+
+	/**
+	 * Running the model now
+	 */
+	LOG_FINE() << "Model: State change to Execute";
+	state_ = State::kInitialise;
+	current_year_ = start_year_;
+	// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+	for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+		(*iterator)->UpdateMeanLengthData();
+	}
+	initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
+	init_phase_manager.Execute();
+	managers_->report()->Execute(pointer(), State::kInitialise);
+
+	state_ = State::kExecute;
+
+	/**
+	 * Handle single step now
+	 */
+	if (single_step) {
+		managers_->report()->Pause();
+		cout << "Please enter a space separated list of addressable names to be used during single step" << endl;
+		string line = "";
+		string error = "";
+
+		std::getline(std::cin, line);
+		managers_->report()->Resume();
+		boost::split(single_step_addressables, line, boost::is_any_of(" "));
+		for (string addressable : single_step_addressables) {
+			if (!objects().VerfiyAddressableForUse(addressable, addressable::kSingleStep, error)) {
+				LOG_FATAL()
+				<< "The addressable " << addressable << " could not be verified for use in a single-step basic run. Error was " << error;
+			}
+			Double *target = objects().GetAddressable(addressable);
+			estimable_targets.push_back(target);
+		}
+	}
+
+	timesteps::Manager &time_step_manager = *managers_->time_step();
+	timevarying::Manager &time_varying_manager = *managers_->time_varying();
+	for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+		LOG_FINE() << "Iteration year: " << current_year_;
 		if (single_step) {
 			managers_->report()->Pause();
-			cout << "Please enter a space separated list of addressable names to be used during single step" << endl;
+			cout << "Please enter space separated values for estimables for year: " << current_year_ << endl;
 			string line = "";
-			string error = "";
-
 			std::getline(std::cin, line);
 			managers_->report()->Resume();
-			boost::split(single_step_addressables, line, boost::is_any_of(" "));
-			for (string addressable : single_step_addressables) {
-				if (!objects().VerfiyAddressableForUse(addressable, addressable::kSingleStep, error)) {
-					LOG_FATAL()
-					<< "The addressable " << addressable << " could not be verified for use in a single-step basic run. Error was " << error;
-				}
-				Double *target = objects().GetAddressable(addressable);
-				estimable_targets.push_back(target);
+
+			vector<string> temp_values;
+			boost::split(temp_values, line, boost::is_any_of(" "));
+			if (temp_values.size() != estimable_targets.size()) {
+				LOG_FATAL()
+				<< "Number of values provided was " << temp_values.size() << " when we expected " << estimable_targets.size();
 			}
-		}
 
-		timesteps::Manager &time_step_manager = *managers_->time_step();
-		timevarying::Manager &time_varying_manager = *managers_->time_varying();
-		for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
-			LOG_FINE() << "Iteration year: " << current_year_;
-			if (single_step) {
-				managers_->report()->Pause();
-				cout << "Please enter space separated values for estimables for year: " << current_year_ << endl;
-				string line = "";
-				std::getline(std::cin, line);
-				managers_->report()->Resume();
-
-				vector<string> temp_values;
-				boost::split(temp_values, line, boost::is_any_of(" "));
-				if (temp_values.size() != estimable_targets.size()) {
+			for (unsigned i = 0; i < temp_values.size(); ++i) {
+				Double value = 0;
+				if (!utilities::To<string, Double>(temp_values[i], value)) {
 					LOG_FATAL()
-					<< "Number of values provided was " << temp_values.size() << " when we expected " << estimable_targets.size();
+					<< "Value " << temp_values[i] << " for the estimable " << single_step_addressables[i] << " is invalid";
 				}
 
-				for (unsigned i = 0; i < temp_values.size(); ++i) {
-					Double value = 0;
-					if (!utilities::To<string, Double>(temp_values[i], value)) {
-						LOG_FATAL()
-						<< "Value " << temp_values[i] << " for the estimable " << single_step_addressables[i] << " is invalid";
-					}
-
-					LOG_FINEST() << "Setting annual value for " << single_step_addressables[i] << " to " << value;
-					*estimable_targets[i] = value;
-				}
-			}
-			LOG_TRACE();
-			time_varying_manager.Update(current_year_);
-			LOG_FINEST() << "finishing update time varying now Update Category mean length and weight before beginning annual cycle";
-
-			// Iterate over all partition members and UpDate Mean Weight for this year.
-			for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-				(*iterator)->UpdateMeanLengthData();
+				LOG_FINEST() << "Setting annual value for " << single_step_addressables[i] << " to " << value;
+				*estimable_targets[i] = value;
 			}
+		}
+		LOG_TRACE();
+		time_varying_manager.Update(current_year_);
+		LOG_FINEST() << "finishing update time varying now Update Category mean length and weight before beginning annual cycle";
 
-			time_step_manager.Execute(current_year_);
+		// Iterate over all partition members and UpDate Mean Weight for this year.
+		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+			(*iterator)->UpdateMeanLengthData();
 		}
 
-		managers_->observation()->CalculateScores();
+		time_step_manager.Execute(current_year_);
+	}
+
+	managers_->observation()->CalculateScores();
 
-		for (auto executor : executors_[State::kExecute])
-			executor->Execute();
+	for (auto executor : executors_[State::kExecute])
+		executor->Execute();
 
-		// Model has finished so we can run finalise.
+	// Model has finished so we can run finalise.
 
-		LOG_FINE() << "Model: State change to Iteration Complete";
-		objective_function_->CalculateScore();
-		managers_->report()->Execute(pointer(), State::kIterationComplete);
-	}
+	LOG_FINE() << "Model: State change to Iteration Complete";
+	objective_function_->CalculateScore();
+	managers_->report()->Execute(pointer(), State::kIterationComplete);
 }
 
 /**
@@ -614,7 +719,21 @@ bool Model::RunMCMC() {
 		return false;
 	}
 
-	if (global_configuration_->resume()) {
+	if (global_configuration_->resume() && mcmc->checkpoint_file() != "") {
+		// the checkpoint holds the exact state of the chain, including the RNG
+		if (!mcmc->LoadCheckpoint()) {
+			logging.FlushErrors();
+			return false;
+		}
+
+	} else if (global_configuration_->resume()) {
+		if (global_configuration_->mcmc_objective_file() == "" || global_configuration_->mcmc_sample_file() == "") {
+			LOG_ERROR() << "Resuming an MCMC chain requires the objective-file and sample-file parameters, or a "
+				<< PARAM_CHECKPOINT_FILE << " on the @mcmc block";
+			logging.FlushErrors();
+			return false;
+		}
+
 		configuration::MCMCObjective objective_loader(pointer());
 		if (!objective_loader.LoadFile(global_configuration_->mcmc_objective_file())) return false;
 
@@ -622,7 +741,7 @@ bool Model::RunMCMC() {
 		if (!sample_loader.LoadFile(global_configuration_->mcmc_sample_file())) return false;
 
 		// reset RNG seed for resume
-		utilities::RandomNumberGenerator::Instance().Reset((unsigned int) time(NULL));
+		rng().Reset((unsigned int) time(NULL));
 
 	} else if (!global_configuration_->skip_estimation()) {
 		/**
@@ -715,7 +834,6 @@ void Model::RunSimulation() {
 		estimables->LoadValues(0);
 		Reset();
 	}
-	niwa::partition::accessors::All all_view(pointer());
 
 	int simulation_candidates = global_configuration_->simulation_candidates();
 	if (simulation_candidates < 1) {
@@ -723,6 +841,7 @@ void Model::RunSimulation() {
 		<< "The number of simulations specified at the command line parser must be at least one";
 	}
 	unsigned suffix_width = (unsigned) floor(log10((double) simulation_candidates + 1)) + 1;
+	vector<string> report_suffixes;
 	for (int i = 0; i < simulation_candidates; ++i) {
 		string report_suffix = ".";
 		unsigned iteration_width = (unsigned) floor(log10(i + 1)) + 1;
@@ -730,43 +849,87 @@ void Model::RunSimulation() {
 		unsigned diff = suffix_width - iteration_width;
 		report_suffix.append(diff, '0');
 		report_suffix.append(utilities::ToInline<unsigned, string>(i + 1));
-		managers_->report()->set_report_suffix(report_suffix);
+		report_suffixes.push_back(report_suffix);
+	}
 
-		Reset();
+	/**
+	 * Each iteration draws from its own random number stream so the simulated observations
+	 * do not depend on the number of threads or the order the iterations are picked up.
+	 * The first iteration uses the seed itself so a single simulation is unchanged.
+	 */
+	auto reports = managers_->report();
+	unsigned seed = random_number_seed();
+	if (!thread_pool_ || thread_pool_->Threads().size() == 1) {
+		for (int i = 0; i < simulation_candidates; ++i) {
+			rng().Reset(utilities::RandomNumberGenerator::StreamSeed(seed, i));
+			reports->set_report_suffix(report_suffixes[i]);
+			RunSimulationIteration();
+			reports->WaitForReportsToFinish();
+		}
+		return;
+	}
+
+	/**
+	 * Run the iterations across the thread pool. The reports manager holds the output of
+	 * each iteration and writes them in order with their own suffix.
+	 */
+	vector<std::function<void(shared_ptr<Model>)>> tasks;
+	for (int i = 0; i < simulation_candidates; ++i) {
+		string report_suffix = report_suffixes[i];
+		tasks.push_back([i, seed, report_suffix, reports](shared_ptr<Model> model) {
+			model->rng().Reset(utilities::RandomNumberGenerator::StreamSeed(seed, i));
+			reports->StartIteration(model, i, report_suffix);
+			if (model->addressable_values_file_)
+				model->managers_->estimables()->LoadValues(0);
+			model->RunSimulationIteration();
+			reports->EndIteration(model);
+		});
+	}
 
-		state_ = State::kInitialise;
-		current_year_ = start_year_;
+	reports->StartIterations();
+	thread_pool_->RunTasks(tasks);
+	reports->set_report_suffix(report_suffixes.back());
+	reports->WaitForReportsToFinish();
+}
+
+/**
+ * Run a single simulation iteration. This will reset the model, run the initialisation
+ * phases and then the annual cycle generating the simulated observations.
+ */
+void Model::RunSimulationIteration() {
+	niwa::partition::accessors::All all_view(pointer());
+	Reset();
+
+	state_ = State::kInitialise;
+	current_year_ = start_year_;
+	// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+	for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+		(*iterator)->UpdateMeanLengthData();
+	}
+
+	initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
+	init_phase_manager.Execute();
+	managers_->report()->Execute(pointer(), State::kInitialise);
+
+	state_ = State::kExecute;
+	timesteps::Manager &time_step_manager = *managers_->time_step();
+	timevarying::Manager &time_varying_manager = *managers_->time_varying();
+	for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+		LOG_FINE() << "Iteration year: " << current_year_;
+		time_varying_manager.Update(current_year_);
 		// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
 		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
 			(*iterator)->UpdateMeanLengthData();
 		}
+		managers_->simulate()->Update(current_year_);
+		time_step_manager.Execute(current_year_);
+	}
 
-		initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
-		init_phase_manager.Execute();
-		managers_->report()->Execute(pointer(), State::kInitialise);
-
-		state_ = State::kExecute;
-		timesteps::Manager &time_step_manager = *managers_->time_step();
-		timevarying::Manager &time_varying_manager = *managers_->time_varying();
-		for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
-			LOG_FINE() << "Iteration year: " << current_year_;
-			time_varying_manager.Update(current_year_);
-			// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-			for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-				(*iterator)->UpdateMeanLengthData();
-			}
-			managers_->simulate()->Update(current_year_);
-			time_step_manager.Execute(current_year_);
-		}
-
-		managers_->observation()->CalculateScores();
-
-		// Model has finished so we can run finalise.
-		LOG_FINE() << "Model: State change to PostExecute";
-		managers_->report()->Execute(pointer(), State::kIterationComplete);
+	managers_->observation()->CalculateScores();
 
-		managers_->report()->WaitForReportsToFinish();
-	}
+	// Model has finished so we can run finalise.
+	LOG_FINE() << "Model: State change to PostExecute";
+	managers_->report()->Execute(pointer(), State::kIterationComplete);
 }
 
 /**
@@ -780,87 +943,186 @@ void Model::RunProjection() {
 		LOG_FATAL()
 		<< "The number of projections specified at the command line parser must be at least one";
 	}
-	Estimables &estimables = *managers_->estimables();
-	vector<Double*> estimable_targets;
+
+	/**
+	 * Each candidate draws from its own random number stream so the projected values do
+	 * not depend on the number of threads. The first candidate uses the seed itself.
+	 */
+	auto reports = managers_->report();
+	unsigned seed = random_number_seed();
+
+	/**
+	 * Run the candidates across the thread pool. The projects are held by each
+	 * model's own projects manager so candidates running on different threads do not
+	 * share stored or projected values. The reports manager writes each candidate's
+	 * output in order, including when there is a single thread and the candidates
+	 * are run on this model.
+	 */
+	vector<std::function<void(shared_ptr<Model>)>> tasks;
+	unsigned candidate = 0;
+	for (unsigned i = 0; i < adressable_values_count_; ++i) {
+		for (int j = 0; j < projection_candidates; ++j, ++candidate) {
+			unsigned stream_seed = utilities::RandomNumberGenerator::StreamSeed(seed, candidate);
+			tasks.push_back([i, j, candidate, stream_seed, reports](shared_ptr<Model> model) {
+				model->rng().Reset(stream_seed);
+				reports->StartIteration(model, candidate, "");
+				model->RunProjectionCandidate(i, j == 0, stream_seed);
+				reports->EndIteration(model);
+			});
+		}
+	}
+
+	reports->StartIterations();
+	if (!thread_pool_ || thread_pool_->Threads().size() == 1) {
+		for (auto& task : tasks)
+			task(pointer());
+	} else
+		thread_pool_->RunTasks(tasks);
+	reports->WaitForReportsToFinish();
+	// Print the report to disk if tabular
+	//managers_->report()->Finalise();
+}
+
+/**
+ * Run a single projection candidate.
+ *
+ * The historical years are the same for every candidate using the same -i parameter
+ * values as long as none of the projects change a parameter before the final year, every
+ * process can store its state and none of the time varying objects draw random values.
+ * When this is the case and the user has turned on projection_reuse_history, the model state
+ * at the end of the historical years is stored after the first candidate and restored for
+ * the following candidates so only the projection years need to be run. The reports from
+ * the historical years are then only produced for the first candidate.
+ *
+ * Whether a candidate restores the stored state depends on which candidates were run
+ * before it on this model, so the random number stream is started again right before
+ * the projected values are drawn on both paths. The values drawn then only depend on
+ * the candidate and not on the number of threads.
+ *
+ * @param value_index The index of the -i parameter values to use
+ * @param first_candidate True if this is the first candidate for these parameter values
+ * @param stream_seed The seed of this candidate's random number stream
+ */
+void Model::RunProjectionCandidate(unsigned value_index, bool first_candidate, unsigned stream_seed) {
+	bool reuse_history = reuse_projection_history_ && managers_->SupportsSnapshot()
+			&& !managers_->project()->HasProjectedYearsBefore(final_year_ + 1);
+	if (!reuse_history || first_candidate || !has_projection_snapshot_ || projection_snapshot_index_ != value_index) {
+		RunProjectionHistory(value_index, stream_seed);
+		if (reuse_history) {
+			LOG_FINE() << "Storing the state of the model at the end of the historical years";
+			partition_->SaveSnapshot();
+			managers_->SaveSnapshot();
+			has_projection_snapshot_ = true;
+			projection_snapshot_index_ = value_index;
+
+			// The reports from the historical years are only kept for the first candidate
+			if (!first_candidate)
+				managers_->report()->DiscardIterationOutput(pointer());
+		}
+	} else {
+		LOG_FINE() << "Restoring the state of the model at the end of the historical years";
+		partition_->RestoreSnapshot();
+		managers_->RestoreSnapshot();
+		// Draw new values for the projected parameters
+		rng().Reset(stream_seed);
+		managers_->project()->Reset();
+	}
+
 	// Create an instance of all categories
 	niwa::partition::accessors::All all_view(pointer());
+	timesteps::Manager &time_step_manager = *managers_->time_step();
+	projects::Manager &project_manager = *managers_->project();
 
-	// Model is about to run
-	for (unsigned i = 0; i < adressable_values_count_; ++i) {
-		for (int j = 0; j < projection_candidates; ++j) {
-			LOG_FINE() << "Beginning initial model run for projections";
-			projection_final_phase_ = false;
-			if (addressable_values_file_) {
-				LOG_FINE() << "loading input parameters";
-				estimables.LoadValues(i);
-				Reset();
-			}
+	state_ = State::kExecute;
+	LOG_FINE() << "Starting projection years";
+	for (current_year_ = final_year_ + 1; current_year_ <= projection_final_year_; ++current_year_) {
+		LOG_FINE() << "Iteration year: " << current_year_;
+		// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+			(*iterator)->UpdateMeanLengthData();
+		}
+		project_manager.Update(current_year_);
+		time_step_manager.Execute(current_year_);
+	}
 
-			LOG_FINE() << "Model: State change to Execute";
-			state_ = State::kInitialise;
-			current_year_ = start_year_;
-			// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-			for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-				(*iterator)->UpdateMeanLengthData();
-			}
-			initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
-			init_phase_manager.Execute();
+	// Model has finished so we can run finalise.
+	LOG_FINE() << "Model: State change to PostExecute and iteration complete";
+	managers_->report()->Execute(pointer(), State::kIterationComplete);
+}
 
-			state_ = State::kExecute;
+/**
+ * Run the historical years for a projection. The model is run through the historical
+ * years storing the values of the projected parameters before being reset and run
+ * again through to the final year, ready for the projection years.
+ *
+ * @param value_index The index of the -i parameter values to use
+ * @param stream_seed The seed of the candidate's random number stream
+ */
+void Model::RunProjectionHistory(unsigned value_index, unsigned stream_seed) {
+	// Create an instance of all categories
+	niwa::partition::accessors::All all_view(pointer());
 
-			timesteps::Manager &time_step_manager = *managers_->time_step();
-			timevarying::Manager &time_varying_manager = *managers_->time_varying();
-			projects::Manager &project_manager = *managers_->project();
+	LOG_FINE() << "Beginning initial model run for projections";
+	projection_final_phase_ = false;
+	if (addressable_values_file_) {
+		LOG_FINE() << "loading input parameters";
+		managers_->estimables()->LoadValues(value_index);
+		Reset();
+	}
 
-			for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
-				LOG_FINE() << "Iteration year: " << current_year_;
-				time_varying_manager.Update(current_year_);
-				// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-				for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-					(*iterator)->UpdateMeanLengthData();
-				}
-				time_step_manager.Execute(current_year_);
-				project_manager.StoreValues(current_year_);
-			}
+	LOG_FINE() << "Model: State change to Execute";
+	state_ = State::kInitialise;
+	current_year_ = start_year_;
+	// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+	for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+		(*iterator)->UpdateMeanLengthData();
+	}
+	initialisationphases::Manager &init_phase_manager = *managers_->initialisation_phase();
+	init_phase_manager.Execute();
 
-			/**
-			 * Running the model now
-			 */
-			LOG_FINE() << "Entering the Projection Sub-System";
-			// Reset the model
-			projection_final_phase_ = true;
-			Reset();
-			state_ = State::kInitialise;
-			current_year_ = start_year_;
-			// Run the intialisation phase
-			init_phase_manager.Execute();
-			// Reset all parameter and re run the model
-			managers_->report()->Execute(pointer(), State::kInitialise);
-
-			state_ = State::kExecute;
-			LOG_FINE() << "Starting projection years";
-			for (; current_year_ <= projection_final_year_; ++current_year_) {
-				LOG_FINE() << "Iteration year: " << current_year_;
-				// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-				for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-					(*iterator)->UpdateMeanLengthData();
-				}
-				project_manager.Update(current_year_);
-				time_step_manager.Execute(current_year_);
-			}
+	state_ = State::kExecute;
 
-			// Model has finished so we can run finalise.
-			LOG_FINE() << "Model: State change to PostExecute and iteration complete";
-			managers_->report()->Execute(pointer(), State::kIterationComplete);
+	timesteps::Manager &time_step_manager = *managers_->time_step();
+	timevarying::Manager &time_varying_manager = *managers_->time_varying();
+	projects::Manager &project_manager = *managers_->project();
 
-			// Not sure if we need these
-			//managers_->observation()->CalculateScores();
-			//managers_->report()->WaitForReportsToFinish();
-			//Reset();
+	for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+		LOG_FINE() << "Iteration year: " << current_year_;
+		time_varying_manager.Update(current_year_);
+		// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+			(*iterator)->UpdateMeanLengthData();
 		}
+		time_step_manager.Execute(current_year_);
+		project_manager.StoreValues(current_year_);
+	}
+
+	/**
+	 * Running the model now
+	 */
+	LOG_FINE() << "Entering the Projection Sub-System";
+	// Reset the model
+	projection_final_phase_ = true;
+	rng().Reset(stream_seed);
+	Reset();
+	state_ = State::kInitialise;
+	current_year_ = start_year_;
+	// Run the intialisation phase
+	init_phase_manager.Execute();
+	// Reset all parameter and re run the model
+	managers_->report()->Execute(pointer(), State::kInitialise);
+
+	state_ = State::kExecute;
+	LOG_FINE() << "Starting historical years";
+	for (; current_year_ <= final_year_; ++current_year_) {
+		LOG_FINE() << "Iteration year: " << current_year_;
+		// Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+		for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+			(*iterator)->UpdateMeanLengthData();
+		}
+		project_manager.Update(current_year_);
+		time_step_manager.Execute(current_year_);
 	}
-	// Print the report to disk if tabular
-	//managers_->report()->Finalise();
 }
 
 /**
@@ -36,6 +36,9 @@ class Factory;
 class Partition;
 class ObjectiveFunction;
 class EquationParser;
+class SharedData;
+class ThreadPool;
+namespace utilities { class RandomNumberGenerator; }
 
 namespace State {
 enum Type {
@@ -112,6 +115,11 @@ public:
   unsigned										threads() const { return threads_; }
   bool												addressables_value_file() const { return addressable_values_file_; }
   void												set_run_mode(RunMode::Type run_mode) { run_mode_ = run_mode; }
+  void												set_thread_pool(shared_ptr<ThreadPool> thread_pool) { thread_pool_ = thread_pool; }
+  shared_ptr<ThreadPool>			thread_pool() const { return thread_pool_; }
+  void												set_shared_data(shared_ptr<SharedData> shared_data) { shared_data_ = shared_data; }
+  void												set_random_number_seed(unsigned seed);
+  unsigned										random_number_seed();
 
   // manager accessors
   virtual shared_ptr<Managers>	managers();
@@ -122,6 +130,8 @@ public:
   virtual Partition&          partition();
   virtual ObjectiveFunction&  objective_function();
   EquationParser&             equation_parser();
+  shared_ptr<SharedData>      shared_data();
+  utilities::RandomNumberGenerator& rng();
   shared_ptr<Model>						pointer() { return shared_from_this(); }
 
 protected:
@@ -132,11 +142,15 @@ protected:
   void                        Iterate();
   void                        Reset();
   void                        RunBasic();
+  void                        RunBasicIteration();
   void                        RunEstimation();
   bool                        RunMCMC();
   void                        RunProfiling();
   void                        RunSimulation();
+  void                        RunSimulationIteration();
   void                        RunProjection();
+  void                        RunProjectionCandidate(unsigned value_index, bool first_candidate, unsigned stream_seed);
+  void                        RunProjectionHistory(unsigned value_index, unsigned stream_seed);
 
   virtual void								DoValidate() { };
 
@@ -173,7 +187,13 @@ protected:
   Partition*                  partition_ = nullptr;
   ObjectiveFunction*          objective_function_ = nullptr;
   EquationParser*             equation_parser_ = nullptr;
+  utilities::RandomNumberGenerator* rng_ = nullptr;
+  shared_ptr<ThreadPool>			thread_pool_;
+  shared_ptr<SharedData>      shared_data_;
   bool                        projection_final_phase_ = false; // this parameter is for the projection classes. most of the methods are in the reset but they don't need to be applied
+  bool                        reuse_projection_history_ = false;
+  bool                        has_projection_snapshot_ = false;
+  unsigned                    projection_snapshot_index_ = 0;
   // if the model is in the first iteration and storeing values.
   map<State::Type, vector<Executor*>> executors_;
 };
@@ -95,8 +95,8 @@ void PiApproximation::FullIteration() {
 	double new_y = 0.0;
 
 	if (use_random_) {
-		new_x = utilities::RandomNumberGenerator::Instance().uniform(0, size_);
-		new_y = utilities::RandomNumberGenerator::Instance().uniform(0, size_);
+		new_x = rng().uniform(0, size_);
+		new_y = rng().uniform(0, size_);
 	} else {
 		new_x = managers()->selectivity()->GetSelectivity("X")->GetAgeResult(5, nullptr);
 		new_y = managers()->selectivity()->GetSelectivity("Y")->GetAgeResult(5, nullptr);
@@ -0,0 +1,59 @@
+/**
+ * @file SharedData.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "SharedData.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+// namespaces
+namespace niwa {
+
+using std::vector;
+
+/**
+ * Check nothing is found before it has been shared
+ */
+TEST(SharedData, Find_Missing) {
+  SharedData shared_data;
+  EXPECT_EQ(nullptr, shared_data.Find<vector<double>>("missing"));
+  EXPECT_EQ(0u, shared_data.size());
+}
+
+/**
+ * Check the first value shared with a key is the one every model gets
+ */
+TEST(SharedData, Share) {
+  SharedData shared_data;
+  auto first = shared_data.Share("table", vector<double>{ 1.0, 2.0, 3.0 });
+  ASSERT_NE(nullptr, first);
+  ASSERT_EQ(3u, first->size());
+  EXPECT_DOUBLE_EQ(2.0, (*first)[1]);
+
+  auto second = shared_data.Share("table", vector<double>{ 4.0 });
+  EXPECT_EQ(first.get(), second.get());
+  EXPECT_EQ(first.get(), shared_data.Find<vector<double>>("table").get());
+  EXPECT_EQ(1u, shared_data.size());
+}
+
+/**
+ * Check asking for a value with the wrong type is an error
+ */
+TEST(SharedData, Find_WrongType) {
+  SharedData shared_data;
+  shared_data.Share("table", vector<double>{ 1.0 });
+  EXPECT_THROW(shared_data.Find<vector<unsigned>>("table"), std::string);
+  EXPECT_THROW(shared_data.Share("table", vector<unsigned>{ 1u }), std::string);
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
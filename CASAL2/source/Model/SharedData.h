@@ -0,0 +1,107 @@
+/**
+ * @file SharedData.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds the read-only data that is part of the model definition
+ * (e.g. the rows of tables loaded from the configuration file) so it can be
+ * shared by the model on every thread instead of each one holding a copy.
+ *
+ * The master model builds the data first and shares it. The models for the
+ * other threads are given the same SharedData object, so when they are built
+ * they find the data has already been shared and use it.
+ *
+ * Values are stored as shared_ptr<const T>. Only data that never changes once
+ * the model has been built can go in here, anything that depends on an
+ * estimable has to stay with each model.
+ */
+#ifndef SOURCE_MODEL_SHAREDDATA_H_
+#define SOURCE_MODEL_SHAREDDATA_H_
+
+// headers
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <utility>
+
+#include "../Logging/Logging.h"
+
+// namespaces
+namespace niwa {
+using std::map;
+using std::shared_ptr;
+using std::string;
+
+/**
+ * Class definition
+ */
+class SharedData {
+public:
+  // methods
+  SharedData() = default;
+  virtual                     ~SharedData() = default;
+
+  /**
+   * Find a value that has already been shared
+   *
+   * @param key The key the value was shared with
+   * @return The value, or nullptr if nothing has been shared with this key
+   */
+  template<typename T>
+  shared_ptr<const T> Find(const string& key) const {
+    std::scoped_lock l(lock_);
+    auto iter = values_.find(key);
+    if (iter == values_.end())
+      return shared_ptr<const T>();
+    if (iter->second.first != std::type_index(typeid(T)))
+      LOG_CODE_ERROR() << "The shared data " << key << " was shared with a different type";
+
+    return std::static_pointer_cast<const T>(iter->second.second);
+  }
+
+  /**
+   * Share a value. If another model has already shared a value with
+   * this key then that value is returned and ours is discarded.
+   *
+   * @param key The key to share the value with
+   * @param value The value to share
+   * @return The shared value
+   */
+  template<typename T>
+  shared_ptr<const T> Share(const string& key, T&& value) {
+    shared_ptr<const T> new_value = std::make_shared<const T>(std::move(value));
+
+    std::scoped_lock l(lock_);
+    auto iter = values_.find(key);
+    if (iter == values_.end()) {
+      values_.emplace(key, std::make_pair(std::type_index(typeid(T)), shared_ptr<const void>(new_value)));
+      return new_value;
+    }
+
+    if (iter->second.first != std::type_index(typeid(T)))
+      LOG_CODE_ERROR() << "The shared data " << key << " was shared with a different type";
+    return std::static_pointer_cast<const T>(iter->second.second);
+  }
+
+  // accessors
+  unsigned size() const {
+    std::scoped_lock l(lock_);
+    return values_.size();
+  }
+
+private:
+  // members
+  mutable std::mutex          lock_;
+  map<string, std::pair<std::type_index, shared_ptr<const void>>> values_;
+};
+
+} /* namespace niwa */
+
+#endif /* SOURCE_MODEL_SHAREDDATA_H_ */
@@ -90,6 +90,10 @@ void Abundance::DoValidate() {
  * the labels for other objects are valid.
  */
 void Abundance::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYear(proportions_by_year_, years_, proportions_by_index_);
+  ResolveByYear(error_values_by_year_, years_, error_values_by_index_);
+
   catchability_ = model_->managers()->catchability()->GetCatchability(catchability_label_);
   if (!catchability_)
     LOG_ERROR_P(PARAM_CATCHABILITY) << ": catchability " << catchability_label_ << " could not be found. Have you defined it?";
@@ -147,12 +151,6 @@ void Abundance::Execute() {
   LOG_FINEST() << "Entering observation " << label_;
 
   Double expected_total = 0.0; // value in the model
-  vector<string> keys;
-  vector<Double> expecteds;
-  vector<Double> observeds;
-  vector<Double> error_values;
-  vector<Double> process_errors;
-  vector<Double> scores;
 
   Double selectivity_result = 0.0;
   Double start_value = 0.0;
@@ -161,18 +159,20 @@ void Abundance::Execute() {
   unsigned age = 0;
   Double error_value = 0.0;
 
-  unsigned current_year = model_->current_year();
-
   // Loop through the obs
   auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // auto = map<map<string, vector<partition::category&> > >
 
-  if (cached_partition_->Size() != proportions_by_year_[current_year].size())
+  unsigned year_index = YearIndex();
+  const vector<Double>& proportions = *proportions_by_index_[year_index];
+  error_value = error_values_by_index_[year_index];
+
+  if (cached_partition_->Size() != proportions.size())
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_.size()";
-  if (partition_->Size() != proportions_by_year_[current_year].size())
+  if (partition_->Size() != proportions.size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_.size()";
 
-  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned proportions_index = 0; proportions_index < proportions.size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
     expected_total = 0.0;
 
     auto category_iter = partition_iter->begin();
@@ -211,18 +211,9 @@ void Abundance::Execute() {
       LOG_FINEST() << "expected_total: " << expected_total << "; catchability_->q(): " << catchability_->q();
     }
 
-    error_value = error_values_by_year_[current_year];
-
     // Store the values
-    keys.push_back(category_labels_[proportions_index]);
-    expecteds.push_back(expected_total);
-    observeds.push_back(proportions_by_year_[current_year][proportions_index]);
-    error_values.push_back(error_value);
-    process_errors.push_back(process_error_value_);
+    SaveComparison(proportions_index, expected_total, proportions[proportions_index], process_error_value_, error_value, 0.0, delta_, 0.0);
   }
-
-  for (unsigned index = 0; index < observeds.size(); ++index)
-    SaveComparison(keys[index], expecteds[index], observeds[index], process_errors[index], error_values[index], 0.0, delta_, 0.0);
 }
 
 /**
@@ -245,12 +236,12 @@ void Abundance::CalculateScore() {
       // Recalculate the expectations by multiplying by the new Q
       for (auto year_iterator = comparisons_.begin();
           year_iterator != comparisons_.end(); ++year_iterator) {
-        for (obs::Comparison& comparison : year_iterator->second) {
+        for (Double& expected : year_iterator->second.expected_) {
           LOG_FINEST() << "---- Expected before nuisance Q applied = "
-              << comparison.expected_;
-          comparison.expected_ *= nuisance_catchability_->q();
+              << expected;
+          expected *= nuisance_catchability_->q();
           LOG_FINEST() << "---- Expected After nuisance Q applied = "
-              << comparison.expected_;
+              << expected;
 
         }
       }
@@ -258,10 +249,10 @@ void Abundance::CalculateScore() {
     likelihood_->SimulateObserved(comparisons_);
     for (auto& iter : comparisons_) {
       Double total = 0.0;
-      for (auto& comparison : iter.second)
-        total += comparison.observed_;
-      for (auto& comparison : iter.second)
-        comparison.observed_ /= total;
+      for (Double observed : iter.second.observed_)
+        total += observed;
+      for (Double& observed : iter.second.observed_)
+        observed /= total;
     }
   } else {
     /**
@@ -276,11 +267,11 @@ void Abundance::CalculateScore() {
       // Recalculate the expectations by multiplying by the new Q
       for (auto year_iterator = comparisons_.begin();
           year_iterator != comparisons_.end(); ++year_iterator) {
-        for (obs::Comparison& comparison : year_iterator->second) {
-          LOG_FINEST() << "---- Expected before nuisance Q applied = " << comparison.expected_;
-          comparison.expected_ *= nuisance_catchability_->q();
+        for (Double& expected : year_iterator->second.expected_) {
+          LOG_FINEST() << "---- Expected before nuisance Q applied = " << expected;
+          expected *= nuisance_catchability_->q();
           LOG_FINEST() << "---- Expected After nuisance Q applied = "
-              << comparison.expected_;
+              << expected;
 
         }
       }
@@ -289,8 +280,8 @@ void Abundance::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        scores_[year] += score;
       }
     }
   }
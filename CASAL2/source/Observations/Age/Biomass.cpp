@@ -114,6 +114,9 @@ void Biomass::DoValidate() {
  */
 void Biomass::DoBuild() {
   LOG_TRACE();
+  BuildYearIndexes(years_);
+  ResolveByYear(proportions_by_year_, years_, proportions_by_index_);
+  ResolveByYear(error_values_by_year_, years_, error_values_by_index_);
 
   catchability_ = model_->managers()->catchability()->GetCatchability(catchability_label_);
   if (!catchability_)
@@ -177,12 +180,6 @@ void Biomass::Execute() {
   unsigned time_step_index = model_->managers()->time_step()->current_time_step();
 
   Double expected_total = 0.0; // value in the model
-  vector<string> keys;
-  vector<Double> expecteds;
-  vector<Double> observeds;
-  vector<Double> error_values;
-  vector<Double> process_errors;
-  vector<Double> scores;
 
   Double selectivity_result = 0.0;
   Double start_value = 0.0;
@@ -192,24 +189,29 @@ void Biomass::Execute() {
   Double error_value = 0.0;
 
   unsigned current_year = model_->current_year();
+  bool use_age_weights = parameters_.Get(PARAM_AGE_WEIGHT_LABELS)->has_been_defined();
 
   // Loop through the obs
   auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // auto = map<map<string, vector<partition::category&> > >
 
-  if (cached_partition_->Size() != proportions_by_year_[current_year].size())
+  unsigned year_index = YearIndex();
+  const vector<Double>& proportions = *proportions_by_index_[year_index];
+  error_value = error_values_by_index_[year_index];
+
+  if (cached_partition_->Size() != proportions.size())
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_.size()";
-  if (partition_->Size() != proportions_by_year_[current_year].size())
+  if (partition_->Size() != proportions.size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_.size()";
 
-  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned proportions_index = 0; proportions_index < proportions.size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
     expected_total = 0.0;
 
     auto category_iter = partition_iter->begin();
     auto cached_category_iter = cached_partition_iter->begin();
     for (unsigned category_offset = 0; category_iter != partition_iter->end(); ++category_offset, ++cached_category_iter, ++category_iter) {
       //(*category_iter)->UpdateMeanWeightData();
-      if (!parameters_.Get(PARAM_AGE_WEIGHT_LABELS)->has_been_defined()) {
+      if (!use_age_weights) {
         // Use the age->length->weight calculation for weight
         for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
           age = (*category_iter)->min_age_ + data_offset;
@@ -261,18 +263,9 @@ void Biomass::Execute() {
       expected_total *= catchability_->q();
     }
 
-    error_value = error_values_by_year_[current_year];
-
     // Store the values
-    keys.push_back(category_labels_[proportions_index]);
-    expecteds.push_back(expected_total);
-    observeds.push_back(proportions_by_year_[current_year][proportions_index]);
-    error_values.push_back(error_value);
-    process_errors.push_back(process_error_value_);
+    SaveComparison(proportions_index, expected_total, proportions[proportions_index], process_error_value_, error_value,0.0, delta_, 0.0);
   }
-
-  for (unsigned index = 0; index < observeds.size(); ++index)
-    SaveComparison(keys[index], expecteds[index], observeds[index], process_errors[index], error_values[index],0.0, delta_, 0.0);
 }
 
 /**
@@ -294,10 +287,10 @@ void Biomass::CalculateScore() {
     LOG_FINE() << "Q = " << nuisance_catchability_->q();
     // Recalculate the expectations by multiplying by the new Q
     for (auto year_iterator = comparisons_.begin(); year_iterator != comparisons_.end(); ++year_iterator) {
-      for (obs::Comparison& comparison : year_iterator->second) {
-        LOG_FINEST() << "---- Expected before nuisance Q applied = " << comparison.expected_;
-        comparison.expected_ *= nuisance_catchability_->q();
-        LOG_FINEST() << "---- Expected After nuisance Q applied = " << comparison.expected_;
+      for (Double& expected : year_iterator->second.expected_) {
+        LOG_FINEST() << "---- Expected before nuisance Q applied = " << expected;
+        expected *= nuisance_catchability_->q();
+        LOG_FINEST() << "---- Expected After nuisance Q applied = " << expected;
 
       }
     }
@@ -317,10 +310,10 @@ void Biomass::CalculateScore() {
       LOG_FINE() << "Q = " << nuisance_catchability_->q();
       // Recalculate the expectations by multiplying by the new Q
       for (auto year_iterator = comparisons_.begin(); year_iterator != comparisons_.end(); ++year_iterator) {
-        for (obs::Comparison& comparison : year_iterator->second) {
-          LOG_FINEST() << "---- Expected before nuisance Q applied = " << comparison.expected_;
-          comparison.expected_ *= nuisance_catchability_->q();
-          LOG_FINEST() << "---- Expected After nuisance Q applied = " << comparison.expected_;
+        for (Double& expected : year_iterator->second.expected_) {
+          LOG_FINEST() << "---- Expected before nuisance Q applied = " << expected;
+          expected *= nuisance_catchability_->q();
+          LOG_FINEST() << "---- Expected After nuisance Q applied = " << expected;
 
         }
       }
@@ -329,8 +322,8 @@ void Biomass::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        scores_[year] += score;
       }
     }
   }
@@ -53,6 +53,8 @@ protected:
   vector<unsigned>                years_;
   map<unsigned, vector<Double> >  proportions_by_year_;
   map<unsigned, Double>           error_values_by_year_;
+  vector<const vector<Double>*>   proportions_by_index_;
+  vector<Double>                  error_values_by_index_;
   vector<Double>                  error_values_;
   string                          catchability_label_;
   Catchability*                   catchability_ = nullptr;
@@ -114,13 +114,13 @@ void ProcessRemovalsByAge::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     if (obs_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -146,13 +146,13 @@ void ProcessRemovalsByAge::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_FATAL_P(PARAM_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -218,6 +218,11 @@ void ProcessRemovalsByAge::DoValidate() {
  * the labels for other objects are valid.
  */
 void ProcessRemovalsByAge::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
 
   // Create a pointer to misclassification matrix
@@ -308,57 +313,63 @@ void ProcessRemovalsByAge::Execute() {
 
 		unsigned year = model_->current_year();
 		map<unsigned,map<string, map<string, vector<Double>>>> &Removals_at_age = mortality_instantaneous_->catch_at();
+		map<string, map<string, vector<Double>>>& year_removals = Removals_at_age[year];
+		unsigned year_index = YearIndex();
+		Double process_error = process_errors_by_index_[year_index];
 
 		auto partition_iter = partition_->Begin(); // vector<vector<partition::Category> >
 		for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
-			vector<Double> expected_values(age_spread_, 0.0);
-			vector<Double> accumulated_expected_values(age_spread_, 0.0);
+			vector<Double>& expected_values             = WorkBuffer(0, age_spread_);
+			vector<Double>& accumulated_expected_values = WorkBuffer(1, age_spread_);
+			const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+			const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
 			LOG_FINEST() << "Category = " << category_labels_[category_offset];
 			auto category_iter = partition_iter->begin();
 			for (; category_iter != partition_iter->end(); ++category_iter) {
 				// Go through all the fisheries and accumulate the expectation whilst also applying ageing error
 				unsigned method_offset = 0;
-				for (string fishery : method_) {
+				for (const string& fishery : method_) {
+					vector<Double>& removals = year_removals[fishery][(*category_iter)->name_];
 				  // This should get caught in the DoBuild now.
-					if (Removals_at_age[year][fishery][(*category_iter)->name_].size() == 0) {
+					if (removals.size() == 0) {
 						LOG_FATAL() << "There is no catch at age data in year " << year << " for method " << fishery << " applied to category = " << (*category_iter)->name_ << " please check that your mortality_instantaneous process '" << process_label_<< "' is comparable with the observation " << label_;
 					}
 					/*
 					 *  Apply Ageing error on Removals at age vector
 					 */
 					if (ageing_error_label_ != "") {
-						vector < vector < Double >> &mis_matrix = ageing_error_->mis_matrix();
-						vector<Double> temp(Removals_at_age[year][fishery][(*category_iter)->name_].size(), 0.0);
+						const vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
+						vector<Double>& temp = WorkBuffer(2, removals.size());
 						LOG_FINEST() << "category = " << (*category_iter)->name_;
-						LOG_FINEST() << "size = " << Removals_at_age[year][fishery][(*category_iter)->name_].size();
+						LOG_FINEST() << "size = " << removals.size();
 
 						for (unsigned i = 0; i < mis_matrix.size(); ++i) {
 							for (unsigned j = 0; j < mis_matrix[i].size(); ++j) {
-								temp[j] += Removals_at_age[year][fishery][(*category_iter)->name_][i] * mis_matrix[i][j];
+								temp[j] += removals[i] * mis_matrix[i][j];
 							}
 						}
-						Removals_at_age[year][fishery][(*category_iter)->name_] = temp;
+						removals = temp;
 					}
 					LOG_TRACE();
 					/*
 					 *  Now collapse the number_age into the expected_values for the observation
 					 */
-					for (unsigned k = 0; k < Removals_at_age[year][fishery][(*category_iter)->name_].size(); ++k) {
+					for (unsigned k = 0; k < removals.size(); ++k) {
 						LOG_FINE() << "----------";
 						LOG_FINE() << "Fishery: " << fishery;
-						LOG_FINE() << "Numbers At Age After Ageing error: " << (*category_iter)->min_age_ + k << "for category " << (*category_iter)->name_ << " " << Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						LOG_FINE() << "Numbers At Age After Ageing error: " << (*category_iter)->min_age_ + k << "for category " << (*category_iter)->name_ << " " << removals[k];
 
 						unsigned age_offset = min_age_ - model_->min_age();
 						if (k >= age_offset && (k - age_offset + min_age_) <= max_age_)
-						expected_values[k - age_offset] = Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						expected_values[k - age_offset] = removals[k];
 						// Deal with the plus group
 						if (((k - age_offset + min_age_) > max_age_) && plus_group_)
-						expected_values[age_spread_ - 1] += Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						expected_values[age_spread_ - 1] += removals[k];
 					}
 
-					if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+					if (expected_values.size() != proportions.size())
 					LOG_CODE_ERROR()<< "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-					<< proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+					<< proportions.size() << ")";
 
 					// Accumulate the expectations if they come form multiple fisheries
 					for (unsigned i = 0; i < expected_values.size(); ++i)
@@ -374,9 +385,9 @@ void ProcessRemovalsByAge::Execute() {
 			for (unsigned i = 0; i < expected_values.size(); ++i) {
 				LOG_FINEST() << "-----";
 				LOG_FINEST() << "Numbers at age for category: " << category_labels_[category_offset] << " for age " << min_age_ + i << " = " << accumulated_expected_values[i];
-				SaveComparison(category_labels_[category_offset], min_age_ + i, 0.0, accumulated_expected_values[i],
-				proportions_[model_->current_year()][category_labels_[category_offset]][i], process_errors_by_year_[model_->current_year()],
-				error_values_[model_->current_year()][category_labels_[category_offset]][i],0.0, delta_, 0.0);
+				SaveComparison(category_offset, min_age_ + i, 0.0, accumulated_expected_values[i],
+				proportions[i], process_error,
+				error_values[i],0.0, delta_, 0.0);
 			}
 		}
 	}
@@ -396,18 +407,18 @@ void ProcessRemovalsByAge::CalculateScore() {
 
     for (auto& iter : comparisons_) {
       Double total_expec = 0.0;
-      for (auto& comparison : iter.second)
-        total_expec += comparison.expected_;
-      for (auto& comparison : iter.second)
-        comparison.expected_ /= total_expec;
+      for (Double expected : iter.second.expected_)
+        total_expec += expected;
+      for (Double& expected : iter.second.expected_)
+        expected /= total_expec;
     }
     likelihood_->SimulateObserved(comparisons_);
     for (auto& iter : comparisons_) {
       Double total = 0.0;
-      for (auto& comparison : iter.second)
-        total += comparison.observed_;
-      for (auto& comparison : iter.second)
-        comparison.observed_ /= total;
+      for (Double observed : iter.second.observed_)
+        total += observed;
+      for (Double& observed : iter.second.observed_)
+        observed /= total;
     }
   } else {
     /**
@@ -417,14 +428,14 @@ void ProcessRemovalsByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
-        running_total += comparison.expected_;
+      for (Double expected : comparisons_[year].expected_) {
+        running_total += expected;
       }
-      for (obs::Comparison& comparison : comparisons_[year]) {
+      for (Double& expected : comparisons_[year].expected_) {
         if (running_total != 0.0)
-          comparison.expected_ = comparison.expected_ / running_total;
+          expected = expected / running_total;
         else
-          comparison.expected_ = 0.0;
+          expected = 0.0;
       }
     }
 
@@ -435,10 +446,10 @@ void ProcessRemovalsByAge::CalculateScore() {
       LOG_FINEST() << "-- Observation score calculation";
       LOG_FINEST() << "[" << year << "] Initial Score:" << scores_[year];
 
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (Double score : comparisons_[year].score_) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: "
-            << comparison.score_;
-        scores_[year] += comparison.score_;
+            << score;
+        scores_[year] += score;
       }
     }
   }
@@ -119,12 +119,12 @@ void ProcessRemovalsByLength::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = number_bins_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size() << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     if (obs_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected << " to match the number bins * categories + 1 (for year)";
     }
@@ -148,13 +148,13 @@ void ProcessRemovalsByLength::DoValidate() {
     /**
      * Build our error value map
      */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_FATAL_P(PARAM_ERROR_VALUES)<< " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
     << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected << " to match the number bins * categories + 1 (for year)";
     }
@@ -217,6 +217,11 @@ void ProcessRemovalsByLength::DoValidate() {
  * the labels for other objects are valid.
  */
 void ProcessRemovalsByLength::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
 
@@ -274,9 +279,9 @@ void ProcessRemovalsByLength::PreExecute() {
 
   cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size())
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR()<< "cached_partition_->Size() != proportions_[model->current_year()].size()";
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR()<< "partition_->Size() != proportions_[model->current_year()].size()";
   }
 
@@ -295,6 +300,9 @@ void ProcessRemovalsByLength::Execute() {
   auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // vector<vector<partition::Category> >
   map<unsigned, map<string, map<string, vector<Double>>>> &Removals_at_age = mortality_instantaneous_->catch_at();
+  map<string, vector<Double>>& method_removals = Removals_at_age[year][method_];
+  unsigned obs_year_index = YearIndex(); // index in to our years, not the model years
+  Double process_error = process_errors_by_index_[obs_year_index];
 
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -307,10 +315,7 @@ void ProcessRemovalsByLength::Execute() {
     Double end_value = 0.0;
     Double number_at_age = 0.0;
 
-//    LOG_WARNING() << "This is bad code because it allocates memory in the middle of an execute";
-    vector<Double> expected_values(number_bins_, 0.0);
-    vector<Double> numbers_at_length;
-    vector<vector<Double>> age_length_matrix;
+    vector<Double>& expected_values = WorkBuffer(0, number_bins_);
 
     /**
      * Loop through the 2 combined categories building up the
@@ -321,17 +326,18 @@ void ProcessRemovalsByLength::Execute() {
     for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
 //      AgeLength* age_length = categories->age_length((*category_iter)->name_);
 
-//      LOG_WARNING() << "This is bad code because it allocates memory in the middle of an execute";
-      age_length_matrix.resize((*category_iter)->data_.size());
+      if ((*category_iter)->data_.size() == 0)
+        LOG_CODE_ERROR()<< "if ((*category_iter)->data_.size() == 0)";
 
-      vector<Double> age_frequencies(length_bins_.size(), 0.0);
-      const auto& age_length_proportions = model_->partition().age_length_proportions((*category_iter)->name_)[year_index][time_step];
+      vector<Double>& numbers_at_length = WorkBuffer(1, number_bins_);
+      const auto& age_length_proportions = model_->partition().age_length_proportions((*category_iter)->name_);
+      const vector<Double>& removals = method_removals[(*category_iter)->name_];
 
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         unsigned age = ((*category_iter)->min_age_ + data_offset);
 
         // Calculate the age structure removed from the fishing process
-        number_at_age = Removals_at_age[year][method_][(*category_iter)->name_][data_offset];
+        number_at_age = removals[data_offset];
         LOG_FINEST() << "Numbers at age = " << age << " = " << number_at_age << " start value : " << start_value << " end value : " << end_value;
         // Implement an algorithm similar to DoAgeLengthConversion() to convert numbers at age to numbers at length
         // This is different to DoAgeLengthConversion as this number is now not related to the partition
@@ -340,24 +346,12 @@ void ProcessRemovalsByLength::Execute() {
 //        LOG_FINEST() << "mean = " << mu << " cv = " << age_length->cv(year, time_step, age) << " distribution = " << age_length->distribution_label() << " and length plus group = " << length_plus_;
 //        age_length->CummulativeNormal(mu, age_length->cv(year, time_step, age), age_frequencies, length_bins_, length_plus_);
 
-//        LOG_WARNING() << "This is bad code because it allocates memory in the middle of an execute";
-        age_length_matrix[data_offset].resize(number_bins_);
-
         // Loop through the length bins and multiple the partition of the current age to go from
-        // length frequencies to age length numbers
+        // length frequencies to numbers at length
+        const Double* proportions_at_length = age_length_proportions(year_index, time_step, data_offset);
         for (unsigned j = 0; j < number_bins_; ++j) {
-          age_length_matrix[data_offset][j] = number_at_age * age_length_proportions[data_offset][j];
-          LOG_FINEST() << "The proportion of fish in length bin : " << length_bins_[j] << " = " << age_frequencies[j];
-        }
-      }
-
-      if (age_length_matrix.size() == 0)
-        LOG_CODE_ERROR()<< "if (age_length_matrix_.size() == 0)";
-
-      numbers_at_length.assign(age_length_matrix[0].size(), 0.0);
-      for (unsigned i = 0; i < age_length_matrix.size(); ++i) {
-        for (unsigned j = 0; j < age_length_matrix[i].size(); ++j) {
-          numbers_at_length[j] += age_length_matrix[i][j];
+          numbers_at_length[j] += number_at_age * proportions_at_length[j];
+          LOG_FINEST() << "The proportion of fish in length bin : " << length_bins_[j] << " = " << proportions_at_length[j];
         }
       }
 
@@ -372,16 +366,18 @@ void ProcessRemovalsByLength::Execute() {
       }
     }
 
-    if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[obs_year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[obs_year_index][category_offset];
+    if (expected_values.size() != proportions.size())
       LOG_CODE_ERROR()<< "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-      << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+      << proportions.size() << ")";
 
       /**
        * save our comparisons so we can use them to generate the score from the likelihoods later
        */
     for (unsigned i = 0; i < expected_values.size(); ++i) {
-      SaveComparison(category_labels_[category_offset], 0, length_bins_[i], expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+      SaveComparison(category_offset, 0, length_bins_[i], expected_values[i], proportions[i],
+          process_error, error_values[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -401,10 +397,10 @@ void ProcessRemovalsByLength::CalculateScore() {
     likelihood_->SimulateObserved(comparisons_);
     for (auto& iter : comparisons_) {
       Double total = 0.0;
-      for (auto& comparison : iter.second)
-        total += comparison.observed_;
-      for (auto& comparison : iter.second)
-        comparison.observed_ /= total;
+      for (Double observed : iter.second.observed_)
+        total += observed;
+      for (Double& observed : iter.second.observed_)
+        observed /= total;
     }
   } else {
     /**
@@ -412,14 +408,14 @@ void ProcessRemovalsByLength::CalculateScore() {
      */
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
-        running_total += comparison.expected_;
+      for (Double expected : comparisons_[year].expected_) {
+        running_total += expected;
       }
-      for (obs::Comparison& comparison : comparisons_[year]) {
+      for (Double& expected : comparisons_[year].expected_) {
         if (running_total != 0.0)
-          comparison.expected_ = comparison.expected_ / running_total;
+          expected = expected / running_total;
         else
-          comparison.expected_ = 0.0;
+          expected = 0.0;
       }
     }
     likelihood_->GetScores(comparisons_);
@@ -427,9 +423,9 @@ void ProcessRemovalsByLength::CalculateScore() {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       LOG_FINEST() << "-- Observation score calculation";
       LOG_FINEST() << "[" << year << "] Initial Score:" << scores_[year];
-      for (obs::Comparison comparison : comparisons_[year]) {
-        LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        LOG_FINEST() << "[" << year << "]+ likelihood score: " << score;
+        scores_[year] += score;
       }
     }
   }
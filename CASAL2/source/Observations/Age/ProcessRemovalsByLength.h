@@ -68,6 +68,9 @@ protected:
 
   map<unsigned, map<string, vector<Double>>> proportions_;
   map<unsigned, map<string, vector<Double>>> error_values_;
+  vector<vector<const vector<Double>*>>      proportions_by_index_; // [year_index][category_index]
+  vector<vector<const vector<Double>*>>      error_values_by_index_;
+  vector<Double>                             process_errors_by_index_;
 };
 
 } /* namespace age */
@@ -115,13 +115,13 @@ void ProportionsAtAge::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     if (obs_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -146,13 +146,13 @@ void ProportionsAtAge::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -218,6 +218,11 @@ void ProportionsAtAge::DoValidate() {
  */
 void ProportionsAtAge::DoBuild() {
 	LOG_TRACE();
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
 
@@ -263,9 +268,9 @@ void ProportionsAtAge::PreExecute() {
 	LOG_TRACE();
   cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size())
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
 }
 
@@ -287,6 +292,8 @@ void ProportionsAtAge::Execute() {
    * compare it to the observations.
    */
   unsigned selectivity_iter = 0;
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
 
   LOG_FINEST() << "Number of categories " << category_labels_.size();
   for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter, ++selectivity_iter) {
@@ -295,8 +302,8 @@ void ProportionsAtAge::Execute() {
     Double      end_value          = 0.0;
     Double      final_value        = 0.0;
 
-    vector<Double> expected_values(age_spread_, 0.0);
-    vector<Double> numbers_age((model_->age_spread() + 1), 0.0);
+    vector<Double>& expected_values = WorkBuffer(0, age_spread_);
+    vector<Double>& numbers_age     = WorkBuffer(1, model_->age_spread() + 1);
 
     /**
      * Loop through the 2 combined categories building up the
@@ -341,15 +348,15 @@ void ProportionsAtAge::Execute() {
     *  Apply Ageing error on numbers at age
     */
     if (ageing_error_label_ != "") {
-      vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
-      vector<Double> temp(numbers_age.size(), 0.0);
+      const vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
+      vector<Double>& temp = WorkBuffer(2, numbers_age.size());
 
       for (unsigned i = 0; i < mis_matrix.size(); ++i) {
         for (unsigned j = 0; j < mis_matrix[i].size(); ++j) {
           temp[j] += numbers_age[i] * mis_matrix[i][j];
         }
       }
-      numbers_age = temp;
+      numbers_age.swap(temp);
     }
 
     /*
@@ -368,20 +375,19 @@ void ProportionsAtAge::Execute() {
     }
 
 
-    if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
+    if (expected_values.size() != proportions.size())
       LOG_CODE_ERROR() << "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-        << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << proportions.size() << ")";
 
 
     for (unsigned i = 0; i < expected_values.size(); ++i) {
       LOG_FINEST() << "-----";
       LOG_FINEST() << "Numbers at age for all categories in age " << min_age_ + i << " = " << expected_values[i];
-	  double error_value_temp = error_values_[model_->current_year()][category_labels_[category_offset]][i];
-	  auto x = error_values_[model_->current_year()];
-	  auto y = error_values_[model_->current_year()][category_labels_[category_offset]];	  
 
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_value_temp, 0.0, delta_, 0.0);
+      SaveComparison(category_offset, min_age_ + i ,0.0 ,expected_values[i], proportions[i],
+          process_error, error_values[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -400,18 +406,18 @@ void ProportionsAtAge::CalculateScore() {
   if (model_->run_mode() == RunMode::kSimulation) {
     for (auto& iter :  comparisons_) {
       Double total_expec = 0.0;
-      for (auto& comparison : iter.second)
-        total_expec += comparison.expected_;
-      for (auto& comparison : iter.second)
-        comparison.expected_ /= total_expec;
+      for (Double expected : iter.second.expected_)
+        total_expec += expected;
+      for (Double& expected : iter.second.expected_)
+        expected /= total_expec;
     }
     likelihood_->SimulateObserved(comparisons_);
     for (auto& iter :  comparisons_) {
       Double total = 0.0;
-      for (auto& comparison : iter.second)
-        total += comparison.observed_;
-      for (auto& comparison : iter.second)
-        comparison.observed_ /= total;
+      for (Double observed : iter.second.observed_)
+        total += observed;
+      for (Double& observed : iter.second.observed_)
+        observed /= total;
     }
   } else {
     /**
@@ -419,14 +425,14 @@ void ProportionsAtAge::CalculateScore() {
      */
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
-        running_total += comparison.expected_;
+      for (Double expected : comparisons_[year].expected_) {
+        running_total += expected;
       }
-      for (obs::Comparison& comparison : comparisons_[year]) {
+      for (Double& expected : comparisons_[year].expected_) {
         if (running_total != 0.0)
-          comparison.expected_  = comparison.expected_ / running_total;
+          expected  = expected / running_total;
         else
-          comparison.expected_  = 0.0;
+          expected  = 0.0;
       }
     }
     likelihood_->GetScores(comparisons_);
@@ -434,9 +440,9 @@ void ProportionsAtAge::CalculateScore() {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       LOG_FINEST() << "-- Observation score calculation " << label_;
       LOG_FINEST() << "[" << year << "] Initial Score:"<< scores_[year];
-      for (obs::Comparison comparison : comparisons_[year]) {
-        LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        LOG_FINEST() << "[" << year << "]+ likelihood score: " << score;
+        scores_[year] += score;
       }
     }
   	LOG_FINEST() << "Finished calculating score for = " << label_;
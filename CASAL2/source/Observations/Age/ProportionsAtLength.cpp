@@ -96,13 +96,13 @@ void ProportionsAtLength::DoValidate() {
    */
   unsigned number_bins = model_->length_plus() ? model_->length_bins().size() : model_->length_bins().size() - 1;
   unsigned obs_expected = (category_labels_.size() * number_bins) + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     for (auto x : obs_data_line)
     if (obs_data_line.size() != obs_expected) {
       LOG_FATAL_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected
@@ -129,13 +129,13 @@ void ProportionsAtLength::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the number bins * categories + 1 (for year)";
@@ -197,6 +197,11 @@ void ProportionsAtLength::DoValidate() {
  * the labels for other objects are valid.
  */
 void ProportionsAtLength::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
 
@@ -227,9 +232,9 @@ void ProportionsAtLength::DoBuild() {
 void ProportionsAtLength::PreExecute() {
   cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size())
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
 }
 
@@ -246,7 +251,9 @@ void ProportionsAtLength::Execute() {
   auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
   unsigned number_bins = model_->length_plus() ? model_->length_bins().size() : model_->length_bins().size() - 1;
-  auto length_bins = model_->length_bins();
+  const auto& length_bins = model_->length_bins();
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
 
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -258,7 +265,7 @@ void ProportionsAtLength::Execute() {
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
     Double      final_value        = 0.0;
-    vector<Double> expected_values(number_bins, 0.0);
+    vector<Double>& expected_values = WorkBuffer(0, number_bins);
 
     /**
      * Loop through the 2 combined categories building up the
@@ -293,16 +300,18 @@ void ProportionsAtLength::Execute() {
         LOG_FINE() << "expected_value becomes: " << expected_values[length_offset];
       }
     }
-    if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
+    if (expected_values.size() != proportions.size())
       LOG_CODE_ERROR() << "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-        << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << proportions.size() << ")";
 
     /**
      * save our comparisons so we can use them to generate the score from the likelihoods later
      */
     for (unsigned i = 0; i < expected_values.size(); ++i) {
-      SaveComparison(category_labels_[category_offset], 0, length_bins[i], expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i],0.0, delta_, 0.0);
+      SaveComparison(category_offset, 0, length_bins[i], expected_values[i], proportions[i],
+          process_error, error_values[i],0.0, delta_, 0.0);
     }
   }
 }
@@ -321,10 +330,10 @@ void ProportionsAtLength::CalculateScore() {
     likelihood_->SimulateObserved(comparisons_);
     for (auto& iter :  comparisons_) {
       Double total = 0.0;
-      for (auto& comparison : iter.second)
-        total += comparison.observed_;
-      for (auto& comparison : iter.second)
-        comparison.observed_ /= total;
+      for (Double observed : iter.second.observed_)
+        total += observed;
+      for (Double& observed : iter.second.observed_)
+        observed /= total;
     }
   } else {
     /**
@@ -332,14 +341,14 @@ void ProportionsAtLength::CalculateScore() {
      */
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
-        running_total += comparison.expected_;
+      for (Double expected : comparisons_[year].expected_) {
+        running_total += expected;
       }
-      for (obs::Comparison& comparison : comparisons_[year]) {
+      for (Double& expected : comparisons_[year].expected_) {
         if (running_total != 0.0)
-          comparison.expected_  = comparison.expected_ / running_total;
+          expected  = expected / running_total;
         else
-          comparison.expected_  = 0.0;
+          expected  = 0.0;
       }
     }
     likelihood_->GetScores(comparisons_);
@@ -347,9 +356,9 @@ void ProportionsAtLength::CalculateScore() {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       LOG_FINEST() << "-- Observation score calculation";
       LOG_FINEST() << "[" << year << "] Initial Score:"<< scores_[year];
-      for (obs::Comparison comparison : comparisons_[year]) {
-        LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        LOG_FINEST() << "[" << year << "]+ likelihood score: " << score;
+        scores_[year] += score;
       }
     }
   }
@@ -119,13 +119,13 @@ void ProportionsByCategory::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     unsigned year = 0;
 
     if (obs_data_line.size() != obs_expected) {
@@ -159,13 +159,13 @@ void ProportionsByCategory::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     unsigned year = 0;
 
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
@@ -232,6 +232,11 @@ void ProportionsByCategory::DoValidate() {
  * the labels for other objects are valid.
  */
 void ProportionsByCategory::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
   target_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, target_category_labels_));
@@ -280,9 +285,9 @@ void ProportionsByCategory::PreExecute() {
   cached_partition_->BuildCache();
   target_cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size())
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
 }
 
@@ -300,6 +305,8 @@ void ProportionsByCategory::Execute() {
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
   auto target_cached_partition_iter  = target_cached_partition_->Begin();
   auto target_partition_iter         = target_partition_->Begin(); // vector<vector<partition::Category> >
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
 
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -312,8 +319,8 @@ void ProportionsByCategory::Execute() {
     Double      end_value          = 0.0;
     Double      final_value        = 0.0;
 
-    vector<Double> age_results(age_spread_, 0.0);
-    vector<Double> target_age_results(age_spread_, 0.0);
+    vector<Double>& age_results        = WorkBuffer(0, age_spread_);
+    vector<Double>& target_age_results = WorkBuffer(1, age_spread_);
 
     /**
      * Loop through the 2 combined categories building up the
@@ -407,9 +414,11 @@ void ProportionsByCategory::Execute() {
       }
     }
 
-    if (age_results.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
+    if (age_results.size() != proportions.size())
       LOG_CODE_ERROR() << "expected_values.size(" << age_results.size() << ") != proportions_[category_offset].size("
-        << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << proportions.size() << ")";
 
     /**
      * save our comparisons so we can use them to generate the score from the likelihoods later
@@ -420,8 +429,8 @@ void ProportionsByCategory::Execute() {
       if (age_results[i] != 0.0)
         expected = target_age_results[i] / age_results[i];
 
-      SaveComparison(category_labels_[category_offset], min_age_ + i, 0, expected, proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+      SaveComparison(category_offset, min_age_ + i, 0, expected, proportions[i],
+          process_error, error_values[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -445,7 +454,7 @@ void ProportionsByCategory::CalculateScore() {
      */
     for (unsigned year : years_) {
 //      Double running_total = 0.0;
-//      for (obs::Comparison comparison : comparisons_[year]) {
+//      for (const obs::Comparison& comparison : comparisons_[year]) {
 //        running_total += comparison.expected_;
 //      }
 //      for (obs::Comparison& comparison : comparisons_[year]) {
@@ -457,8 +466,8 @@ void ProportionsByCategory::CalculateScore() {
 
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       likelihood_->GetScores(comparisons_);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        scores_[year] += score;
       }
     }
   }
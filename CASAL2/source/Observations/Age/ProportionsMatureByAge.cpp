@@ -139,13 +139,13 @@ void ProportionsMatureByAge::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     if (obs_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -170,13 +170,13 @@ void ProportionsMatureByAge::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     LOG_FINEST() << "cols = " << error_values_data_line.size();
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected
@@ -237,6 +237,11 @@ void ProportionsMatureByAge::DoValidate() {
  */
 void ProportionsMatureByAge::DoBuild() {
   LOG_TRACE();
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   // Get all categories in the system.
   total_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, total_category_labels_));
   total_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, total_category_labels_));
@@ -276,16 +281,16 @@ void ProportionsMatureByAge::PreExecute() {
   total_cached_partition_->BuildCache();
   LOG_FINEST() << "Entering observation " << label_;
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size()) {
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
   }
-  if (total_cached_partition_->Size() != proportions_[model_->current_year()].size()) {
+  if (total_cached_partition_->Size() != proportions_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "total_cached_partition_->Size() != proportions_[model->current_year()].size()";
 
   }
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
-  if (total_partition_->Size() != proportions_[model_->current_year()].size())
+  if (total_partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "total_partition_->Size() != proportions_[model->current_year()].size()";
 }
 
@@ -307,15 +312,18 @@ void ProportionsMatureByAge::Execute() {
    * with it. We need to build a vector of proportions for each age using that combination and then
    * compare it to the observations.
    */
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
+
   LOG_FINEST() << "Number of categories " << category_labels_.size();
   for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
 
 
-    vector<Double> expected_values(age_spread_, 0.0);
-    vector<Double> numbers_age((model_->age_spread() + 1), 0.0);
-    vector<Double> total_numbers_age((model_->age_spread() + 1), 0.0);
+    vector<Double>& expected_values   = WorkBuffer(0, age_spread_);
+    vector<Double>& numbers_age       = WorkBuffer(1, model_->age_spread() + 1);
+    vector<Double>& total_numbers_age = WorkBuffer(2, model_->age_spread() + 1);
     /**
      * Loop through the total categories building up numbers at age.
      */
@@ -364,9 +372,9 @@ void ProportionsMatureByAge::Execute() {
     *  Apply Ageing error on numbers at age before and after
     */
     if (ageing_error_label_ != "") {
-      vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
-      vector<Double> temp(numbers_age.size(), 0.0);
-      vector<Double> total_temp(total_numbers_age.size(), 0.0);
+      const vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
+      vector<Double>& temp       = WorkBuffer(3, numbers_age.size());
+      vector<Double>& total_temp = WorkBuffer(4, total_numbers_age.size());
 
       for (unsigned i = 0; i < mis_matrix.size(); ++i) {
         for (unsigned j = 0; j < mis_matrix[i].size(); ++j) {
@@ -374,8 +382,8 @@ void ProportionsMatureByAge::Execute() {
           total_temp[j] += total_numbers_age[i] * mis_matrix[i][j];
         }
       }
-      numbers_age = temp;
-      total_numbers_age = total_temp;
+      numbers_age.swap(temp);
+      total_numbers_age.swap(total_temp);
     }
 
 
@@ -413,16 +421,18 @@ void ProportionsMatureByAge::Execute() {
 
 
 
-    if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
+    if (expected_values.size() != proportions.size())
       LOG_CODE_ERROR() << "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-        << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << proportions.size() << ")";
     /**
      * save our comparisons so we can use them to generate the score from the likelihoods later
      */
     for (unsigned i = 0; i < expected_values.size(); ++i) {
       LOG_FINEST() << "proportions mature at age " << min_age_ + i << " = " << expected_values[i];
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+      SaveComparison(category_offset, min_age_ + i ,0.0 ,expected_values[i], proportions[i],
+          process_error, error_values[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -448,9 +458,9 @@ void ProportionsMatureByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        LOG_FINEST() << "[" << year << "]+ likelihood score: " << score;
+        scores_[year] += score;
       }
     }
   }
@@ -108,13 +108,13 @@ void ProportionsMigrating::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& obs_data = obs_table_->data();
+  const vector<vector<string>>& obs_data = obs_table_->data();
   if (obs_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_OBS) << " has " << obs_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& obs_data_line : obs_data) {
+  for (const vector<string>& obs_data_line : obs_data) {
     if (obs_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_OBS) << " has " << obs_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -139,13 +139,13 @@ void ProportionsMigrating::DoValidate() {
   /**
    * Build our error value map
    */
-  vector<vector<string>>& error_values_data = error_values_table_->data();
+  const vector<vector<string>>& error_values_data = error_values_table_->data();
   if (error_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& error_values_data_line : error_values_data) {
+  for (const vector<string>& error_values_data_line : error_values_data) {
     if (error_values_data_line.size() != 2 && error_values_data_line.size() != obs_expected) {
       LOG_ERROR_P(PARAM_ERROR_VALUES) << " has " << error_values_data_line.size() << " values defined, but we expected " << obs_expected
           << " to match the age speard * categories + 1 (for year)";
@@ -200,6 +200,11 @@ void ProportionsMigrating::DoValidate() {
  * the labels for other objects are valid.
  */
 void ProportionsMigrating::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(proportions_, years_, category_labels_, proportions_by_index_);
+  ResolveByYearAndCategory(error_values_, years_, category_labels_, error_values_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
 
@@ -231,12 +236,12 @@ void ProportionsMigrating::PreExecute() {
   LOG_FINEST() << "Entering observation " << label_;
 
 
-  if (cached_partition_->Size() != proportions_[model_->current_year()].size()) {
-    LOG_MEDIUM() << "Cached size " << cached_partition_->Size() << " partition size = " << proportions_[model_->current_year()].size();
+  if (cached_partition_->Size() != proportions_by_index_[YearIndex()].size()) {
+    LOG_MEDIUM() << "Cached size " << cached_partition_->Size() << " partition size = " << proportions_by_index_[YearIndex()].size();
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
 
   }
-  if (partition_->Size() != proportions_[model_->current_year()].size())
+  if (partition_->Size() != proportions_by_index_[YearIndex()].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
 }
 
@@ -257,15 +262,18 @@ void ProportionsMigrating::Execute() {
    * with it. We need to build a vector of proportions for each age using that combination and then
    * compare it to the observations.
    */
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
+
   LOG_FINEST() << "Number of categories " << category_labels_.size();
   for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
 
 
-    vector<Double> expected_values(age_spread_, 0.0);
-    vector<Double> numbers_age_before((model_->age_spread() + 1), 0.0);
-    vector<Double> numbers_age_after((model_->age_spread() + 1), 0.0);
+    vector<Double>& expected_values    = WorkBuffer(0, age_spread_);
+    vector<Double>& numbers_age_before = WorkBuffer(1, model_->age_spread() + 1);
+    vector<Double>& numbers_age_after  = WorkBuffer(2, model_->age_spread() + 1);
 
     /**
      * Loop through the 2 combined categories building up the
@@ -295,9 +303,9 @@ void ProportionsMigrating::Execute() {
     *  Apply Ageing error on numbers at age before and after
     */
     if (ageing_error_label_ != "") {
-      vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
-      vector<Double> temp_before(numbers_age_before.size(), 0.0);
-      vector<Double> temp_after(numbers_age_after.size(), 0.0);
+      const vector<vector<Double>>& mis_matrix = ageing_error_->mis_matrix();
+      vector<Double>& temp_before = WorkBuffer(3, numbers_age_before.size());
+      vector<Double>& temp_after  = WorkBuffer(4, numbers_age_after.size());
 
       for (unsigned i = 0; i < mis_matrix.size(); ++i) {
         for (unsigned j = 0; j < mis_matrix[i].size(); ++j) {
@@ -305,8 +313,8 @@ void ProportionsMigrating::Execute() {
           temp_after[j] += numbers_age_after[i] * mis_matrix[i][j];
         }
       }
-      numbers_age_before = temp_before;
-      numbers_age_after = temp_after;
+      numbers_age_before.swap(temp_before);
+      numbers_age_after.swap(temp_after);
     }
 
 
@@ -341,9 +349,11 @@ void ProportionsMigrating::Execute() {
       expected_values[age_spread_ - 1] = (plus_before - plus_after) / plus_before;
 
 
-    if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& proportions  = *proportions_by_index_[year_index][category_offset];
+    const vector<Double>& error_values = *error_values_by_index_[year_index][category_offset];
+    if (expected_values.size() != proportions.size())
       LOG_CODE_ERROR() << "expected_values.size(" << expected_values.size() << ") != proportions_[category_offset].size("
-        << proportions_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << proportions.size() << ")";
 
     /**
      * save our comparisons so we can use them to generate the score from the likelihoods later
@@ -351,8 +361,8 @@ void ProportionsMigrating::Execute() {
 
     for (unsigned i = 0; i < expected_values.size(); ++i) {
       LOG_FINEST() << " Numbers at age " << min_age_ + i << " = " << expected_values[i];
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
-          process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+      SaveComparison(category_offset, min_age_ + i ,0.0 ,expected_values[i], proportions[i],
+          process_error, error_values[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -378,9 +388,9 @@ void ProportionsMigrating::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        LOG_FINEST() << "[" << year << "]+ likelihood score: " << score;
+        scores_[year] += score;
       }
     }
   }
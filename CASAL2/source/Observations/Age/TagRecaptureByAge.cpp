@@ -101,13 +101,13 @@ void TagRecaptureByAge::DoValidate() {
    * categories male+female male = 2 collections
    */
   unsigned obs_expected = age_spread_ * category_labels_.size() + 1;
-  vector<vector<string>>& recpatures_data = recaptures_table_->data();
+  const vector<vector<string>>& recpatures_data = recaptures_table_->data();
   if (recpatures_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_RECAPTURED) << " has " << recpatures_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& recaptures_data_line : recpatures_data) {
+  for (const vector<string>& recaptures_data_line : recpatures_data) {
     unsigned year = 0;
 
     if (recaptures_data_line.size() != obs_expected) {
@@ -140,13 +140,13 @@ void TagRecaptureByAge::DoValidate() {
   /**
    * Build our scanned map
    */
-  vector<vector<string>>& scanned_values_data = scanned_table_->data();
+  const vector<vector<string>>& scanned_values_data = scanned_table_->data();
   if (scanned_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_SCANNED) << " has " << scanned_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& scanned_values_data_line : scanned_values_data) {
+  for (const vector<string>& scanned_values_data_line : scanned_values_data) {
     unsigned year = 0;
 
     if (scanned_values_data_line.size() != 2 && scanned_values_data_line.size() != obs_expected) {
@@ -210,10 +210,16 @@ void TagRecaptureByAge::DoValidate() {
  * the labels for other objects are valid.
  */
 void TagRecaptureByAge::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(scanned_, years_, category_labels_, scanned_by_index_);
+  ResolveByYearAndCategory(recaptures_, years_, category_labels_, recaptures_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
   target_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, target_category_labels_));
   target_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, target_category_labels_));
+  comparison_category_labels_ = target_category_labels_;
 
   if (ageing_error_label_ != "") {
     LOG_CODE_ERROR() << "ageing error has not been implemented for the tag recapture at age observation";
@@ -271,10 +277,10 @@ void TagRecaptureByAge::PreExecute() {
   cached_partition_->BuildCache();
   target_cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != scanned_[model_->current_year()].size()) {
+  if (cached_partition_->Size() != scanned_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "cached_partition_->Size() != proportions_[model->current_year()].size()";
   }
-  if (partition_->Size() != scanned_[model_->current_year()].size()) {
+  if (partition_->Size() != scanned_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "partition_->Size() != proportions_[model->current_year()].size()";
   }
 }
@@ -293,6 +299,8 @@ void TagRecaptureByAge::Execute() {
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
   auto target_cached_partition_iter  = target_cached_partition_->Begin();
   auto target_partition_iter         = target_partition_->Begin(); // vector<vector<partition::Category> >
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
 
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -305,8 +313,8 @@ void TagRecaptureByAge::Execute() {
     Double      end_value          = 0.0;
     Double      final_value        = 0.0;
 
-    vector<Double> age_results(age_spread_, 0.0);
-    vector<Double> target_age_results(age_spread_, 0.0);
+    vector<Double>& age_results        = WorkBuffer(0, age_spread_);
+    vector<Double>& target_age_results = WorkBuffer(1, age_spread_);
 
     /**
      * Loop through the 2 combined categories if they are supplied, building up the
@@ -402,9 +410,11 @@ void TagRecaptureByAge::Execute() {
       }
     }
 
-    if (age_results.size() != scanned_[model_->current_year()][category_labels_[category_offset]].size())
+    const vector<Double>& scanned    = *scanned_by_index_[year_index][category_offset];
+    const vector<Double>& recaptures = *recaptures_by_index_[year_index][category_offset];
+    if (age_results.size() != scanned.size())
       LOG_CODE_ERROR() << "expected_values.size(" << age_results.size() << ") != proportions_[category_offset].size("
-        << scanned_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << scanned.size() << ")";
 
 
      //save our comparisons so we can use them to generate the score from the likelihoods later
@@ -415,14 +425,14 @@ void TagRecaptureByAge::Execute() {
       Double observed = 0.0;
       if (age_results[i] != 0.0)
         expected = target_age_results[i] / age_results[i];
-      if (scanned_[model_->current_year()][category_labels_[category_offset]][i] == 0.0)
+      if (scanned[i] == 0.0)
         observed = 0.0;
       else
-        observed = (1 / detection_ * recaptures_[model_->current_year()][category_labels_[category_offset]][i]) / scanned_[model_->current_year()][category_labels_[category_offset]][i];                                                                                                                                                                    ;
+        observed = (1 / detection_ * recaptures[i]) / scanned[i];
       LOG_MEDIUM() << "Comparison for age " << min_age_ + i << " Expected = " << expected << " observed = " << observed << " error = "
-          << scanned_[model_->current_year()][category_labels_[category_offset]][i] << " recaptures = " << recaptures_[model_->current_year()][category_labels_[category_offset]][i];
-      SaveComparison(target_category_labels_[category_offset], min_age_ + i, 0, expected, observed,
-          process_errors_by_year_[model_->current_year()], scanned_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+          << scanned[i] << " recaptures = " << recaptures[i];
+      SaveComparison(category_offset, min_age_ + i, 0, expected, observed,
+          process_error, scanned[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -446,8 +456,8 @@ void TagRecaptureByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        scores_[year] += score;
       }
     }
   }
@@ -74,6 +74,9 @@ protected:
 
   map<unsigned, map<string, vector<Double>>> recaptures_;
   map<unsigned, map<string, vector<Double>>> scanned_;
+  vector<vector<const vector<Double>*>>      scanned_by_index_; // [year_index][category_index]
+  vector<vector<const vector<Double>*>>      recaptures_by_index_;
+  vector<Double>                             process_errors_by_index_;
 };
 
 } /* namespace age */
@@ -182,13 +182,13 @@ void TagRecaptureByLength::DoValidate() {
    */
   unsigned obs_expected = number_bins_ * tagged_category_labels_.size() + 1;
   LOG_FINE() << "expected obs = " << obs_expected << " number of bins = " << number_bins_ << " tagged categories = " << tagged_category_labels_.size();
-  vector<vector<string>>& recpatures_data = recaptures_table_->data();
+  const vector<vector<string>>& recpatures_data = recaptures_table_->data();
   if (recpatures_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_RECAPTURED) << " has " << recpatures_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& recaptures_data_line : recpatures_data) {
+  for (const vector<string>& recaptures_data_line : recpatures_data) {
     unsigned year = 0;
 
     if (recaptures_data_line.size() != obs_expected) {
@@ -222,13 +222,13 @@ void TagRecaptureByLength::DoValidate() {
   /**
    * Build our scanned map
    */
-  vector<vector<string>>& scanned_values_data = scanned_table_->data();
+  const vector<vector<string>>& scanned_values_data = scanned_table_->data();
   if (scanned_values_data.size() != years_.size()) {
     LOG_ERROR_P(PARAM_SCANNED) << " has " << scanned_values_data.size() << " rows defined, but we expected " << years_.size()
         << " to match the number of years provided";
   }
 
-  for (vector<string>& scanned_values_data_line : scanned_values_data) {
+  for (const vector<string>& scanned_values_data_line : scanned_values_data) {
     unsigned year = 0;
 
     if (scanned_values_data_line.size() != 2 && scanned_values_data_line.size() != obs_expected) {
@@ -346,10 +346,16 @@ void TagRecaptureByLength::DoValidate() {
  * the labels for other objects are valid.
  */
 void TagRecaptureByLength::DoBuild() {
+  BuildYearIndexes(years_);
+  ResolveByYearAndCategory(scanned_, years_, category_labels_, scanned_by_index_);
+  ResolveByYearAndCategory(recaptures_, years_, category_labels_, recaptures_by_index_);
+  ResolveByYear(process_errors_by_year_, years_, process_errors_by_index_);
+
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
   cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
   tagged_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, tagged_category_labels_));
   tagged_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, tagged_category_labels_));
+  comparison_category_labels_ = tagged_category_labels_;
 
 
 
@@ -403,10 +409,10 @@ void TagRecaptureByLength::PreExecute() {
   cached_partition_->BuildCache();
   tagged_cached_partition_->BuildCache();
 
-  if (cached_partition_->Size() != scanned_[model_->current_year()].size()) {
+  if (cached_partition_->Size() != scanned_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "cached_partition_->Size() != scanned_[model->current_year()].size()";
   }
-  if (partition_->Size() != scanned_[model_->current_year()].size()) {
+  if (partition_->Size() != scanned_by_index_[YearIndex()].size()) {
     LOG_CODE_ERROR() << "partition_->Size() != scanned_[model->current_year()].size()";
   }
 }
@@ -425,6 +431,8 @@ void TagRecaptureByLength::Execute() {
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
   auto tagged_cached_partition_iter  = tagged_cached_partition_->Begin();
   auto tagged_partition_iter         = tagged_partition_->Begin(); // vector<vector<partition::Category> >
+  unsigned year_index = YearIndex();
+  Double process_error = process_errors_by_index_[year_index];
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
    * with it. We need to build a vector of proportions for each age using that combination and then
@@ -565,9 +573,11 @@ void TagRecaptureByLength::Execute() {
       }
     }
 
-    if (length_results_.size() != scanned_[model_->current_year()][category_labels_[category_offset]].size()) {
+    const vector<Double>& scanned    = *scanned_by_index_[year_index][category_offset];
+    const vector<Double>& recaptures = *recaptures_by_index_[year_index][category_offset];
+    if (length_results_.size() != scanned.size()) {
       LOG_CODE_ERROR() << "expected_values.size(" << length_results_.size() << ") != proportions_[category_offset].size("
-        << scanned_[model_->current_year()][category_labels_[category_offset]].size() << ")";
+        << scanned.size() << ")";
     }
     //save our comparisons so we can use them to generate the score from the likelihoods later
     for (unsigned i = 0; i < length_results_.size(); ++i) {
@@ -577,12 +587,12 @@ void TagRecaptureByLength::Execute() {
         expected = detection_ * tagged_length_results_[i]  / (length_results_[i]+  tagged_length_results_[i]);
         LOG_FINEST() << " total numbers at length " << length_bins_[i] << " = " << tagged_length_results_[i] << ", denominator = " << length_results_[i] << " + " << tagged_length_results_[i] ;
       }
-      if (scanned_[model_->current_year()][category_labels_[category_offset]][i] == 0.0)
+      if (scanned[i] == 0.0)
         observed = 0.0;
       else
-        observed = (recaptures_[model_->current_year()][category_labels_[category_offset]][i]) / scanned_[model_->current_year()][category_labels_[category_offset]][i];                                                                                                                                                                    ;
-      SaveComparison(tagged_category_labels_[category_offset], 0, length_bins_[i], expected, observed,
-          process_errors_by_year_[model_->current_year()], scanned_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
+        observed = recaptures[i] / scanned[i];
+      SaveComparison(category_offset, 0, length_bins_[i], expected, observed,
+          process_error, scanned[i], 0.0, delta_, 0.0);
     }
   }
 }
@@ -605,8 +615,8 @@ void TagRecaptureByLength::CalculateScore() {
     likelihood_->GetScores(comparisons_);
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
-        scores_[year] += comparison.score_;
+      for (Double score : comparisons_[year].score_) {
+        scores_[year] += score;
       }
       // Add the dispersion factor to the likelihood score
       scores_[year] /= despersion_;
@@ -0,0 +1,103 @@
+/**
+ * @file ComparisonColumns.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "ComparisonColumns.h"
+
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace observations {
+
+/**
+ * Check comparisons saved in to the columns are stored
+ * against the index of their category
+ */
+TEST(ComparisonColumns, PushBack) {
+  ComparisonColumns columns;
+  for (unsigned i = 0; i < 4; ++i)
+    columns.push_back(i % 2, i + 1, 0.0, 0.1 * (i + 1), 0.2 * (i + 1), 0.0, 10.0, 0.0, 1e-5, 0.0);
+
+  ASSERT_EQ(4u, columns.size());
+  for (unsigned i = 0; i < columns.size(); ++i) {
+    EXPECT_EQ(i % 2, columns.category_[i]);
+    EXPECT_EQ(i + 1, columns.age_[i]);
+    EXPECT_DOUBLE_EQ(0.1 * (i + 1), columns.expected_[i]);
+    EXPECT_DOUBLE_EQ(0.2 * (i + 1), columns.observed_[i]);
+    EXPECT_DOUBLE_EQ(10.0, columns.error_value_[i]);
+    EXPECT_DOUBLE_EQ(1e-5, columns.delta_[i]);
+  }
+
+  // Clearing keeps the memory so the next year can reuse it
+  unsigned capacity = columns.expected_.capacity();
+  columns.clear();
+  EXPECT_EQ(0u, columns.size());
+  EXPECT_EQ(capacity, columns.expected_.capacity());
+}
+
+/**
+ * Check comparison records are loaded in to columns with
+ * the index of their category label
+ */
+TEST(ComparisonColumns, Load) {
+  vector<Comparison> comparisons(4);
+  string labels[] = { "male", "male", "female", "male" };
+  for (unsigned i = 0; i < comparisons.size(); ++i) {
+    comparisons[i].category_  = labels[i];
+    comparisons[i].age_       = i + 1;
+    comparisons[i].expected_  = 0.1 * (i + 1);
+    comparisons[i].observed_  = 0.2 * (i + 1);
+  }
+
+  vector<string> category_labels = { "female" };
+  ComparisonColumns columns;
+  columns.Load(comparisons, category_labels);
+  ASSERT_EQ(4u, columns.size());
+  ASSERT_EQ(2u, category_labels.size());
+  EXPECT_EQ("female", category_labels[0]);
+  EXPECT_EQ("male", category_labels[1]);
+
+  unsigned expected_categories[] = { 1, 1, 0, 1 };
+  for (unsigned i = 0; i < columns.size(); ++i) {
+    EXPECT_EQ(expected_categories[i], columns.category_[i]);
+    EXPECT_EQ(i + 1, columns.age_[i]);
+    EXPECT_DOUBLE_EQ(0.1 * (i + 1), columns.expected_[i]);
+    EXPECT_DOUBLE_EQ(0.2 * (i + 1), columns.observed_[i]);
+  }
+}
+
+/**
+ * Check the comparison records created for reports have
+ * the values in the columns and their category labels
+ */
+TEST(ComparisonColumns, Materialise) {
+  vector<string> category_labels = { "immature", "mature" };
+  ComparisonColumns columns;
+  for (unsigned i = 0; i < 3; ++i)
+    columns.push_back(i == 1 ? 0 : 1, i, 0.0, 0.5, 0.25, 0.0, 0.0, 10.0 * i, 0.0, 2.0 * i);
+
+  vector<Comparison> comparisons(5);
+  columns.Materialise(comparisons, category_labels);
+  ASSERT_EQ(3u, comparisons.size());
+  for (unsigned i = 0; i < comparisons.size(); ++i) {
+    EXPECT_EQ(i == 1 ? "immature" : "mature", comparisons[i].category_);
+    EXPECT_EQ(i, comparisons[i].age_);
+    EXPECT_DOUBLE_EQ(0.5, comparisons[i].expected_);
+    EXPECT_DOUBLE_EQ(0.25, comparisons[i].observed_);
+    EXPECT_DOUBLE_EQ(10.0 * i, comparisons[i].adjusted_error_);
+    EXPECT_DOUBLE_EQ(2.0 * i, comparisons[i].score_);
+  }
+}
+
+} /* namespace observations */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,149 @@
+/**
+ * @file ComparisonColumns.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds a year of an observation's comparisons as columns. Each
+ * value of the comparison is stored in its own contiguous vector so the
+ * likelihoods can score a whole year in a single pass over plain arrays.
+ *
+ * The observation saves its comparisons straight in to the columns and the
+ * likelihoods read and write them in place. The category of a comparison is
+ * stored as the index of its label in the observation's comparison category
+ * labels, which are resolved when the observation is built. Comparison records
+ * are only created from the columns when they are needed for reporting.
+ *
+ * The vectors are cleared but not freed when the observation is reset so
+ * saving comparisons does not allocate memory once they have grown to size.
+ */
+#ifndef OBSERVATIONS_COMPARISONCOLUMNS_H_
+#define OBSERVATIONS_COMPARISONCOLUMNS_H_
+
+// headers
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../Observations/Comparison.h"
+#include "../Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace observations {
+
+using std::string;
+using std::vector;
+using utilities::Double;
+
+/**
+ * Class definition
+ */
+class ComparisonColumns {
+public:
+  // methods
+  ComparisonColumns() = default;
+  virtual                     ~ComparisonColumns() = default;
+
+  /**
+   * Add a comparison to the end of our columns
+   *
+   * @param category The index of the comparison's category label
+   */
+  void push_back(unsigned category, unsigned age, Double length, Double expected, Double observed,
+      Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
+    category_.push_back(category);
+    age_.push_back(age);
+    length_.push_back(length);
+    expected_.push_back(expected);
+    observed_.push_back(observed);
+    error_value_.push_back(error_value);
+    process_error_.push_back(process_error);
+    adjusted_error_.push_back(adjusted_error);
+    delta_.push_back(delta);
+    score_.push_back(score);
+  }
+
+  /**
+   * Remove all of the comparisons, keeping the memory for the next year
+   */
+  void clear() {
+    category_.clear();
+    age_.clear();
+    length_.clear();
+    expected_.clear();
+    observed_.clear();
+    error_value_.clear();
+    process_error_.clear();
+    adjusted_error_.clear();
+    delta_.clear();
+    score_.clear();
+  }
+
+  /**
+   * Add comparison records to our columns. Any category label that is
+   * not in category_labels yet is added to it.
+   *
+   * @param comparisons The comparisons to add
+   * @param category_labels The category labels the indexes refer to
+   */
+  void Load(const vector<Comparison>& comparisons, vector<string>& category_labels) {
+    for (const Comparison& comparison : comparisons) {
+      unsigned category = std::find(category_labels.begin(), category_labels.end(), comparison.category_) - category_labels.begin();
+      if (category == category_labels.size())
+        category_labels.push_back(comparison.category_);
+
+      push_back(category, comparison.age_, comparison.length_, comparison.expected_, comparison.observed_,
+          comparison.process_error_, comparison.error_value_, comparison.adjusted_error_, comparison.delta_, comparison.score_);
+    }
+  }
+
+  /**
+   * Create a comparison record for each of our comparisons. This is used
+   * when the comparisons are reported.
+   *
+   * @param comparisons The container to fill with the comparisons
+   * @param category_labels The category labels the indexes refer to
+   */
+  void Materialise(vector<Comparison>& comparisons, const vector<string>& category_labels) const {
+    unsigned count = size();
+    comparisons.resize(count);
+    for (unsigned i = 0; i < count; ++i) {
+      Comparison& comparison = comparisons[i];
+      comparison.category_        = category_labels[category_[i]];
+      comparison.age_             = age_[i];
+      comparison.length_          = length_[i];
+      comparison.expected_        = expected_[i];
+      comparison.observed_        = observed_[i];
+      comparison.error_value_     = error_value_[i];
+      comparison.process_error_   = process_error_[i];
+      comparison.adjusted_error_  = adjusted_error_[i];
+      comparison.delta_           = delta_[i];
+      comparison.score_           = score_[i];
+    }
+  }
+
+  // accessors
+  unsigned                    size() const { return expected_.size(); }
+
+  // members
+  vector<unsigned>            category_; // index in to the observation's comparison category labels
+  vector<unsigned>            age_;
+  vector<Double>              length_;
+  vector<Double>              expected_;
+  vector<Double>              observed_;
+  vector<Double>              error_value_;
+  vector<Double>              process_error_;
+  vector<Double>              adjusted_error_;
+  vector<Double>              delta_;
+  vector<Double>              score_;
+};
+
+} /* namespace observations */
+} /* namespace niwa */
+
+#endif /* OBSERVATIONS_COMPARISONCOLUMNS_H_ */
@@ -100,13 +100,21 @@ void Observation::Build() {
   }
 
   DoBuild();
+
+  // Observations that don't compare against their categories set their own labels in DoBuild()
+  if (comparison_category_labels_.size() == 0)
+    comparison_category_labels_ = category_labels_;
 }
 
 /**
- * Reset our observation so it can be called again
+ * Reset our observation so it can be called again.
+ *
+ * The comparisons for each year are emptied but the columns are
+ * kept so the next iteration can reuse the memory they hold.
  */
 void Observation::Reset() {
-  comparisons_.clear();
+  for (auto& year_comparisons : comparisons_)
+    year_comparisons.second.clear();
   scores_.clear();
 
   DoReset();
@@ -116,43 +124,169 @@ void Observation::Reset() {
  * Save the comparison that was done during an observation to the list of comparisons. Each comparison contributes part to a score
  * and we will need to know what those parts are when reporting.
  *
- * @param category The name of the comparison
+ * @param category The index of the comparison's label in comparison_category_labels_
  * @param age The age of the population being compared
  * @param expected The value generated by the model
  * @param observed The value passed in from the configuration file
  * @param error_value The error value for this comparison
  * @param score The amount of score for this comparison
  */
-void Observation::SaveComparison(string category, unsigned age, Double length, Double expected, Double observed,
+void Observation::SaveComparison(unsigned category, unsigned age, Double length, Double expected, Double observed,
     Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
-  observations::Comparison new_comparison;
-  new_comparison.category_ = category;
-  new_comparison.age_ = age;
-  new_comparison.length_ = length;
-  new_comparison.expected_ = expected;
-  new_comparison.observed_ = observed;
-  new_comparison.process_error_ = process_error;
-  new_comparison.error_value_ = error_value;
-  new_comparison.adjusted_error_ = adjusted_error;
-  new_comparison.delta_ = delta;
-  new_comparison.score_ = score;
-  comparisons_[model_->current_year()].push_back(new_comparison);
+  /**
+   * Observations save all of their comparisons for a year in one go so we
+   * only look the year up in the map when it changes. The map never removes
+   * entries so the pointer stays valid between iterations.
+   */
+  unsigned year = model_->current_year();
+  if (!current_comparisons_ || year != current_comparisons_year_) {
+    current_comparisons_      = &comparisons_[year];
+    current_comparisons_year_ = year;
+  }
+
+  current_comparisons_->push_back(category, age, length, expected, observed, process_error, error_value, adjusted_error, delta, score);
 }
 
 /**
  * Save the comparison that was done during an observation to the list of comparisons. Each comparison contributes part to a score
  * and we will need to know what those parts are when reporting.
  *
- * @param category The name of the comparison
- * @param age The age of the population being compared
+ * @param category The index of the comparison's label in comparison_category_labels_
  * @param expected The value generated by the model
  * @param observed The value passed in from the configuration file
  * @param error_value The error value for this comparison
  * @param score The amount of score for this comparison
  */
-void Observation::SaveComparison(string category, Double expected, Double observed,
+void Observation::SaveComparison(unsigned category, Double expected, Double observed,
     Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
   SaveComparison(category, 0, 0, expected, observed, process_error, error_value,adjusted_error, delta, score);
 }
 
+/**
+ * Return the comparisons for a year as comparison records. The records
+ * are created from our columns each time this is called so it is only
+ * meant to be used when reporting.
+ *
+ * @param year The year to return the comparisons for
+ * @return The comparisons for the year
+ */
+vector<obs::Comparison>& Observation::comparisons(unsigned year) {
+  vector<obs::Comparison>& comparisons = report_comparisons_[year];
+  comparisons_[year].Materialise(comparisons, comparison_category_labels_);
+  return comparisons;
+}
+
+/**
+ * Return the comparisons for every year as comparison records. The
+ * records are created from our columns each time this is called so
+ * it is only meant to be used when reporting.
+ *
+ * @return The comparisons for every year
+ */
+map<unsigned, vector<obs::Comparison> >& Observation::comparisons() {
+  report_comparisons_.clear();
+  for (auto& year_comparisons : comparisons_)
+    year_comparisons.second.Materialise(report_comparisons_[year_comparisons.first], comparison_category_labels_);
+  return report_comparisons_;
+}
+
+/**
+ * Return a work buffer filled with zeros for use during Execute. The buffers
+ * are owned by the observation and reused on every call so the observations
+ * do not have to allocate memory each time they are executed.
+ *
+ * References to the buffers stay valid when more buffers are added, so an
+ * observation can hold several of them at once.
+ *
+ * @param index The index of the buffer to use
+ * @param size The number of values required
+ * @return The buffer with size values set to 0.0
+ */
+vector<Double>& Observation::WorkBuffer(unsigned index, unsigned size) {
+  if (index >= work_buffers_.size())
+    work_buffers_.resize(index + 1);
+
+  vector<Double>& buffer = work_buffers_[index];
+  buffer.assign(size, 0.0);
+  return buffer;
+}
+
+/**
+ * Build the lookup from a year to its index in our years. This is called
+ * from DoBuild() so Execute can find the values for the current year with
+ * YearIndex() instead of searching a map every time it is called.
+ *
+ * @param years The years of the observation
+ */
+void Observation::BuildYearIndexes(const vector<unsigned>& years) {
+  year_indexes_.clear();
+  if (years.size() == 0)
+    return;
+
+  first_year_ = *std::min_element(years.begin(), years.end());
+  unsigned last_year = *std::max_element(years.begin(), years.end());
+  year_indexes_.assign(last_year - first_year_ + 1, years.size());
+  for (unsigned i = 0; i < years.size(); ++i)
+    year_indexes_[years[i] - first_year_] = i;
+}
+
+/**
+ * Return the index of the current year in the years given to BuildYearIndexes()
+ *
+ * @return The index of the current year
+ */
+unsigned Observation::YearIndex() const {
+  unsigned year = model_->current_year();
+  if (year < first_year_ || year - first_year_ >= year_indexes_.size() || year_indexes_[year - first_year_] == year_indexes_.size())
+    LOG_CODE_ERROR() << "observation " << label_ << " does not have the year " << year;
+  return year_indexes_[year - first_year_];
+}
+
+/**
+ * Resolve a value for each of our years so it can be looked up with YearIndex()
+ *
+ * @param values The values by year
+ * @param years The years of the observation
+ * @param resolved The container to fill with the value for each year
+ */
+void Observation::ResolveByYear(map<unsigned, Double>& values, const vector<unsigned>& years, vector<Double>& resolved) {
+  resolved.assign(years.size(), 0.0);
+  for (unsigned i = 0; i < years.size(); ++i)
+    resolved[i] = values[years[i]];
+}
+
+/**
+ * Resolve the values for each of our years so they can be looked up with YearIndex().
+ * The pointers are in to values, which must not change after this is called.
+ *
+ * @param values The values by year
+ * @param years The years of the observation
+ * @param resolved The container to fill with the values for each year
+ */
+void Observation::ResolveByYear(map<unsigned, vector<Double>>& values, const vector<unsigned>& years, vector<const vector<Double>*>& resolved) {
+  resolved.assign(years.size(), nullptr);
+  for (unsigned i = 0; i < years.size(); ++i)
+    resolved[i] = &values[years[i]];
+}
+
+/**
+ * Resolve the values for each of our years and categories so they can be looked up
+ * with YearIndex() and the category's index. The pointers are in to values, which
+ * must not change after this is called.
+ *
+ * @param values The values by year and category label
+ * @param years The years of the observation
+ * @param category_labels The category labels of the observation
+ * @param resolved The container to fill with the values, resolved[year_index][category_index]
+ */
+void Observation::ResolveByYearAndCategory(map<unsigned, map<string, vector<Double>>>& values, const vector<unsigned>& years,
+    const vector<string>& category_labels, vector<vector<const vector<Double>*>>& resolved) {
+  resolved.assign(years.size(), vector<const vector<Double>*>(category_labels.size(), nullptr));
+  for (unsigned i = 0; i < years.size(); ++i) {
+    map<string, vector<Double>>& year_values = values[years[i]];
+    for (unsigned j = 0; j < category_labels.size(); ++j)
+      resolved[i][j] = &year_values[category_labels[j]];
+  }
+}
+
 } /* namespace niwa */
@@ -17,9 +17,12 @@
 #define OBSERVATION_H_
 
 // Headers
+#include <deque>
+
 #include "../BaseClasses/Executor.h"
 #include "../Likelihoods/Likelihood.h"
 #include "../Observations/Comparison.h"
+#include "../Observations/ComparisonColumns.h"
 #include "../Utilities/Types.h"
 
 // Namespaces
@@ -54,16 +57,23 @@ public:
   // accessors
   const map<unsigned, Double>&  scores() const { return scores_; }
   string&                       likelihood() { return likelihood_type_; }
-  vector<obs::Comparison>&      comparisons(unsigned year) { return comparisons_[year]; }
-  map<unsigned, vector<obs::Comparison> >& comparisons() { return comparisons_; }
+  vector<obs::Comparison>&      comparisons(unsigned year);
+  map<unsigned, vector<obs::Comparison> >& comparisons();
 
 protected:
   // methods
-  void                        SaveComparison(string category, unsigned age, Double length, Double expected, Double observed,
+  void                        SaveComparison(unsigned category, unsigned age, Double length, Double expected, Double observed,
       Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
 
-  void                        SaveComparison(string category, Double expected, Double observed,
+  void                        SaveComparison(unsigned category, Double expected, Double observed,
       Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
+  vector<Double>&             WorkBuffer(unsigned index, unsigned size);
+  void                        BuildYearIndexes(const vector<unsigned>& years);
+  unsigned                    YearIndex() const;
+  void                        ResolveByYear(map<unsigned, Double>& values, const vector<unsigned>& years, vector<Double>& resolved);
+  void                        ResolveByYear(map<unsigned, vector<Double>>& values, const vector<unsigned>& years, vector<const vector<Double>*>& resolved);
+  void                        ResolveByYearAndCategory(map<unsigned, map<string, vector<Double>>>& values, const vector<unsigned>& years,
+      const vector<string>& category_labels, vector<vector<const vector<Double>*>>& resolved);
 
   // members
   shared_ptr<Model>                      model_ = nullptr;
@@ -80,7 +90,17 @@ protected:
   Double                      likelihood_multiplier_ = 1.0;
   vector<string>              category_labels_;
   unsigned                    expected_selectivity_count_;
-  map<unsigned, vector<obs::Comparison> > comparisons_;
+  vector<string>              comparison_category_labels_; // labels the category of each comparison is an index in to
+  map<unsigned, obs::ComparisonColumns> comparisons_;
+
+private:
+  // members
+  std::deque<vector<Double>>  work_buffers_;
+  unsigned                    first_year_ = 0;
+  vector<unsigned>            year_indexes_; // year_indexes_[year - first_year_] = index in to the years given to BuildYearIndexes()
+  map<unsigned, vector<obs::Comparison> > report_comparisons_;
+  obs::ComparisonColumns*     current_comparisons_ = nullptr;
+  unsigned                    current_comparisons_year_ = 0;
 
 };
 } /* namespace niwa */
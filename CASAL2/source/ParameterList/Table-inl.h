@@ -33,7 +33,7 @@ void Table::CheckColumnValuesAreType(const string& column) {
   unsigned index = column_index(column);
   T value;
 
-  for (const auto& row : data_) {
+  for (const auto& row : data()) {
     if (!utilities::To<string, T>(row[index], value))
       LOG_ERROR() << location() << "The value" << row[index] << " in column " << column << " could not be converted to type " << utilities::demangle(typeid(value).name());
   }
@@ -51,10 +51,10 @@ template<typename T>
 void Table::CheckColumnValuesContain(const string& column, const vector<T>& values) {
   unsigned index = column_index(column);
   vector<T> table_values;
-  table_values.reserve(data_.size());
+  table_values.reserve(data().size());
   T value;
 
-  for (const auto& row : data_) {
+  for (const auto& row : data()) {
     if (!utilities::To<string, T>(row[index], value))
       LOG_ERROR() << location() << "The value" << row[index] << " in column " << column << " could not be converted to type " << utilities::demangle(typeid(value).name());
 
@@ -77,11 +77,11 @@ void Table::CheckColumnValuesContain(const string& column, const vector<T>& valu
 template<typename T>
 vector<T> Table::GetColumnValuesAs(const string& column) {
   vector<T> result;
-  result.reserve(data_.size());
+  result.reserve(data().size());
   T value;
 
   unsigned index = column_index(column);
-  for (const auto& row : data_) {
+  for (const auto& row : data()) {
     if (!utilities::To<string, T>(row[index], value))
       LOG_ERROR() << location() << "The value" << row[index] << " in column " << column << " could not be converted to type " << utilities::demangle(typeid(value).name());
 
@@ -96,7 +96,7 @@ inline vector<string> Table::GetColumnValuesAs(const string& column) {
   vector<string> result;
 
   unsigned index = column_index(column);
-  for (const auto& row : data_) {
+  for (const auto& row : data()) {
     result.push_back(row[index]);
   }
   return result;
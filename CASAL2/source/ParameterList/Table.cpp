@@ -17,6 +17,7 @@
 
 #include "../Categories/Categories.h"
 #include "../Model/Model.h"
+#include "../Model/SharedData.h"
 #include "../Utilities/String.h"
 #include "../Utilities/To.h"
 #include "../Translations/Translations.h"
@@ -95,6 +96,20 @@ void Table::Populate(shared_ptr<Model> model) {
   if (model == nullptr)
     LOG_CODE_ERROR() << "model == nullptr";
 
+  /**
+   * If the model on another thread has already populated this table
+   * then use its rows instead of populating our own copy of them.
+   */
+  string key = file_name_ == "" ? "" : "table." + file_name_ + "." + utilities::ToInline<unsigned, string>(line_number_);
+  if (key != "") {
+    populated_data_ = model->shared_data()->Find<vector<vector<string>>>(key);
+    if (populated_data_) {
+      data_.clear();
+      return;
+    }
+  }
+  unsigned error_count = Logging::Instance().error_count();
+
   /**
    * Check the required columns if we've specified any.
    */
@@ -170,6 +185,14 @@ void Table::Populate(shared_ptr<Model> model) {
       CheckColumnValuesContain<unsigned>(PARAM_YEARS, years);
   } // if (year_index != columns_.size()) {
 
+  /**
+   * Only share our rows if they passed the checks above. The other models
+   * use shared rows without checking them again.
+   */
+  if (key != "" && Logging::Instance().error_count() == error_count) {
+    populated_data_ = model->shared_data()->Share(key, std::move(data_));
+    data_.clear();
+  }
 }
 
 } /* namespace parameters */
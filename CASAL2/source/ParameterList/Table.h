@@ -12,6 +12,9 @@
  * This class represents a table block loaded from the configuration file. It's
  * used for processing data and ensuring consistency of the table data when loaded
  *
+ * Once the table has been populated its rows never change, so they are shared
+ * with the models on the other threads instead of each model keeping a copy.
+ *
  * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
  */
 #ifndef TABLE_H_
@@ -63,7 +66,7 @@ public:
   void                        AddColumns(const vector<string> &columns);
   void                        AddRow(const vector<string> &row);
   bool                        HasColumns() { return columns_.size() != 0; }
-  bool                        HasBeenDefined() const { return data_.size() != 0; }
+  bool                        HasBeenDefined() const { return data().size() != 0; }
   void                        Populate(shared_ptr<Model> model);
   template<typename T>
   void                        CheckColumnValuesAreType(const string& column);
@@ -77,11 +80,11 @@ public:
   string                      file_name() const { return file_name_; }
   void                        set_line_number(const unsigned& line_number) { line_number_ = line_number; }
   unsigned                    line_number() const { return line_number_; }
-  unsigned                    row_count() const { return data_.size(); }
+  unsigned                    row_count() const { return data().size(); }
   unsigned                    column_count() const { return columns_.size(); }
   const vector<string>&       columns() { return columns_; }
   unsigned                    column_index(const string& label, bool throw_error = true) const;
-  vector<vector<string>>&     data() { return data_; }
+  const vector<vector<string>>& data() const { return populated_data_ ? *populated_data_ : data_; }
   string                      location() const;
   void                        set_is_optional(bool is_optional) { is_optional_ = is_optional; }
   bool                        is_optional() const { return is_optional_; }
@@ -96,6 +99,7 @@ private:
   unsigned                    line_number_ = 0;
   vector<string>              columns_;
   vector<vector<string> >     data_;
+  shared_ptr<const vector<vector<string>>> populated_data_;
   bool                        is_optional_ = false;
   bool                        requires_columns_ = true;
   vector<string>              required_columns_;
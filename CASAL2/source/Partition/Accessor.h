@@ -47,11 +47,11 @@ public:
 	virtual ~PartitionIterable() = default;
 	// have override constructor so we can build the data_ reference nicely
 	// avoids pointer semantics and a deference on every access
-	PartitionIterable(partition::Category* category, vector<Double>& category_data) :
+	PartitionIterable(partition::Category* category, CategoryData& category_data) :
 		category_(category), data_(category_data) { }
 
 	partition::Category* category_;
-	vector<Double>& data_;
+	CategoryData& data_;
 	vector<Double>  cached_data_;
 };
 
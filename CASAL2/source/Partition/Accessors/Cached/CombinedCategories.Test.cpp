@@ -108,6 +108,22 @@ TEST_F(BasicModel, Accessors_Cached_CombinedCategories) {
   ++cache_iter;
   ASSERT_EQ(cache_iter->size(), 1u);
   EXPECT_EQ((*cache_iter)[0].name_, "immature.female");
+
+  // The cache is a snapshot of the partition that is only updated by BuildCache()
+  partition::Category& immature_male = model_->partition().category("immature.male");
+  cache_iter = accessor->Begin();
+  ASSERT_EQ(immature_male.data_.size(), (*cache_iter)[0].data_.size());
+  for (unsigned i = 0; i < immature_male.data_.size(); ++i)
+    EXPECT_DOUBLE_EQ(immature_male.data_[i], (*cache_iter)[0].data_[i]);
+
+  Double cached_value = (*cache_iter)[0].data_[0];
+  immature_male.data_[0] += 1.0;
+  EXPECT_DOUBLE_EQ(cached_value, (*cache_iter)[0].data_[0]);
+
+  accessor->BuildCache();
+  EXPECT_DOUBLE_EQ(cached_value + 1.0, (*cache_iter)[0].data_[0]);
+  ++cache_iter;
+  EXPECT_DOUBLE_EQ(cached_value + 1.0, (*cache_iter)[0].data_[0]);
 }
 
 } /* namespace cached */
@@ -13,6 +13,7 @@
 // headers
 #include "CombinedCategories.h"
 
+#include <algorithm>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim_all.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -44,35 +45,62 @@ CombinedCategories::CombinedCategories(shared_ptr<Model> model, const vector<str
  * essentially a copy of the partition for
  * specific categories at a specific time
  * so it can be used for interpolation later.
+ *
+ * The cached categories only carry what the observations need
+ * from them. Their data_ is a view in to snapshot_, which is a copy
+ * of the block of the partition that holds our categories, so
+ * re-populating the cache is a single copy.
  */
 void CombinedCategories::BuildCache() {
   Partition& partition = model_->partition();
+  vector<Double>& partition_data = partition.data();
 
   if (!need_rebuild_) {
     // just re-populate
-    for (auto& iter : data_) { // vector<vector<partition::Category> >
-      for (auto& category : iter) {
-        partition::Category& part_cat = partition.category(category.name_);
-        category.data_ = part_cat.data_;
-      }
-    }
+    std::copy(partition_data.begin() + snapshot_offset_, partition_data.begin() + snapshot_offset_ + snapshot_.size(), snapshot_.begin());
     return;
   }
 
   // We need to actually build our container, or
   // the number of categories has changed.
-  // This could definitely be improved, but it works for now
   data_.clear();
   data_.resize(category_labels_.size());
+  vector<vector<partition::Category*>> source_categories(category_labels_.size());
   unsigned year = model_->current_year();
+  unsigned snapshot_start = partition_data.size();
+  unsigned snapshot_end   = 0;
   for (unsigned i = 0; i < category_labels_.size(); ++i) {
     for (auto cat_iter = category_labels_[i].begin(); cat_iter != category_labels_[i].end(); ++cat_iter) {
 
       partition::Category& category = partition.category(*cat_iter);
       if (std::find(category.years_.begin(), category.years_.end(), year) == category.years_.end())
         continue; // Not valid in this year
+      if (!category.data_.attached())
+        LOG_CODE_ERROR() << "The data for category " << category.name_ << " is no longer stored in the partition";
+
+      unsigned offset = category.data_.data() - partition_data.data();
+      snapshot_start  = std::min(snapshot_start, offset);
+      snapshot_end    = std::max(snapshot_end, offset + category.data_.size());
+
+      data_[i].emplace_back(model_);
+      partition::Category& cached_category = data_[i].back();
+      cached_category.id_                 = category.id_;
+      cached_category.name_               = category.name_;
+      cached_category.min_age_            = category.min_age_;
+      cached_category.max_age_            = category.max_age_;
+      cached_category.age_length_         = category.age_length_;
+      cached_category.age_length_matrix_  = category.age_length_matrix_;
+      source_categories[i].push_back(&category);
+    }
+  }
 
-      data_[i].push_back(category);
+  snapshot_offset_ = snapshot_start < snapshot_end ? snapshot_start : 0;
+  snapshot_.assign(partition_data.begin() + snapshot_offset_, partition_data.begin() + std::max(snapshot_offset_, snapshot_end));
+  for (unsigned i = 0; i < data_.size(); ++i) {
+    for (unsigned j = 0; j < data_[i].size(); ++j) {
+      partition::Category* category = source_categories[i][j];
+      unsigned offset = category->data_.data() - partition_data.data();
+      data_[i][j].data_.Attach(snapshot_.data() + (offset - snapshot_offset_), category->data_.size());
     }
   }
 
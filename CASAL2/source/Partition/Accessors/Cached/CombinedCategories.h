@@ -61,6 +61,8 @@ private:
   vector<vector<string> >     category_labels_;
   shared_ptr<Model>           model_;
   DataType                    data_;
+  vector<Double>              snapshot_; // copy of the block of the partition holding our categories
+  unsigned                    snapshot_offset_ = 0; // where snapshot_ starts in the partition's data
   bool                        need_rebuild_ = true;
 };
 
@@ -0,0 +1,78 @@
+/**
+ * @file AgeLengthProportions.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "AgeLengthProportions.h"
+
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace partition {
+
+/**
+ * Check the rows are laid out as [year][time_step][age][length_bin]
+ */
+TEST(AgeLengthProportions, Layout) {
+  AgeLengthProportions proportions;
+  proportions.Resize(3, 2, 4, 5, true);
+  ASSERT_EQ(3u, proportions.year_count());
+  ASSERT_EQ(2u, proportions.time_step_count());
+  ASSERT_EQ(4u, proportions.age_count());
+  ASSERT_EQ(5u, proportions.length_bin_count());
+
+  unsigned row = proportions.row(2, 1, 3);
+  EXPECT_EQ(23u, row);
+  proportions.row_data(row)[4] = 0.5;
+  EXPECT_DOUBLE_EQ(0.5, proportions(2, 1, 3, 4));
+  EXPECT_DOUBLE_EQ(0.5, proportions(2, 1, 3)[4]);
+  EXPECT_DOUBLE_EQ(0.0, proportions(1, 1, 3, 4));
+}
+
+/**
+ * Check every year shares the same rows when the
+ * proportions do not vary by year
+ */
+TEST(AgeLengthProportions, SharedYears) {
+  AgeLengthProportions proportions;
+  proportions.Resize(3, 2, 4, 5, false);
+  ASSERT_EQ(3u, proportions.year_count());
+
+  EXPECT_EQ(proportions.row(0, 1, 2), proportions.row(2, 1, 2));
+  proportions.row_data(proportions.row(0, 1, 2))[0] = 0.25;
+  EXPECT_DOUBLE_EQ(0.25, proportions(1, 1, 2, 0));
+  EXPECT_DOUBLE_EQ(0.25, proportions(2, 1, 2, 0));
+}
+
+/**
+ * Check a row is only rebuilt when its mu or sigma change
+ */
+TEST(AgeLengthProportions, UpdateRow) {
+  AgeLengthProportions proportions;
+  proportions.Resize(1, 1, 2, 3, false);
+
+  EXPECT_TRUE(proportions.UpdateRow(0, 10.0, 1.0));
+  EXPECT_FALSE(proportions.UpdateRow(0, 10.0, 1.0));
+  EXPECT_TRUE(proportions.UpdateRow(1, 10.0, 1.0));
+  EXPECT_TRUE(proportions.UpdateRow(0, 11.0, 1.0));
+  EXPECT_TRUE(proportions.UpdateRow(0, 11.0, 2.0));
+  EXPECT_FALSE(proportions.UpdateRow(0, 11.0, 2.0));
+
+  // Resizing to the same dimensions keeps what has been built
+  proportions.Resize(1, 1, 2, 3, false);
+  EXPECT_FALSE(proportions.UpdateRow(0, 11.0, 2.0));
+  proportions.Resize(1, 1, 3, 3, false);
+  EXPECT_TRUE(proportions.UpdateRow(0, 11.0, 2.0));
+}
+
+} /* namespace partition */
+} /* namespace niwa */
+#endif /* TESTMODE */
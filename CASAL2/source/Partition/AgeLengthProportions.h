@@ -0,0 +1,157 @@
+/**
+ * @file AgeLengthProportions.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds the proportion of each age in each length bin for a single
+ * category by year and time step. The values are stored in one contiguous block
+ * laid out as [year][time_step][age][length_bin] so a row of length bins can
+ * be handed out as a pointer.
+ *
+ * When the age length does not vary by year only a single year is stored and
+ * every year reads from it.
+ *
+ * The mu and sigma each row was last built from are kept so the partition can
+ * skip rows that have not changed when the proportions are rebuilt after the
+ * age length has changed, e.g. when only the cv of some ages has changed.
+ */
+#ifndef SOURCE_PARTITION_AGELENGTHPROPORTIONS_H_
+#define SOURCE_PARTITION_AGELENGTHPROPORTIONS_H_
+
+// headers
+#include <vector>
+
+#include "../Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace partition {
+
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * Class definition
+ */
+class AgeLengthProportions {
+public:
+  // methods
+  AgeLengthProportions() = default;
+  virtual                     ~AgeLengthProportions() = default;
+
+  /**
+   * Allocate the memory for the proportions. If the dimensions have
+   * not changed the existing values are kept.
+   *
+   * @param year_count The number of years in the model
+   * @param time_step_count The number of time steps in the model
+   * @param age_count The number of ages in the category
+   * @param length_bin_count The number of length bins in each row
+   * @param varies_by_year True if each year needs its own proportions
+   */
+  void Resize(unsigned year_count, unsigned time_step_count, unsigned age_count, unsigned length_bin_count, bool varies_by_year) {
+    unsigned stored_year_count = varies_by_year ? year_count : 1;
+    if (year_count == year_count_ && time_step_count == time_step_count_ && age_count == age_count_
+        && length_bin_count == length_bin_count_ && stored_year_count == stored_year_count_)
+      return;
+
+    year_count_         = year_count;
+    stored_year_count_  = stored_year_count;
+    time_step_count_    = time_step_count;
+    age_count_          = age_count;
+    length_bin_count_   = length_bin_count;
+
+    unsigned row_count = stored_year_count_ * time_step_count_ * age_count_;
+    values_.assign(row_count * length_bin_count_, 0.0);
+    mu_.assign(row_count, 0.0);
+    sigma_.assign(row_count, 0.0);
+    built_.assign(row_count, false);
+    has_revision_ = false;
+  }
+
+  /**
+   * Check if the proportions have been built from a revision of the age length
+   *
+   * @param revision The revision of the age length
+   * @return True if the proportions were last built from this revision
+   */
+  bool IsBuilt(unsigned revision) const { return has_revision_ && revision_ == revision; }
+
+  /**
+   * Set the revision of the age length the proportions have been built from
+   *
+   * @param revision The revision of the age length
+   */
+  void set_revision(unsigned revision) {
+    revision_     = revision;
+    has_revision_ = true;
+  }
+
+  /**
+   * Return the index of a row in our storage.
+   *
+   * @param year_index The year index (year - start_year)
+   * @param time_step The time step index
+   * @param age_index The age index (age - min_age)
+   * @return The row index
+   */
+  unsigned row(unsigned year_index, unsigned time_step, unsigned age_index) const {
+    unsigned stored_year = stored_year_count_ == 1 ? 0 : year_index;
+    return (stored_year * time_step_count_ + time_step) * age_count_ + age_index;
+  }
+
+  /**
+   * Check if a row has to be rebuilt because it has never been built
+   * or the mu and sigma for it have changed. If it does the new mu
+   * and sigma are stored against it.
+   *
+   * @param row The index of the row from row()
+   * @param mu The mean length for the row
+   * @param sigma The standard deviation for the row
+   * @return True if the row needs to be rebuilt
+   */
+  bool UpdateRow(unsigned row, Double mu, Double sigma) {
+#ifndef USE_AUTODIFF
+    if (built_[row] && mu_[row] == mu && sigma_[row] == sigma)
+      return false;
+#endif
+    built_[row] = true;
+    mu_[row]    = mu;
+    sigma_[row] = sigma;
+    return true;
+  }
+
+  // accessors
+  Double*                     operator()(unsigned year_index, unsigned time_step, unsigned age_index) { return &values_[row(year_index, time_step, age_index) * length_bin_count_]; }
+  const Double*               operator()(unsigned year_index, unsigned time_step, unsigned age_index) const { return &values_[row(year_index, time_step, age_index) * length_bin_count_]; }
+  Double                      operator()(unsigned year_index, unsigned time_step, unsigned age_index, unsigned length_bin) const { return (*this)(year_index, time_step, age_index)[length_bin]; }
+  Double*                     row_data(unsigned row) { return &values_[row * length_bin_count_]; }
+  unsigned                    year_count() const { return year_count_; }
+  unsigned                    time_step_count() const { return time_step_count_; }
+  unsigned                    age_count() const { return age_count_; }
+  unsigned                    length_bin_count() const { return length_bin_count_; }
+
+private:
+  // members
+  unsigned                    year_count_ = 0;
+  unsigned                    stored_year_count_ = 0;
+  unsigned                    time_step_count_ = 0;
+  unsigned                    age_count_ = 0;
+  unsigned                    length_bin_count_ = 0;
+  vector<Double>              values_; // [year][time_step][age][length_bin]
+  vector<Double>              mu_; // [year][time_step][age]
+  vector<Double>              sigma_; // [year][time_step][age]
+  vector<bool>                built_; // [year][time_step][age]
+  unsigned                    revision_ = 0;
+  bool                        has_revision_ = false;
+};
+
+} /* namespace partition */
+} /* namespace niwa */
+
+#endif /* SOURCE_PARTITION_AGELENGTHPROPORTIONS_H_ */
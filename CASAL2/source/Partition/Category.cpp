@@ -65,32 +65,57 @@ void Category::UpdateMeanLengthData() {
 /**
  * This method will update the weight data with the number of fish and weight
  * per fish for use.
+ *
+ * The tables are dense [time_step][age] (or [time_step][length_bin]) so callers
+ * can index them directly. They are allocated by Partition::Build() and are only
+ * rebuilt when the age length or length weight object has been reset or rebuilt
+ * (e.g. new estimates or a time varying change), when the year has changed for
+ * an age length that varies by year, when we move in to or out of the years
+ * the age length has cvs for, or when we move in to or out of the initialisation
+ * phases (age lengths like data use different mean lengths while initialising),
+ * so calling this more than once is cheap.
  */
-
 void Category::UpdateMeanWeightData() {
   Categories* categories = model_->categories();
-  vector<string> time_steps = model_->time_steps();
+  unsigned time_step_count = model_->time_steps().size();
   if (model_->partition_type() == PartitionType::kAge) {
     AgeLength* age_length = categories->age_length(name_);
+    unsigned revision = age_length == nullptr ? 0 : age_length->revision();
+    unsigned year = model_->current_year();
+    bool has_cv = age_length != nullptr && age_length->has_cv(year);
+    bool initialising = model_->state() == State::kInitialise;
+    bool year_changed = age_length != nullptr && (age_length->varies_by_years() ? mean_weight_year_ != year : mean_weight_has_cv_ != has_cv);
+    if (mean_weight_built_ && mean_weight_revision_ == revision && mean_weight_initialising_ == initialising && !year_changed)
+      return;
+
     if (age_length == nullptr) {
-      for (unsigned step_iter = 0; step_iter < time_steps.size(); ++step_iter) {
+      for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter) {
         for (unsigned age = min_age_; age <= max_age_; ++age)
           mean_weight_by_time_step_age_[step_iter][age] = 1.0;
       }
     } else {
-      for (unsigned step_iter = 0; step_iter < time_steps.size(); ++step_iter) {
+      for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter) {
         for (unsigned age = min_age_; age <= max_age_; ++age)
           mean_weight_by_time_step_age_[step_iter][age] = age_length->mean_weight(step_iter, age);
       }
     }
 
+    mean_weight_built_    = true;
+    mean_weight_year_     = year;
+    mean_weight_has_cv_   = has_cv;
+    mean_weight_initialising_ = initialising;
+    mean_weight_revision_ = revision;
+
   } else if (model_->partition_type() == PartitionType::kLength) {
     // Update mean weight for this category
     LengthWeight* length_weight = categories->length_weight(name_);
     // Only do this under two conditions. We are initialising, it has a time varying component
     if (model_->state() == State::kInitialise) {
-      vector<unsigned> length_bins = model_->length_bins();
-      for (unsigned step_iter = 0; step_iter < time_steps.size(); ++step_iter) {
+      if (mean_weight_built_ && mean_weight_revision_ == length_weight->revision())
+        return;
+
+      const vector<unsigned>& length_bins = model_->length_bins();
+      for (unsigned step_iter = 0; step_iter < time_step_count; ++step_iter) {
         for (unsigned length_bin_index = 0; length_bin_index < length_bins.size(); ++length_bin_index) {
           //Double size = 0;
           //if (!niwa::utilities::To<Double>(length_bins[length_bin_index], size))
@@ -99,6 +124,9 @@ void Category::UpdateMeanWeightData() {
           mean_weight_by_time_step_length_[step_iter][length_bin_index] = length_weight->mean_weight(length_bins[length_bin_index], Distribution::kNone,0.0);
         }
       }
+
+      mean_weight_built_    = true;
+      mean_weight_revision_ = length_weight->revision();
     }
   }
 }
@@ -144,33 +172,32 @@ void Category::PopulateAgeLengthMatrix(Selectivity* selectivity) {
   unsigned time_step_index = model_->managers()->time_step()->current_time_step();
 
   LOG_FINEST() << "Year: " << year << "; time_step: " << time_step_index << "; length_bins: " << length_bins.size();
-  LOG_FINEST() << "Years in proportions: " << age_length_proportions.size();
-  LOG_FINEST() << "Timesteps in current year: " << age_length_proportions[year].size();
+  LOG_FINEST() << "Years in proportions: " << age_length_proportions.year_count();
+  LOG_FINEST() << "Timesteps in current year: " << age_length_proportions.time_step_count();
 
-  if (year > age_length_proportions.size())
-    LOG_CODE_ERROR() << "year > age_length_proportions.size()";
-  if (time_step_index > age_length_proportions[year].size())
-    LOG_CODE_ERROR() << "time_step_index > age_length_proportions[year].size()";
-  vector<vector<Double>>& proportions_for_now = age_length_proportions[year][time_step_index];
+  if (year >= age_length_proportions.year_count())
+    LOG_CODE_ERROR() << "year >= age_length_proportions.year_count()";
+  if (time_step_index >= age_length_proportions.time_step_count())
+    LOG_CODE_ERROR() << "time_step_index >= age_length_proportions.time_step_count()";
 
   unsigned size = model_->length_plus() == true ? model_->length_bins().size() : model_->length_bins().size() - 1;
   LOG_FINEST() << "Calculating age length data";
   for (unsigned age = min_age_; age <= max_age_; ++age) {
     unsigned i = age - min_age_;
-    if (i >= proportions_for_now.size())
-      LOG_CODE_ERROR() << "i >= proportions_for_now.size()";
+    if (i >= age_length_proportions.age_count())
+      LOG_CODE_ERROR() << "i >= age_length_proportions.age_count()";
     if (i >= data_.size())
       LOG_CODE_ERROR() << "i >= data_.size()";
     if (i >= age_length_matrix_.size())
       LOG_CODE_ERROR() << "(i >= age_length_matrix_.size())";
 
-    vector<Double>& ages_at_length = proportions_for_now[i];
+    const Double* ages_at_length = age_length_proportions(year, time_step_index, i);
 
     for (unsigned bin = 0; bin < size; ++bin) {
       if (bin >= age_length_matrix_[i].size())
         LOG_CODE_ERROR() << "bin (" << bin << ") >= age_length_matrix_[i].size(" << age_length_matrix_[i].size() << ")";
-      if (bin >= ages_at_length.size())
-        LOG_CODE_ERROR() << "bin >= ages_at_length.size()";
+      if (bin >= age_length_proportions.length_bin_count())
+        LOG_CODE_ERROR() << "bin >= age_length_proportions.length_bin_count()";
 
       age_length_matrix_[i][bin] = selectivity->GetAgeResult(age, age_length_) * data_[i] * ages_at_length[bin];
     }
@@ -210,28 +237,29 @@ void Category::CalculateNumbersAtLength(Selectivity* selectivity,const vector<Do
   std::fill(numbers_by_length.begin(),numbers_by_length.end(), 0.0);
 
   auto& age_length_proportions = model_->partition().age_length_proportions(name_);
+  // Cached copies of a category do not carry the mean length table, so use the one in the partition
+  auto& mean_length_by_time_step_age = model_->partition().category(name_).mean_length_by_time_step_age_;
   unsigned year_ndx = model_->current_year() - model_->start_year();
   unsigned time_step_index = model_->managers()->time_step()->current_time_step();
 
-  if (year_ndx > age_length_proportions.size())
-    LOG_CODE_ERROR() << "year_ndx > age_length_proportions.size()";
-  if (time_step_index > age_length_proportions[year_ndx].size())
-    LOG_CODE_ERROR() << "time_step_index > age_length_proportions[year].size()";
-  vector<vector<Double>>& proportions_for_now = age_length_proportions[year_ndx][time_step_index];
+  if (year_ndx >= age_length_proportions.year_count())
+    LOG_CODE_ERROR() << "year_ndx >= age_length_proportions.year_count()";
+  if (time_step_index >= age_length_proportions.time_step_count())
+    LOG_CODE_ERROR() << "time_step_index >= age_length_proportions.time_step_count()";
 
   LOG_FINEST() << "Calculating age length data";
   for (unsigned age = min_age_; age <= max_age_; ++age) {
     unsigned i = age - min_age_;
-    std_dev = age_length_->cv(model_->current_year(), time_step_index,age) * mean_length_by_time_step_age_[year_ndx][time_step_index][i];
-    if (i >= proportions_for_now.size())
-      LOG_CODE_ERROR() << "i >= proportions_for_now.size()";
+    std_dev = age_length_->cv(model_->current_year(), time_step_index,age) * mean_length_by_time_step_age[year_ndx][time_step_index][i];
+    if (i >= age_length_proportions.age_count())
+      LOG_CODE_ERROR() << "i >= age_length_proportions.age_count()";
     if (i >= data_.size())
       LOG_CODE_ERROR() << "i >= data_.size()";
     if (i >= age_length_matrix.size())
       LOG_CODE_ERROR() << "(i >= age_length_matrix.size())";
 
     // populate age_length matrix with proportions
-    age_length_matrix[i] = utilities::math::distribution(length_bins, length_plus_group, age_length_->distribution(), mean_length_by_time_step_age_[year_ndx][time_step_index][i], std_dev);
+    age_length_matrix[i] = utilities::math::distribution(length_bins, length_plus_group, age_length_->distribution(), mean_length_by_time_step_age[year_ndx][time_step_index][i], std_dev);
     if (age_length_matrix[i].size() != numbers_by_length.size())
       LOG_CODE_ERROR() << "if (age_length_matrix[i].size() != numbers_by_length.size()). Age length dims were " << age_length_matrix[i].size() << " we wanted " << numbers_by_length.size();
     // Multiply by data_
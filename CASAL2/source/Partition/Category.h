@@ -21,6 +21,7 @@
 #include <vector>
 #include <string>
 
+#include "../Partition/CategoryData.h"
 #include "../Utilities/Types.h"
 #include "../Selectivities/Selectivity.h"
 
@@ -64,22 +65,28 @@ public:
   unsigned                    min_age_ = 0;
   unsigned                    max_age_ = 0;
   vector<unsigned>            years_;
-  vector<Double>              data_;
+  CategoryData                data_;
   vector<Double>              length_data_;
   vector<vector<Double>>      age_length_matrix_; // age_length_matrix_[age][length]
 
   vector<vector<vector<Double>>> mean_length_by_time_step_age_; // value[year][time_step][age] = length;
+  unsigned                    mean_length_revision_ = 0; // revision of the age length the mean lengths were built from
 
 
 //  map<unsigned, map<unsigned, Double>> mean_length_by_time_step_age_; // map<time_step, age, length>
-  map<unsigned, map<unsigned, Double>> mean_weight_by_time_step_age_; // map<time_step, age, weight>
-  map<unsigned, map<unsigned, Double>> mean_weight_by_time_step_length_; // map<time_step, length_bin_index, weight>
+  vector<vector<Double>>      mean_weight_by_time_step_age_; // value[time_step][age] = weight
+  vector<vector<Double>>      mean_weight_by_time_step_length_; // value[time_step][length_bin_index] = weight
 
   AgeLength*                  age_length_ = nullptr;
 
 private:
   // members
   shared_ptr<Model>                      model_ = nullptr;
+  bool                        mean_weight_built_ = false;
+  unsigned                    mean_weight_year_ = 0;
+  bool                        mean_weight_has_cv_ = false;
+  bool                        mean_weight_initialising_ = false; // built with the initialisation mean lengths
+  unsigned                    mean_weight_revision_ = 0;
 
   // TODO: Re-enable this when we have a single unified accessor
   //DISALLOW_COPY_AND_ASSIGN(Category);
@@ -0,0 +1,99 @@
+/**
+ * @file CategoryData.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "CategoryData.h"
+
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace partition {
+
+/**
+ * Check the data can be attached to a block of memory and
+ * that writes go straight through to it
+ */
+TEST(CategoryData, Attach) {
+  CategoryData data;
+  data.resize(3, 1.0);
+  EXPECT_FALSE(data.attached());
+
+  vector<Double> memory(5, 0.0);
+  data.Attach(memory.data() + 2, 3);
+  EXPECT_TRUE(data.attached());
+  ASSERT_EQ(3u, data.size());
+  EXPECT_DOUBLE_EQ(1.0, memory[2]);
+  EXPECT_DOUBLE_EQ(1.0, memory[4]);
+
+  data[1] = 7.0;
+  *data.rbegin() += 2.0;
+  EXPECT_DOUBLE_EQ(7.0, memory[3]);
+  EXPECT_DOUBLE_EQ(3.0, memory[4]);
+
+  data.assign(3, 0.5);
+  EXPECT_TRUE(data.attached());
+  EXPECT_DOUBLE_EQ(0.0, memory[1]);
+  EXPECT_DOUBLE_EQ(0.5, memory[2]);
+  EXPECT_DOUBLE_EQ(0.5, memory[4]);
+}
+
+/**
+ * Check that copies own their memory and that assigning
+ * to an attached object copies in place
+ */
+TEST(CategoryData, Copy) {
+  vector<Double> memory(3, 0.0);
+  CategoryData data;
+  data.resize(3);
+  data.Attach(memory.data(), 3);
+
+  CategoryData copy = data;
+  EXPECT_FALSE(copy.attached());
+  copy[0] = 10.0;
+  EXPECT_DOUBLE_EQ(0.0, memory[0]);
+
+  copy[0] = 4.0;
+  copy[1] = 5.0;
+  copy[2] = 6.0;
+  data = copy;
+  EXPECT_TRUE(data.attached());
+  EXPECT_DOUBLE_EQ(4.0, memory[0]);
+  EXPECT_DOUBLE_EQ(6.0, memory[2]);
+
+  vector<Double> values = data;
+  ASSERT_EQ(3u, values.size());
+  EXPECT_DOUBLE_EQ(5.0, values[1]);
+}
+
+/**
+ * Check that changing the size of an attached object stops it
+ * being a view without changing the memory it was attached to
+ */
+TEST(CategoryData, Resize) {
+  vector<Double> memory(2, 0.0);
+  CategoryData data;
+  data.assign(2, 1.0);
+  data.Attach(memory.data(), 2);
+
+  data.push_back(3.0);
+  EXPECT_FALSE(data.attached());
+  ASSERT_EQ(3u, data.size());
+  EXPECT_DOUBLE_EQ(1.0, data[0]);
+  EXPECT_DOUBLE_EQ(3.0, data[2]);
+
+  data[0] = 9.0;
+  EXPECT_DOUBLE_EQ(1.0, memory[0]);
+}
+
+} /* namespace partition */
+} /* namespace niwa */
+#endif /* TESTMODE */
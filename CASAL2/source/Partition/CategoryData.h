@@ -0,0 +1,147 @@
+/**
+ * @file CategoryData.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class holds the numbers at age (or length) for a single category.
+ *
+ * When the category belongs to the partition the values are a view in to a
+ * single contiguous block of memory owned by the partition. This means the
+ * whole partition can be swept in one pass and the categories sit next to
+ * each other in memory instead of being spread across the heap.
+ *
+ * Copies (e.g. the cached categories) always own their own memory so they
+ * behave the same way a vector<Double> would. If a view is resized it will
+ * take a copy of its values and stop being a view.
+ */
+#ifndef SOURCE_PARTITION_CATEGORYDATA_H_
+#define SOURCE_PARTITION_CATEGORYDATA_H_
+
+// headers
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#include "../Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace partition {
+
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * Class definition
+ */
+class CategoryData {
+public:
+  // typedefs
+  typedef Double*                               iterator;
+  typedef const Double*                         const_iterator;
+  typedef std::reverse_iterator<Double*>        reverse_iterator;
+  typedef std::reverse_iterator<const Double*>  const_reverse_iterator;
+
+  // methods
+  CategoryData() = default;
+  CategoryData(const CategoryData& rhs) : owned_(rhs.begin(), rhs.end()) { Own(); }
+  CategoryData(const vector<Double>& rhs) : owned_(rhs) { Own(); }
+  virtual                     ~CategoryData() = default;
+  CategoryData&               operator=(const CategoryData& rhs) { if (this != &rhs) Copy(rhs.begin(), rhs.size()); return *this; }
+  CategoryData&               operator=(const vector<Double>& rhs) { Copy(rhs.data(), rhs.size()); return *this; }
+  operator                    vector<Double>() const { return vector<Double>(begin(), end()); }
+
+  /**
+   * Make this object a view in to memory owned by someone else (the partition).
+   * The current values are copied in to the new memory.
+   *
+   * @param data The first value of the memory to view
+   * @param size The number of values in the view
+   */
+  void Attach(Double* data, unsigned size) {
+    std::copy(begin(), begin() + std::min(size, size_), data);
+    owned_.clear();
+    owned_.shrink_to_fit();
+    data_     = data;
+    size_     = size;
+    attached_ = true;
+  }
+
+  // vector<Double> style methods
+  unsigned                    size() const { return size_; }
+  bool                        empty() const { return size_ == 0; }
+  Double&                     operator[](unsigned index) { return data_[index]; }
+  const Double&               operator[](unsigned index) const { return data_[index]; }
+  Double*                     data() { return data_; }
+  iterator                    begin() { return data_; }
+  iterator                    end() { return data_ + size_; }
+  const_iterator              begin() const { return data_; }
+  const_iterator              end() const { return data_ + size_; }
+  reverse_iterator            rbegin() { return reverse_iterator(end()); }
+  reverse_iterator            rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator      rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator      rend() const { return const_reverse_iterator(begin()); }
+
+  void assign(unsigned size, Double value) {
+    resize(size);
+    std::fill(begin(), end(), value);
+  }
+
+  void resize(unsigned size, Double value = 0.0) {
+    if (size == size_)
+      return;
+    Detach();
+    owned_.resize(size, value);
+    Own();
+  }
+
+  void clear() { resize(0); }
+
+  void push_back(Double value) {
+    Detach();
+    owned_.push_back(value);
+    Own();
+  }
+
+  // accessors
+  bool                        attached() const { return attached_; }
+
+private:
+  // methods
+  void Copy(const Double* values, unsigned size) {
+    if (size != size_) {
+      Detach();
+      owned_.assign(values, values + size);
+      Own();
+    } else
+      std::copy(values, values + size, data_);
+  }
+
+  void Detach() {
+    if (attached_) {
+      owned_.assign(begin(), end());
+      attached_ = false;
+    }
+  }
+
+  void Own() {
+    data_ = owned_.data();
+    size_ = owned_.size();
+  }
+
+  // members
+  vector<Double>              owned_;
+  Double*                     data_ = nullptr;
+  unsigned                    size_ = 0;
+  bool                        attached_ = false;
+};
+
+} /* namespace partition */
+} /* namespace niwa */
+
+#endif /* SOURCE_PARTITION_CATEGORYDATA_H_ */
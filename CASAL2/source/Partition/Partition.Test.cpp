@@ -14,19 +14,23 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <boost/algorithm/string/replace.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "../AgeLengths/Age/VonBertalanffy.h"
 #include "../Categories/Categories.h"
+#include "../Model/Objects.h"
 #include "../Selectivities/Common/Logistic.h"
 #include "../TimeSteps/Manager.h"
 #include "../TestResources/MockClasses/Managers.h"
 #include "../TestResources/MockClasses/Model.h"
+#include "../TestResources/TestFixtures/InternalEmptyModel.h"
 
 // namespaces
 namespace niwa {
 using ::testing::Return;
 using ::testing::ReturnRef;
+using niwa::testfixtures::InternalEmptyModel;
 
 // classes
 class MockTimeStepManager : public timesteps::Manager {
@@ -89,7 +93,7 @@ public:
   double override_cv_ = 0.0;
   Double cv(unsigned year, unsigned time_step, unsigned age) override final {
     if (override_cv_ == 0.0)
-      return cvs_[year][time_step][age];
+      return AgeLength::cv(year, time_step, age);
     return override_cv_;
   };
 };
@@ -199,6 +203,36 @@ TEST(Partition, BuildMeanLength) {
   EXPECT_DOUBLE_EQ(28.887625277446702, male_mature.mean_length_by_time_step_age_[0][0][9]);
 }
 
+/**
+ * This method will test the mean weight tables are dense, indexed
+ * by time step and age and filled when the partition is built for
+ * categories without an age length
+ */
+TEST(Partition, BuildMeanWeight) {
+  shared_ptr<MockModel> model = shared_ptr<MockModel>(new MockModel());
+  MockCategories mock_categories(model);
+  MockPartition partition(model);
+
+  model->bind_calls();
+  EXPECT_CALL(*model, categories()).WillRepeatedly(Return(&mock_categories));
+
+  ASSERT_NO_THROW(mock_categories.Validate());
+  ASSERT_NO_THROW(partition.Validate());
+  ASSERT_NO_THROW(partition.Build());
+
+  auto& male_mature = partition.category("male.mature");
+  ASSERT_EQ(2u, male_mature.mean_weight_by_time_step_age_.size());
+  ASSERT_EQ(11u, male_mature.mean_weight_by_time_step_age_[0].size());
+  EXPECT_DOUBLE_EQ(0.0, male_mature.mean_weight_by_time_step_age_[0][0]);
+  EXPECT_DOUBLE_EQ(1.0, male_mature.mean_weight_by_time_step_age_[0][1]);
+  EXPECT_DOUBLE_EQ(1.0, male_mature.mean_weight_by_time_step_age_[1][10]);
+
+  // A second call with nothing changed leaves the table alone
+  male_mature.mean_weight_by_time_step_age_[1][10] = 2.0;
+  ASSERT_NO_THROW(male_mature.UpdateMeanWeightData());
+  EXPECT_DOUBLE_EQ(2.0, male_mature.mean_weight_by_time_step_age_[1][10]);
+}
+
 /**
  * This method will test the X method
  */
@@ -240,41 +274,41 @@ TEST(Partition, BuildAgeLengthProportions) {
 
   auto& male_age_props = partition.age_length_proportions("male.immature");
   // vector<year, time_step, age, length, proportion>>;
-  ASSERT_EQ(3u, male_age_props.size());
-  ASSERT_EQ(2u, male_age_props[0].size());
-  ASSERT_EQ(10u, male_age_props[0][0].size());
-  ASSERT_EQ(5u, male_age_props[0][0][0].size());
+  ASSERT_EQ(3u, male_age_props.year_count());
+  ASSERT_EQ(2u, male_age_props.time_step_count());
+  ASSERT_EQ(10u, male_age_props.age_count());
+  ASSERT_EQ(5u, male_age_props.length_bin_count());
 
   for (unsigned year = 0; year < 3; ++year) {
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][0][0]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][0][1]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][0][2]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][0][3]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][0][4]);
-
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][2][0]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][2][1]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][2][2]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][2][3]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][2][4]);
-
-  EXPECT_DOUBLE_EQ(0.41996720731752746,     male_age_props[year][0][4][0]);
-  EXPECT_DOUBLE_EQ(3.2667977767353307e-008, male_age_props[year][0][4][1]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][4][2]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][4][3]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[year][0][4][4]);
-
-  EXPECT_DOUBLE_EQ(0.69070308538891911,      male_age_props[year][0][6][0]);
-  EXPECT_DOUBLE_EQ(0.29603445809402762,      male_age_props[year][0][6][1]);
-  EXPECT_DOUBLE_EQ(0.00048060422206530617,   male_age_props[year][0][6][2]);
-  EXPECT_DOUBLE_EQ(6.4636329621947652e-010,  male_age_props[year][0][6][3]);
-  EXPECT_DOUBLE_EQ(0u, male_age_props[0][0][6][4]);
-
-  EXPECT_DOUBLE_EQ(0.13891252421751288, male_age_props[year][0][8][0]);
-  EXPECT_DOUBLE_EQ(0.67051952644369806, male_age_props[year][0][8][1]);
-  EXPECT_DOUBLE_EQ(0.18713059299787771, male_age_props[year][0][8][2]);
-  EXPECT_DOUBLE_EQ(0.0022533864694446182, male_age_props[year][0][8][3]);
-  EXPECT_DOUBLE_EQ(7.9325922641704238e-007, male_age_props[year][0][8][4]);
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 0, 0));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 0, 1));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 0, 2));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 0, 3));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 0, 4));
+
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 2, 0));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 2, 1));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 2, 2));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 2, 3));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 2, 4));
+
+  EXPECT_DOUBLE_EQ(0.41996720731752746,     male_age_props(year, 0, 4, 0));
+  EXPECT_DOUBLE_EQ(3.2667977767353307e-008, male_age_props(year, 0, 4, 1));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 4, 2));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 4, 3));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(year, 0, 4, 4));
+
+  EXPECT_DOUBLE_EQ(0.69070308538891911,      male_age_props(year, 0, 6, 0));
+  EXPECT_DOUBLE_EQ(0.29603445809402762,      male_age_props(year, 0, 6, 1));
+  EXPECT_DOUBLE_EQ(0.00048060422206530617,   male_age_props(year, 0, 6, 2));
+  EXPECT_DOUBLE_EQ(6.4636329621947652e-010,  male_age_props(year, 0, 6, 3));
+  EXPECT_DOUBLE_EQ(0u, male_age_props(0, 0, 6, 4));
+
+  EXPECT_DOUBLE_EQ(0.13891252421751288, male_age_props(year, 0, 8, 0));
+  EXPECT_DOUBLE_EQ(0.67051952644369806, male_age_props(year, 0, 8, 1));
+  EXPECT_DOUBLE_EQ(0.18713059299787771, male_age_props(year, 0, 8, 2));
+  EXPECT_DOUBLE_EQ(0.0022533864694446182, male_age_props(year, 0, 8, 3));
+  EXPECT_DOUBLE_EQ(7.9325922641704238e-007, male_age_props(year, 0, 8, 4));
   }
 }
 
@@ -326,10 +360,10 @@ TEST(Partition, BuildAgeLengthProportions_2) {
 
   auto& male_age_props = partition.age_length_proportions("male.mature");
   // vector<year, time_step, age, length, proportion>>;
-  ASSERT_EQ(3u, male_age_props.size());
-  ASSERT_EQ(2u, male_age_props[0].size());
-  ASSERT_EQ(10u, male_age_props[0][0].size());
-  ASSERT_EQ(34u, male_age_props[0][0][0].size());
+  ASSERT_EQ(3u, male_age_props.year_count());
+  ASSERT_EQ(2u, male_age_props.time_step_count());
+  ASSERT_EQ(10u, male_age_props.age_count());
+  ASSERT_EQ(34u, male_age_props.length_bin_count());
 
   vector<Double> expected = {3.8713535710499514e-009, 1.5960216925847703e-008, 7.422358561104403e-008, 3.1901955588331532e-007, 1.2672619864595447e-006, 4.6525401673491729e-006,
       1.5786604316003761e-005, 4.9506445653380027e-005,0.00014348551812060073, 0.00038434913282614502,0.00095150900849361175, 0.0021770396325317964, 0.0046034492460040877,
@@ -337,11 +371,11 @@ TEST(Partition, BuildAgeLengthProportions_2) {
       0.11201216057229546,0.10767078378048922,0.095652266453105428,0.078533378916068819, 0.059590504250288112, 0.041789131783027234 , 0.027083887651074501, 0.01622250783484136,
       0.0089801483958439343, 0.0045941822881506722, 0.002172170763177772, 0.00094916847523229819, 0.00059778133048304927};
 
-  ASSERT_EQ(expected.size(), male_age_props[0][0][0].size());
+  ASSERT_EQ(expected.size(), male_age_props.length_bin_count());
   for (unsigned i = 0; i < expected.size(); ++i) {
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[0][0][0][i]) << " with i = " << i;
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[1][0][0][i]) << " with i = " << i;
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[2][0][0][i]) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(0, 0, 0, i)) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(1, 0, 0, i)) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(2, 0, 0, i)) << " with i = " << i;
   }
 }
 
@@ -391,10 +425,10 @@ TEST(Partition, BuildAgeLengthProportions_3) {
 
   auto& male_age_props = partition.age_length_proportions("male.mature");
   // vector<year, time_step, age, length, proportion>>;
-  ASSERT_EQ(3u, male_age_props.size());
-  ASSERT_EQ(2u, male_age_props[0].size());
-  ASSERT_EQ(10u, male_age_props[0][0].size());
-  ASSERT_EQ(33u, male_age_props[0][0][0].size());
+  ASSERT_EQ(3u, male_age_props.year_count());
+  ASSERT_EQ(2u, male_age_props.time_step_count());
+  ASSERT_EQ(10u, male_age_props.age_count());
+  ASSERT_EQ(33u, male_age_props.length_bin_count());
 
   vector<Double> expected = {0, 9.9920072216264089e-016,1.1390888232654106e-013, 6.907807659217724e-012, 2.4863089365112501e-010, 5.6808661108576075e-009, 8.7191919018181352e-008,
       9.4269457673323842e-007, 7.4745056608538363e-006, 4.4982380957292456e-005, 0.00021163731992057677, 0.00079862796125962365, 0.0024715534075264722, 0.0063962867724943751,0.01408161729231916,
@@ -402,11 +436,11 @@ TEST(Partition, BuildAgeLengthProportions_3) {
       0.088978990579101747, 0.071552403002032916, 0.054126600808507175, 0.038696543948670059, 0.026257468168220055, 0.016976053665368585, 0.010494572238876954, 0.0062237099943515117,
       0.0035513001369547048,0.0019551097231892411 };
 
-  ASSERT_EQ(expected.size(), male_age_props[0][0][0].size());
+  ASSERT_EQ(expected.size(), male_age_props.length_bin_count());
   for (unsigned i = 0; i < expected.size(); ++i) {
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[0][0][0][i]) << " with i = " << i;
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[1][0][0][i]) << " with i = " << i;
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[2][0][0][i]) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(0, 0, 0, i)) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(1, 0, 0, i)) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(2, 0, 0, i)) << " with i = " << i;
   }
 }
 
@@ -456,18 +490,145 @@ TEST(Partition, BuildAgeLengthProportions_4) {
 
   auto& male_age_props = partition.age_length_proportions("male.mature");
   // vector<year, time_step, age, length, proportion>>;
-  ASSERT_EQ(3u, male_age_props.size());
-  ASSERT_EQ(2u, male_age_props[0].size());
-  ASSERT_EQ(10u, male_age_props[0][0].size());
-  ASSERT_EQ(5u, male_age_props[0][0][0].size());
+  ASSERT_EQ(3u, male_age_props.year_count());
+  ASSERT_EQ(2u, male_age_props.time_step_count());
+  ASSERT_EQ(10u, male_age_props.age_count());
+  ASSERT_EQ(5u, male_age_props.length_bin_count());
 
   vector<Double> expected = {2.7232626398365767e-007, 0.49187561267029634, 0.50812377877585069, 3.3622758899287675e-007,0};
 
-  ASSERT_EQ(expected.size(), male_age_props[0][0][0].size());
+  ASSERT_EQ(expected.size(), male_age_props.length_bin_count());
   for (unsigned i = 0; i < expected.size(); ++i) {
-    EXPECT_DOUBLE_EQ(expected[i], male_age_props[0][0][0][i]) << " with i = " << i;
+    EXPECT_DOUBLE_EQ(expected[i], male_age_props(0, 0, 0, i)) << " with i = " << i;
   }
 }
+
+const std::string test_cases_partition_two_age_lengths =
+R"(
+@model
+start_year 1990
+final_year 1992
+min_age 1
+max_age 10
+age_plus true
+base_weight_units kgs
+initialisation_phases iphase1
+time_steps step1
+length_bins 0 10 20 30 40 50 60
+length_plus true
+
+@categories
+format sex
+names male female
+age_lengths male_growth female_growth
+
+@initialisation_phase iphase1
+type iterative
+years 20
+
+@time_step step1
+processes Recruitment Ageing
+
+@recruitment Recruitment
+type constant
+categories male female
+proportions 0.5 0.5
+R0 1000
+age 1
+
+@process Ageing
+type ageing
+categories male female
+
+@age_length male_growth
+type von_bertalanffy
+by_length false
+linf 60
+k 0.3
+t0 -0.2
+cv_first 0.1
+cv_last 0.2
+length_weight size_weight
+
+@age_length female_growth
+type von_bertalanffy
+by_length false
+linf 70
+k 0.25
+t0 -0.2
+cv_first 0.1
+cv_last 0.2
+length_weight size_weight
+
+@length_weight size_weight
+type basic
+units kgs
+a 2.0e-6
+b 3.288
+)";
+
+/**
+ * Copy the age length proportions of a category in the order they're stored
+ */
+vector<Double> CopyAgeLengthProportions(shared_ptr<Model> model, const string& category) {
+  auto& proportions = model->partition().age_length_proportions(category);
+  vector<Double> values;
+  for (unsigned age_index = 0; age_index < proportions.age_count(); ++age_index)
+    for (unsigned length_bin = 0; length_bin < proportions.length_bin_count(); ++length_bin)
+      values.push_back(proportions(0, 0, age_index, length_bin));
+  return values;
+}
+
+/**
+ * Check that changing the parameters of an age length between model runs
+ * rebuilds the age length proportions of its categories on the next reset. Only
+ * the rows that depend on the changed parameters change, and they match the
+ * proportions built by a model that was configured with the new values.
+ */
+TEST_F(InternalEmptyModel, Partition_Rebuild_Age_Length_Proportions_On_Reset) {
+  AddConfigurationLine(test_cases_partition_two_age_lengths, __FILE__, 506);
+  LoadConfiguration();
+  ASSERT_TRUE(model_->PrepareForIterations());
+  model_->FullIteration();
+
+  vector<Double> male   = CopyAgeLengthProportions(model_, "male");
+  vector<Double> female = CopyAgeLengthProportions(model_, "female");
+  unsigned length_bin_count = model_->partition().age_length_proportions("male").length_bin_count();
+  ASSERT_EQ(10u * length_bin_count, male.size());
+
+  // The cv is interpolated by age from cv_first so changing cv_last changes every age except the first
+  *model_->objects().GetAddressable("age_length[male_growth].cv_last") = 0.3;
+  model_->FullIteration();
+
+  vector<Double> rebuilt_male = CopyAgeLengthProportions(model_, "male");
+  EXPECT_EQ(female, CopyAgeLengthProportions(model_, "female"));
+  for (unsigned i = 0; i < length_bin_count; ++i)
+    EXPECT_DOUBLE_EQ(male[i], rebuilt_male[i]) << " with i = " << i;
+  unsigned changed = 0;
+  for (unsigned i = length_bin_count; i < male.size(); ++i)
+    changed += male[i] != rebuilt_male[i] ? 1 : 0;
+  EXPECT_LT(9u, changed);
+
+  // k changes the mean length of every age
+  *model_->objects().GetAddressable("age_length[male_growth].k") = 0.35;
+  model_->FullIteration();
+  rebuilt_male = CopyAgeLengthProportions(model_, "male");
+  EXPECT_EQ(female, CopyAgeLengthProportions(model_, "female"));
+
+  // Build the proportions from scratch with the new values
+  string configuration = test_cases_partition_two_age_lengths;
+  boost::replace_first(configuration, "k 0.3\nt0 -0.2\ncv_first 0.1\ncv_last 0.2", "k 0.35\nt0 -0.2\ncv_first 0.1\ncv_last 0.3");
+  ASSERT_NE(test_cases_partition_two_age_lengths, configuration);
+  configuration_file_.clear();
+  AddConfigurationLine(configuration, __FILE__, 506);
+  shared_ptr<Model> model = LoadConfigurationInToNewModel();
+  ASSERT_TRUE(model->PrepareForIterations());
+
+  vector<Double> built_male = CopyAgeLengthProportions(model, "male");
+  ASSERT_EQ(built_male.size(), rebuilt_male.size());
+  for (unsigned i = 0; i < built_male.size(); ++i)
+    EXPECT_DOUBLE_EQ(built_male[i], rebuilt_male[i]) << " with i = " << i;
+}
 } /* namespace niwa */
 #endif
 
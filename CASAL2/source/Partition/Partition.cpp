@@ -16,6 +16,7 @@
 // Headers
 #include "Partition.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "../AgeLengths/AgeLength.h"
@@ -79,11 +80,36 @@ void Partition::Build() {
         }
       }
 
+      // Allocate memory for the mean weights. Categories with an age length are
+      // filled once the age lengths have been built, the rest weigh 1.0 at every age
+      new_category->mean_weight_by_time_step_age_.assign(model_->time_steps().size(), vector<Double>(new_category->max_age_ + 1, 0.0));
+      if (new_category->age_length_ == nullptr)
+        new_category->UpdateMeanWeightData();
+
     } else if (model_->partition_type() == PartitionType::kLength) {
       unsigned length_bins = model_->length_bins().size();
       new_category->data_.resize(length_bins, 0.0);
+      new_category->mean_weight_by_time_step_length_.assign(model_->time_steps().size(), vector<Double>(length_bins, 0.0));
     }
+    new_category->id_ = categories_.size();
     partition_[category] = new_category;
+    categories_.push_back(new_category);
+  }
+
+  /**
+   * Move the data for every category in to a single block of memory
+   * so the whole partition is contiguous, in category id_ order
+   */
+  unsigned size = 0;
+  for (auto category : categories_)
+    size += category->data_.size();
+  data_.assign(size, 0.0);
+
+  unsigned offset = 0;
+  for (auto category : categories_) {
+    unsigned category_size = category->data_.size();
+    category->data_.Attach(data_.data() + offset, category_size);
+    offset += category_size;
   }
 }
 
@@ -94,6 +120,9 @@ void Partition::Build() {
  * memory and set the values to be used by the model. This is called now because the values
  * are needed by the Partition::BuildAgeLengthProportions() method to build all of the
  * proportions.
+ *
+ * It is called again by Model::Reset() and only rebuilds the categories whose age length
+ * has changed (e.g. new estimates or -i values) since their mean lengths were built.
  */
 void Partition::BuildMeanLengthData() {
   LOG_TRACE();
@@ -106,7 +135,10 @@ void Partition::BuildMeanLengthData() {
   for (auto iter : partition_) {
     auto& category = *iter.second; // mean_length_by_time_step_age_
     if (category.age_length_ == nullptr)
-      return;
+      continue;
+    unsigned revision = category.age_length_->revision();
+    if (category.mean_length_by_time_step_age_.size() != 0 && category.mean_length_revision_ == revision)
+      continue;
 
     // Allocate memory for the mean_length_by_time_step_age if it hasn't been done previously
     if (category.mean_length_by_time_step_age_.size() == 0) {
@@ -130,6 +162,7 @@ void Partition::BuildMeanLengthData() {
         }
       }
     }
+    category.mean_length_revision_ = revision;
     category.UpdateMeanWeightData();
   } // for (auto iter : partition_)
 }
@@ -138,6 +171,11 @@ void Partition::BuildMeanLengthData() {
  * This method will build the age length proportions for each category to be used during
  * processes/observations that need to convert the age partition into length for use
  * in an age based model
+ *
+ * The proportions for each category are kept in one block of memory that is reused
+ * every time they're rebuilt. Model::Reset() rebuilds them after the mean lengths when
+ * a category's age length has changed. Only the rows (year, time step and age) whose
+ * mean length or cv has changed since the last build are recalculated.
  */
 void Partition::BuildAgeLengthProportions() {
   LOG_TRACE();
@@ -145,74 +183,69 @@ void Partition::BuildAgeLengthProportions() {
   if (!model_->categories()->HasAgeLengths())
     return;
 
-  auto year_count         = model_->years().size();
-  auto time_step_count    = model_->time_steps().size();
-  auto length_bin_count   = model_->length_bins().size();
-  unsigned year           = 0;
-  Double mu               = 0.0;
-  Double cv               = 0.0;
-  unsigned age            = 0;
-  Double sigma            = 0.0;
-  Double cv_temp          = 0.0;
-  Double Lvar             = 0.0;
-  Double z                = 0.0;
-  Double tt               = 0.0;
-  Double norm             = 0.0;
-  Double ttt              = 0.0;
-  Double tmp              = 0.0;
-  Double sum              = 0.0;
+  unsigned year_count         = model_->years().size();
+  unsigned time_step_count    = model_->time_steps().size();
+  unsigned start_year         = model_->start_year();
+  bool length_plus            = model_->length_plus();
+  const vector<unsigned>& model_length_bins = model_->length_bins();
+  unsigned length_bin_count   = model_length_bins.size();
+  unsigned matrix_length_bin_count = length_plus ? length_bin_count : length_bin_count - 1;
+  unsigned year               = 0;
+  unsigned age                = 0;
+  Double mu                   = 0.0;
+  Double cv                   = 0.0;
+  Double sigma                = 0.0;
+  Double cv_temp              = 0.0;
+  Double Lvar                 = 0.0;
 
   vector<Double> cum(length_bin_count, 0.0);
-  auto model_length_bins = model_->length_bins();
-  vector<Double> length_bins(model_length_bins.size(), 0.0);
+  vector<Double> length_bins(length_bin_count, 0.0);
 
   LOG_FINEST() << "years: " << year_count << "; time_steps: " << time_step_count << "; length_bins: " << length_bin_count;
-  unsigned matrix_length_bin_count = model_->length_plus() ? length_bin_count : length_bin_count - 1;
   LOG_FINEST() << "matrix_length_bin_count: " << matrix_length_bin_count;
   for (auto iter : partition_) {
     LOG_FINEST() << "Working on " << iter.first;
-    if (iter.second->age_length_->distribution() == Distribution::kLogNormal) {
-      for (unsigned i = 0; i < model_length_bins.size(); ++i) {
+    partition::Category& category = *iter.second;
+    AgeLength* age_length = category.age_length_;
+    auto& proportions = age_length_proportions_[iter.first];
+    if (proportions.IsBuilt(category.mean_length_revision_))
+      continue;
+
+    bool log_normal = age_length->distribution() == Distribution::kLogNormal;
+    if (log_normal) {
+      for (unsigned i = 0; i < length_bin_count; ++i) {
         if (model_length_bins[i] < 0.0001)
           length_bins[i] = log(0.0001);
         else
           length_bins[i] = log(model_length_bins[i]);
       }
     } else {
-      for (unsigned i = 0; i < model_length_bins.size(); ++i)
+      for (unsigned i = 0; i < length_bin_count; ++i)
         length_bins[i] = model_length_bins[i];
     }
 
-    auto age_length_proportion = new utilities::Vector4();
-    age_length_proportion->resize(year_count);
-    for (unsigned year = 0; year < year_count; ++year) {
-      (*age_length_proportion)[year].resize(time_step_count);
-      for (unsigned time_step = 0; time_step < time_step_count; ++time_step) {
-        (*age_length_proportion)[year][time_step].resize(iter.second->age_spread());
-        for (unsigned age_index = 0; age_index < iter.second->age_spread(); ++age_index) {
-          (*age_length_proportion)[year][time_step][age_index].resize(matrix_length_bin_count);
-        }
-      }
-    }
-    LOG_FINEST() << "Memory allocation done";
-
-    bool casal_normal_cdf = iter.second->age_length_->casal_normal_cdf();
-    for (unsigned year_iter = 0; year_iter < year_count; ++year_iter) {
-      year = year_iter + model_->start_year();
-      for (unsigned time_step = 0; time_step < time_step_count; ++time_step) {
-        iter.second->age_length_matrix_.resize(iter.second->age_spread());
+    // allocate memory for the age length matrix
+    category.age_length_matrix_.resize(category.age_spread());
+    for (auto& lengths : category.age_length_matrix_)
+      lengths.resize(matrix_length_bin_count);
 
-        for (unsigned age_index = 0; age_index < iter.second->age_spread(); ++age_index) {
-          // allocate memory for the age length matrix
-          iter.second->age_length_matrix_[age_index].resize(matrix_length_bin_count);
+    // If the age length object is not data, then it doesn't vary by year and we only build the first year
+    bool varies_by_year = age_length->varies_by_years();
+    unsigned build_year_count = varies_by_year ? year_count : std::min(year_count, 1u);
+    proportions.Resize(year_count, time_step_count, category.age_spread(), matrix_length_bin_count, varies_by_year);
 
-          age = age_index + iter.second->min_age_;
-          mu = iter.second->mean_length_by_time_step_age_[year_iter][time_step][age_index];
-          cv = iter.second->age_length_->cv(year, time_step, age);
+    bool casal_normal_cdf = age_length->casal_normal_cdf();
+    unsigned rows_built = 0;
+    for (unsigned year_iter = 0; year_iter < build_year_count; ++year_iter) {
+      year = year_iter + start_year;
+      for (unsigned time_step = 0; time_step < time_step_count; ++time_step) {
+        for (unsigned age_index = 0; age_index < category.age_spread(); ++age_index) {
+          age = age_index + category.min_age_;
+          mu = category.mean_length_by_time_step_age_[year_iter][time_step][age_index];
+          cv = age_length->cv(year, time_step, age);
           sigma = cv * mu;
 
-//          LOG_FINEST() << "year: " << year << "; age: " << age << "; mu: " << mu << "; cv: " << cv << "; sigma: " << sigma;
-          if (iter.second->age_length_->distribution() == Distribution::kLogNormal) {
+          if (log_normal) {
             // Transform parameters in to log space
             cv_temp = sigma / mu;
             Lvar = log(cv_temp * cv_temp + 1.0);
@@ -220,75 +253,116 @@ void Partition::BuildAgeLengthProportions() {
             sigma = sqrt(Lvar);
           }
 
-          for (Double value : length_bins)
-            LOG_FINEST() << "length_bin: " << value;
-          LOG_FINEST() << "mu: " << mu;
-          LOG_FINEST() << "sigma: " << sigma;
-
-          sum = 0;
-          vector<Double>& prop_in_length = (*age_length_proportion)[year_iter][time_step][age_index];
-          for (unsigned j = 0; j < length_bin_count; ++j) {
-            z = fabs((length_bins[j] - mu)) / sigma;
-
-            // If we are using CASAL's Normal CDF function use this switch
-            if (casal_normal_cdf) {
-              tmp = 0.5 * pow((1 + 0.196854 * z + 0.115194 * z * z + 0.000344 * z * z * z + 0.019527 * z * z * z * z), -4);
-            } else {
-              tt = 1.0 / (1.0 + 0.2316419 * z);
-              norm = 1.0 / sqrt(2.0 * M_PI) * exp(-0.5 * z * z);
-              ttt = tt;
-              tmp = 0.319381530 * ttt;
-              ttt = ttt * tt;
-              tmp = tmp - 0.356563782 * ttt;
-              ttt = ttt * tt;
-              tmp = tmp + 1.781477937 * ttt;
-              ttt = ttt * tt;
-              tmp = tmp - 1.821255978 * ttt;
-              ttt = ttt * tt;
-              tmp = tmp + 1.330274429 * ttt;
-              tmp *= norm;
-            }
-            tmp = 1.0 - tmp;
-            cum[j] = tmp;
-            if (length_bins[j] < mu) {
-              cum[j] = 1.0 - cum[j];
-              LOG_FINEST() << "cum[" << j << "]: " << cum[j];
-            }
-            if (j > 0) {
-              prop_in_length[j - 1] = cum[j] - cum[j - 1];
-              sum += prop_in_length[j - 1];
-            }
-          } // for (unsigned j = 0; j < length_bin_count; ++j)
-          if (model_->length_plus())
-            prop_in_length[length_bin_count - 1] = 1.0 - sum - cum[0];
-
-        } // for (unsigned age_index = 0; age_index < iter.second->age_spread(); ++age_index)
+          unsigned row = proportions.row(year_iter, time_step, age_index);
+          if (!proportions.UpdateRow(row, mu, sigma))
+            continue;
+
+          CalculateProportionsInLength(length_bins, mu, sigma, casal_normal_cdf, length_plus, cum, proportions.row_data(row));
+          ++rows_built;
+        } // for (unsigned age_index = 0; age_index < category.age_spread(); ++age_index)
       } // for (unsigned time_step = 0; time_step < time_step_count; ++time_step)
+    } // for (unsigned year_iter = 0; year_iter < build_year_count; ++year_iter)
 
-      // If the age length object is not data, then it doesn't vary by year
-      if (!iter.second->age_length_->varies_by_years()) {
-        auto& source = (*age_length_proportion)[0];
-        for (unsigned year_iter = 1; year_iter < year_count; ++year_iter) {
-          auto& props = (*age_length_proportion)[year_iter];
-          props = source;
-        }
-        break;
-      }
-    } // for (unsigned year_iter = 0; year_iter < year_count; ++year_iter)
+    proportions.set_revision(category.mean_length_revision_);
+    LOG_FINEST() << "Built " << rows_built << " rows of age length proportions for " << iter.first;
+  }
+}
 
-    age_length_proportions_[iter.first] = age_length_proportion;
+/**
+ * Calculate the proportion of an age in each length bin using an approximation of
+ * the cumulative normal distribution.
+ *
+ * The cdf for every length bin is calculated first with no logging or branches in
+ * the loop so the compiler is able to vectorise it. The cdf's below the mean are
+ * then flipped and differenced in to the proportions.
+ *
+ * @param length_bins The length bins (in log space for a lognormal distribution)
+ * @param mu The mean length
+ * @param sigma The standard deviation of the length
+ * @param casal_normal_cdf True if we're using CASAL's normal cdf approximation
+ * @param length_plus True if the last length bin is a plus group
+ * @param cum Working memory, the same size as length_bins
+ * @param prop_in_length The row of proportions to populate
+ */
+void Partition::CalculateProportionsInLength(const vector<Double>& length_bins, Double mu, Double sigma, bool casal_normal_cdf, bool length_plus,
+    vector<Double>& cum, Double* prop_in_length) {
+  unsigned length_bin_count = length_bins.size();
+
+  // If we are using CASAL's Normal CDF function use this switch
+  if (casal_normal_cdf) {
+    for (unsigned j = 0; j < length_bin_count; ++j) {
+      Double z = fabs((length_bins[j] - mu)) / sigma;
+      Double tmp = 0.5 * pow((1 + 0.196854 * z + 0.115194 * z * z + 0.000344 * z * z * z + 0.019527 * z * z * z * z), -4);
+      cum[j] = 1.0 - tmp;
+    }
+  } else {
+    for (unsigned j = 0; j < length_bin_count; ++j) {
+      Double z = fabs((length_bins[j] - mu)) / sigma;
+      Double tt = 1.0 / (1.0 + 0.2316419 * z);
+      Double norm = 1.0 / sqrt(2.0 * M_PI) * exp(-0.5 * z * z);
+      Double ttt = tt;
+      Double tmp = 0.319381530 * ttt;
+      ttt = ttt * tt;
+      tmp = tmp - 0.356563782 * ttt;
+      ttt = ttt * tt;
+      tmp = tmp + 1.781477937 * ttt;
+      ttt = ttt * tt;
+      tmp = tmp - 1.821255978 * ttt;
+      ttt = ttt * tt;
+      tmp = tmp + 1.330274429 * ttt;
+      tmp *= norm;
+      cum[j] = 1.0 - tmp;
+    }
+  }
+
+  for (unsigned j = 0; j < length_bin_count; ++j) {
+    if (length_bins[j] < mu)
+      cum[j] = 1.0 - cum[j];
   }
+
+  Double sum = 0.0;
+  for (unsigned j = 1; j < length_bin_count; ++j) {
+    prop_in_length[j - 1] = cum[j] - cum[j - 1];
+    sum += prop_in_length[j - 1];
+  }
+  if (length_plus)
+    prop_in_length[length_bin_count - 1] = 1.0 - sum - cum[0];
 }
 
 /**
  * Reset our partition so all data values are 0.0
  */
 void Partition::Reset() {
-  for (auto iter = partition_.begin(); iter != partition_.end(); ++iter) {
-    iter->second->data_.assign(iter->second->data_.size(), 0.0);
+  std::fill(data_.begin(), data_.end(), 0.0);
+  for (auto category : categories_) {
+    if (!category->data_.attached())
+      category->data_.assign(category->data_.size(), 0.0);
   }
 }
 
+/**
+ * Store a copy of the data in each category so the partition
+ * can be returned to this state with RestoreSnapshot()
+ */
+void Partition::SaveSnapshot() {
+  for (auto category : categories_) {
+    if (!category->data_.attached())
+      LOG_CODE_ERROR() << "The data for category " << category->name_ << " is no longer stored in the partition";
+  }
+
+  snapshot_ = data_;
+}
+
+/**
+ * Restore the data in each category to the values stored by SaveSnapshot()
+ */
+void Partition::RestoreSnapshot() {
+  if (snapshot_.size() != data_.size())
+    LOG_CODE_ERROR() << "snapshot_.size() " << snapshot_.size() << " != data_.size() " << data_.size();
+
+  std::copy(snapshot_.begin(), snapshot_.end(), data_.begin());
+}
+
 /**
  *  This method will return a reference to one of our partition categories.
  *
@@ -306,12 +380,12 @@ partition::Category& Partition::category(const string& category_label) {
 /**
  *
  */
-utilities::Vector4& Partition::age_length_proportions(const string& category_label) {
+partition::AgeLengthProportions& Partition::age_length_proportions(const string& category_label) {
   auto find_iter = age_length_proportions_.find(category_label);
   if (find_iter == age_length_proportions_.end())
     LOG_FATAL() << "The partition does not have age length proportions for category " << category_label;
 
-  return (*find_iter->second);
+  return find_iter->second;
 }
 
 } /* namespace niwa */
@@ -23,6 +23,7 @@
 #include <string>
 #include <memory>
 
+#include "../Partition/AgeLengthProportions.h"
 #include "../Partition/Category.h"
 #include "../Utilities/Types.h"
 #include "../Utilities/NoCopy.h"
@@ -46,22 +47,32 @@ public:
   void                        Validate();
   void                        Build();
   void                        Reset();
+  void                        SaveSnapshot();
+  void                        RestoreSnapshot();
   void                        Clear() { partition_.clear(); }
   void                        BuildMeanLengthData();
   void                        BuildAgeLengthProportions();
 
   // Accessors
   partition::Category&        category(const string& category_label);
-  utilities::Vector4&         age_length_proportions(const string& category_label);
+  partition::Category&        category(unsigned index) { return *categories_[index]; }
+  unsigned                    category_count() const { return categories_.size(); }
+  vector<Double>&             data() { return data_; }
+  partition::AgeLengthProportions& age_length_proportions(const string& category_label);
 
 protected:
   // Methods
   Partition(shared_ptr<Model> model) : model_(model) { };
+  void                        CalculateProportionsInLength(const vector<Double>& length_bins, Double mu, Double sigma, bool casal_normal_cdf, bool length_plus,
+                                vector<Double>& cum, Double* prop_in_length);
 
   // Members
   shared_ptr<Model>                            model_ = nullptr;
   map<string, partition::Category*> partition_; // map<category label, partition::Category Struct>
-  map<string, utilities::Vector4*>  age_length_proportions_; // map<category, vector<year, time_step, age, length, proportion>>;
+  vector<partition::Category*>      categories_; // vector<category> indexed by category id_
+  vector<Double>                    data_; // contiguous data_ for every category
+  map<string, partition::AgeLengthProportions> age_length_proportions_; // map<category, proportions[year][time_step][age][length]>
+  vector<Double>                    snapshot_; // copy of data_ from SaveSnapshot()
 
   DISALLOW_COPY_AND_ASSIGN(Partition);
 };
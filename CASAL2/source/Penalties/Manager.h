@@ -49,6 +49,8 @@ public:
   penalties::Process*         GetProcessPenalty(const string& label);
   void                        FlagPenalty(const string& label, Double value);
   void                        Reset() override final { flagged_penalties_.clear(); }
+  void                        SaveSnapshot() { snapshot_ = flagged_penalties_; }
+  void                        RestoreSnapshot() { flagged_penalties_ = snapshot_; }
 
   // Accessors
   const vector<Info>&         flagged_penalties() const { return flagged_penalties_; }
@@ -60,6 +62,7 @@ protected:
 private:
   // Members
   vector<Info>                flagged_penalties_;
+  vector<Info>                snapshot_;
 };
 
 } /* namespace penalties */
@@ -32,6 +32,7 @@ Ageing::Ageing(shared_ptr<Model> model)
     partition_(model) {
   process_type_ = ProcessType::kAgeing;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "The labels of the categories", "");
 }
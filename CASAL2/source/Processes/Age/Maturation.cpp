@@ -38,6 +38,7 @@ Maturation::Maturation(shared_ptr<Model> model)
 
   process_type_ = ProcessType::kMaturation;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
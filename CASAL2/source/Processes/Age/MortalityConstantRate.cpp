@@ -34,6 +34,7 @@ MortalityConstantRate::MortalityConstantRate(shared_ptr<Model> model)
   LOG_TRACE();
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "List of categories labels", "");
   parameters_.Bind<Double>(PARAM_M, &m_input_, "Mortality rates", "");
@@ -187,6 +188,21 @@ void MortalityConstantRate::DoReset() {
   total_removals_by_year_.clear();
 }
 
+/**
+ * Store the values we have built up over the years so
+ * they can be restored for each projection
+ */
+void MortalityConstantRate::SaveSnapshot() {
+  snapshot_total_removals_by_year_ = total_removals_by_year_;
+}
+
+/**
+ * Restore the values stored by SaveSnapshot()
+ */
+void MortalityConstantRate::RestoreSnapshot() {
+  total_removals_by_year_ = snapshot_total_removals_by_year_;
+}
+
 /*
  * @fun FillReportCache
  * @description A method for reporting process information
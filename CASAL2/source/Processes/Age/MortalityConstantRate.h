@@ -40,6 +40,8 @@ public:
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   void                        DoReset() override final;
+  void                        SaveSnapshot() override final;
+  void                        RestoreSnapshot() override final;
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
@@ -56,6 +58,7 @@ private:
   accessor::Categories        partition_;
   vector<Selectivity*>        selectivities_;
   vector<Double>              total_removals_by_year_;
+  vector<Double>              snapshot_total_removals_by_year_;
 };
 
 } /* namespace age */
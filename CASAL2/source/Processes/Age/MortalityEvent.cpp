@@ -41,6 +41,7 @@ MortalityEvent::MortalityEvent(shared_ptr<Model> model)
 
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -112,6 +113,24 @@ void MortalityEvent::DoReset() {
   exploitation_.clear();
   actual_catches_.clear();
 }
+
+/**
+ * Store the values we have built up over the years so
+ * they can be restored for each projection
+ */
+void MortalityEvent::SaveSnapshot() {
+  snapshot_exploitation_ = exploitation_;
+  snapshot_actual_catches_ = actual_catches_;
+}
+
+/**
+ * Restore the values stored by SaveSnapshot()
+ */
+void MortalityEvent::RestoreSnapshot() {
+  exploitation_ = snapshot_exploitation_;
+  actual_catches_ = snapshot_actual_catches_;
+}
+
 /**
  * Execute our mortality event object.
  *
@@ -43,6 +43,8 @@ public:
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   void                        DoReset() override final;
+  void                        SaveSnapshot() override final;
+  void                        RestoreSnapshot() override final;
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
@@ -62,6 +64,8 @@ private:
   vector<Selectivity*>        selectivities_;
   map<string, map<unsigned, Double> > vulnerable_;
   penalties::Process*         penalty_ = nullptr;
+  vector<Double>              snapshot_exploitation_;
+  vector<Double>              snapshot_actual_catches_;
 };
 
 } /* namespace age */
@@ -44,6 +44,7 @@ MortalityEventBiomass::MortalityEventBiomass(shared_ptr<Model> model)
 
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -109,6 +110,24 @@ void MortalityEventBiomass::DoReset() {
   exploitation_by_year_.clear();
   actual_catches_.clear();
 }
+
+/**
+ * Store the values we have built up over the years so
+ * they can be restored for each projection
+ */
+void MortalityEventBiomass::SaveSnapshot() {
+  snapshot_exploitation_by_year_ = exploitation_by_year_;
+  snapshot_actual_catches_ = actual_catches_;
+}
+
+/**
+ * Restore the values stored by SaveSnapshot()
+ */
+void MortalityEventBiomass::RestoreSnapshot() {
+  exploitation_by_year_ = snapshot_exploitation_by_year_;
+  actual_catches_ = snapshot_actual_catches_;
+}
+
 /**
  *
  */
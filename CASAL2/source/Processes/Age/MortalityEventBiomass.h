@@ -38,6 +38,8 @@ public:
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   void                        DoReset() override final;
+  void                        SaveSnapshot() override final;
+  void                        RestoreSnapshot() override final;
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
@@ -57,6 +59,8 @@ private:
   string                      penalty_label_ = "";
   penalties::Process*         penalty_ = nullptr;
   string                      unit_;
+  vector<Double>              snapshot_exploitation_by_year_;
+  vector<Double>              snapshot_actual_catches_;
 
 };
 
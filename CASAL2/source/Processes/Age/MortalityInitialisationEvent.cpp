@@ -40,6 +40,7 @@ MortalityInitialisationEvent::MortalityInitialisationEvent(shared_ptr<Model> mod
 
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -42,6 +42,7 @@ MortalityInitialisationEventBiomass::MortalityInitialisationEventBiomass(shared_
 
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
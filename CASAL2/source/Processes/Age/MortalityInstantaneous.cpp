@@ -49,6 +49,7 @@ MortalityInstantaneous::MortalityInstantaneous(shared_ptr<Model> model)
     partition_(model) {
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   catches_table_ = new parameters::Table(PARAM_CATCHES);
   method_table_ = new parameters::Table(PARAM_METHOD);
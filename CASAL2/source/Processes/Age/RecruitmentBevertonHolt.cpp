@@ -19,6 +19,7 @@
 #include "../../InitialisationPhases/Manager.h"
 #include "../../Estimates/Manager.h"
 #include "../../TimeSteps/Manager.h"
+#include "../../Utilities/Map.h"
 #include "../../Utilities/Math.h"
 #include "../../Utilities/To.h"
 
@@ -63,6 +64,7 @@ RecruitmentBevertonHolt::RecruitmentBevertonHolt(shared_ptr<Model> model)
   phase_b0_         = 0;
   process_type_     = ProcessType::kRecruitment;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -311,6 +313,29 @@ void RecruitmentBevertonHolt::DoReset() {
   }
 }
 
+/**
+ * Store the values we have built up over the years so
+ * they can be restored for each projection
+ */
+void RecruitmentBevertonHolt::SaveSnapshot() {
+  snapshot_ssb_values_ = ssb_values_;
+  snapshot_true_ycs_values_ = true_ycs_values_;
+  snapshot_recruitment_values_ = recruitment_values_;
+  snapshot_stand_ycs_value_by_year_ = stand_ycs_value_by_year_;
+  snapshot_year_counter_ = year_counter_;
+}
+
+/**
+ * Restore the values stored by SaveSnapshot()
+ */
+void RecruitmentBevertonHolt::RestoreSnapshot() {
+  ssb_values_ = snapshot_ssb_values_;
+  true_ycs_values_ = snapshot_true_ycs_values_;
+  recruitment_values_ = snapshot_recruitment_values_;
+  utilities::Map::assign(stand_ycs_value_by_year_, snapshot_stand_ycs_value_by_year_);
+  year_counter_ = snapshot_year_counter_;
+}
+
 /**
  * Execute this process.
  */
@@ -37,6 +37,8 @@ public:
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   void                        DoReset() override final;
+  void                        SaveSnapshot() override final;
+  void                        RestoreSnapshot() override final;
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
@@ -74,6 +76,11 @@ private:
   unsigned                    year_counter_ = 0;
   OrderedMap<string, Double>  proportions_by_category_;
   bool                        ycs_standardised_ = true;
+  vector<Double>              snapshot_ssb_values_;
+  vector<Double>              snapshot_true_ycs_values_;
+  vector<Double>              snapshot_recruitment_values_;
+  map<unsigned, Double>       snapshot_stand_ycs_value_by_year_;
+  unsigned                    snapshot_year_counter_ = 0;
 };
 
 } /* namespace age */
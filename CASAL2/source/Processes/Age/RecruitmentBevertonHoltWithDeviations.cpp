@@ -68,6 +68,7 @@ RecruitmentBevertonHoltWithDeviations::RecruitmentBevertonHoltWithDeviations(sha
   phase_b0_         = 0;
   process_type_     = ProcessType::kRecruitment;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -339,6 +340,27 @@ void RecruitmentBevertonHoltWithDeviations::DoReset() {
   }
 }
 
+/**
+ * Store the values we have built up over the years so
+ * they can be restored for each projection
+ */
+void RecruitmentBevertonHoltWithDeviations::SaveSnapshot() {
+  snapshot_ssb_values_ = ssb_values_;
+  snapshot_true_ycs_values_ = true_ycs_values_;
+  snapshot_ycs_values_ = ycs_values_;
+  snapshot_recruitment_values_ = recruitment_values_;
+}
+
+/**
+ * Restore the values stored by SaveSnapshot()
+ */
+void RecruitmentBevertonHoltWithDeviations::RestoreSnapshot() {
+  ssb_values_ = snapshot_ssb_values_;
+  true_ycs_values_ = snapshot_true_ycs_values_;
+  ycs_values_ = snapshot_ycs_values_;
+  recruitment_values_ = snapshot_recruitment_values_;
+}
+
 /**
  * Execute this process.
  *
@@ -38,6 +38,8 @@ public:
   void                        DoValidate() override final;
   void                        DoBuild() override final;
   void                        DoReset() override final;
+  void                        SaveSnapshot() override final;
+  void                        RestoreSnapshot() override final;
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
@@ -79,6 +81,10 @@ private:
   bool                        have_scaled_partition = false;
   DerivedQuantity*            derived_quantity_ = nullptr;
   OrderedMap<string, Double>  proportions_by_category_;
+  vector<Double>              snapshot_ssb_values_;
+  vector<Double>              snapshot_true_ycs_values_;
+  vector<Double>              snapshot_ycs_values_;
+  vector<Double>              snapshot_recruitment_values_;
 
 };
 
@@ -39,6 +39,7 @@ RecruitmentConstant::RecruitmentConstant(shared_ptr<Model> model) : Process(mode
 
   process_type_ = ProcessType::kRecruitment;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
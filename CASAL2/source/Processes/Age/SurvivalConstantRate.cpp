@@ -32,6 +32,7 @@ SurvivalConstantRate::SurvivalConstantRate(shared_ptr<Model> model)
   LOG_TRACE();
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "List of categories", "");
   parameters_.Bind<Double>(PARAM_S, &s_input_, "Survival rates", "");
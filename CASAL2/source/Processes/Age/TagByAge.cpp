@@ -33,6 +33,7 @@ TagByAge::TagByAge(shared_ptr<Model> model)
     from_partition_(model) {
   process_type_ = ProcessType::kTransition;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   numbers_table_ = new parameters::Table(PARAM_NUMBERS);
   proportions_table_ = new parameters::Table(PARAM_PROPORTIONS);
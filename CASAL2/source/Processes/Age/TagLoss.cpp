@@ -34,6 +34,7 @@ TagLoss::TagLoss(shared_ptr<Model> model)
   LOG_TRACE();
   process_type_ = ProcessType::kTransition;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "List of categories", "");
   parameters_.Bind<Double>(PARAM_TAG_LOSS_RATE, &tag_loss_input_, "Tag Loss rates", "");
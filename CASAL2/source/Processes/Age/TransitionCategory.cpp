@@ -39,6 +39,7 @@ TransitionCategory::TransitionCategory(shared_ptr<Model> model)
 
   process_type_ = ProcessType::kTransition;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 }
 
 /**
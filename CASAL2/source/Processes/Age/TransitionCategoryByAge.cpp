@@ -36,6 +36,7 @@ TransitionCategoryByAge::TransitionCategoryByAge(shared_ptr<Model> model)
     from_partition_(model) {
   process_type_ = ProcessType::kTransition;
   partition_structure_ = PartitionType::kAge;
+  supports_snapshot_ = true;
 
   n_table_ = new parameters::Table(PARAM_N);
 
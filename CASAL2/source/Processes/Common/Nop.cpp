@@ -25,6 +25,7 @@ namespace processes {
 Nop::Nop(shared_ptr<Model> model) : Process(model) {
   process_type_ = ProcessType::kNullProcess;
   partition_structure_ = PartitionType::kAge | PartitionType::kLength;
+  supports_snapshot_ = true;
 }
 
 }
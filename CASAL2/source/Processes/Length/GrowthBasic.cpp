@@ -31,6 +31,7 @@ GrowthBasic::GrowthBasic(shared_ptr<Model> model)
     partition_(model) {
   process_type_ = ProcessType::kTransition;
   partition_structure_ = PartitionType::kLength;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "The labels of the categories", "");
   parameters_.Bind<unsigned>(PARAM_NUMBER_OF_GROWTH_EPISODES, &n_growth_episodes_, "Number of growth episodes per year", "");
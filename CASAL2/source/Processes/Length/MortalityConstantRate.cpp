@@ -33,6 +33,7 @@ MortalityConstantRate::MortalityConstantRate(shared_ptr<Model> model)
   LOG_TRACE();
   process_type_ = ProcessType::kMortality;
   partition_structure_ = PartitionType::kLength;
+  supports_snapshot_ = true;
 
   parameters_.Bind<string>(PARAM_CATEGORIES, &category_labels_, "List of categories labels", "");
   parameters_.Bind<Double>(PARAM_M, &m_input_, "Mortality rates", "");
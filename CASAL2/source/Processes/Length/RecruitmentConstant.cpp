@@ -38,6 +38,7 @@ RecruitmentConstant::RecruitmentConstant(shared_ptr<Model> model)
 
   process_type_ = ProcessType::kRecruitment;
   partition_structure_ = PartitionType::kLength;
+  supports_snapshot_ = true;
 }
 
 /**
@@ -54,18 +54,22 @@ public:
   virtual void                DoBuild() = 0;
   virtual void                DoReset() = 0;
   virtual void                DoExecute() = 0;
+  virtual void                SaveSnapshot() { };
+  virtual void                RestoreSnapshot() { };
   virtual void                FillReportCache(ostringstream& cache) { };
   virtual void                FillTabularReportCache(ostringstream& cache, bool first_run) { };
 
   // accessors
   PartitionType               partition_structure() const { return partition_structure_; }
   ProcessType                 process_type() const { return process_type_; }
+  bool                        supports_snapshot() const { return supports_snapshot_; }
 
 protected:
   // members
   shared_ptr<Model>                      model_ = nullptr;
   ProcessType                 process_type_ = ProcessType::kUnknown;
   PartitionType               partition_structure_ = PartitionType::kInvalid;
+  bool                        supports_snapshot_ = false; // true if SaveSnapshot() stores all of the state changed by DoExecute()
   map<unsigned, map<string, vector<Executor*>>> executors_;
 };
 } /* namespace niwa */
@@ -52,7 +52,7 @@ void EmpiricalSampling::DoBuild() {
  */
 void EmpiricalSampling::DoReset() {
   // Build a vector of years that have been resampled with replacement between start_year and end_year
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   Double Random_draw = 0.0;
   unsigned year = 0;
   for (unsigned project_year : years_) {
@@ -48,7 +48,7 @@ void LogNormal::DoBuild() {
  * Reset
  */
 void LogNormal::DoReset() {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   for (unsigned project_year : years_) {
     //if (parameters_.Get(PARAM_RHO)->has_been_defined()) {
     //   lognormal_draw_by_year_[project_year] = rng.normal(0.0, 1.0);
@@ -45,7 +45,7 @@ void LogNormalEmpirical::DoValidate() {
  * Reset
  */
 void LogNormalEmpirical::DoReset() {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   // Empirically calculate the years to sample from
   Double Random_draw = 0.0;
   for (unsigned project_year : years_) {
@@ -34,15 +34,20 @@ UserDefined::UserDefined(shared_ptr<Model> model) : Project(model) {
 void UserDefined::DoBuild() {
   LOG_TRACE();
   equation_ = boost::algorithm::join(equation_input_, " ");
+  compiled_equation_.reset();
 }
 
 /**
- *
+ * Update the value from the equation. The equation is compiled the first
+ * time it is used, once every object has been built, and the compiled
+ * equation is reused for every year and run after that.
  */
 void UserDefined::DoUpdate() {
   LOG_TRACE();
   try {
-    value_ = model_->equation_parser().Parse(equation_);
+    if (!compiled_equation_)
+      compiled_equation_ = model_->equation_parser().Compile(equation_);
+    value_ = compiled_equation_->Evaluate();
   } catch (std::runtime_error& ex) {
     LOG_FATAL() << "In the projection " << label_ << " we could not parse the following equation " << equation_ << " for the following reason: " << ex.what();
   } catch (...) {
@@ -14,6 +14,7 @@
 #define PROJECTS_USER_DEFINED_H_
 
 // headers
+#include "../../EquationParser/CompiledEquation.h"
 #include "../../Projects/Project.h"
 
 // namespaces
@@ -36,6 +37,7 @@ private:
   // members
   vector<string>              equation_input_;
   string                      equation_ = "";
+  shared_ptr<CompiledEquation> compiled_equation_;
   Double                      value_;
 };
 
@@ -84,6 +84,24 @@ void Manager::StoreValues(unsigned current_year) {
   }
 }
 
+/**
+ * Check if any of the projects change their parameter in a year
+ * before the year given.
+ *
+ * @param year The year to check
+ * @return true if a project has a year before year, false otherwise
+ */
+bool Manager::HasProjectedYearsBefore(unsigned year) {
+  for (auto project : objects_) {
+    for (unsigned project_year : project->years()) {
+      if (project_year < year)
+        return true;
+    }
+  }
+
+  return false;
+}
+
 /**
  * Return the project with the name passed in as a parameter.
  * If no process is found then an empty pointer will
@@ -36,6 +36,7 @@ public:
   void                          Build(shared_ptr<Model> model);
   void                          Update(unsigned current_year);
   void                          StoreValues(unsigned current_year);
+  bool                          HasProjectedYearsBefore(unsigned year);
   Project*                      GetProject(const string& label);
 
 protected:
@@ -15,6 +15,8 @@
 #include "../Model/Models/Age.h"
 #include "../TestResources/TestFixtures/InternalEmptyModel.h"
 #include "../DerivedQuantities/Manager.h"
+#include "../Estimables/Estimables.h"
+#include "../Model/Managers.h"
 
 #include "../Utilities/RandomNumberGenerator.h"
 
@@ -212,6 +214,178 @@ TEST_F(InternalEmptyModel,Projection_Run_lognormal) {
   }
 }
 
+/**
+ * Projections that only change parameters after the final year. The year class
+ * strengths of a Beverton-Holt recruitment have to be projected from the final
+ * year so a constant recruitment is used instead
+ */
+const string reuse_history_recruitment =
+R"(@process Recruitment
+type recruitment_constant
+categories HAK4
+proportions 1
+r0 997386
+age 1
+
+)";
+
+const string reuse_history_project =
+R"(
+@project future_catches
+type lognormal
+parameter process[Instantaneou_Mortality].method_fishingwest
+years 2013:2020
+mean 0
+sigma 0.8
+multiplier 800
+
+@report mortality
+type process
+process Instantaneou_Mortality
+
+@report future_catches
+type project
+project future_catches
+)";
+
+/**
+ * A time varying that draws new values each time the model is reset
+ */
+const string random_draw_time_varying =
+R"(
+@time_varying westFSel_mu
+type random_draw
+parameter selectivity[westFSel].mu
+years 2000:2012
+mean 6
+sigma 0.5
+)";
+
+/**
+ * Fixture to run the projections with and without reusing the historical years
+ */
+class ProjectionHistory : public InternalEmptyModel {
+protected:
+  string RunProjections(const string& configuration, bool reuse_history, unsigned threads = 1, std::function<void(shared_ptr<Model>)> set_up = nullptr) {
+    TearDown();
+    SetUp();
+    string model = simple_model;
+    auto start = model.find("@process Recruitment");
+    model.replace(start, model.find("@process Ageing") - start, reuse_history_recruitment);
+    model.insert(model.find("@model\n") + 7, "threads " + std::to_string(threads) + "\n");
+    if (reuse_history)
+      model.insert(model.find("@model\n") + 7, "projection_reuse_history true\n");
+    AddConfigurationLine(model, __FILE__, 28);
+    AddConfigurationLine(configuration, __FILE__, 214);
+    LoadConfiguration();
+
+    utilities::RunParameters parameters;
+    parameters.run_mode_ = RunMode::kProjection;
+    parameters.projection_candidates_ = 4;
+    LoadThreadModels(parameters, [set_up](shared_ptr<Model> model) {
+      if (set_up)
+        set_up(model);
+    });
+    if (HasFatalFailure())
+      return "";
+
+    supports_snapshot_ = model_->managers()->SupportsSnapshot();
+    return StartAndCaptureOutput(RunMode::kProjection);
+  }
+
+  bool supports_snapshot_ = false;
+};
+
+/**
+ * The historical years restored from the snapshot, including the
+ * mortality_instantaneous catches, must give the same reports as
+ * running the historical years for every projection
+ */
+TEST_F(ProjectionHistory, Projection_Reuse_History) {
+  string with_reuse = RunProjections(reuse_history_project, true);
+  EXPECT_TRUE(supports_snapshot_);
+  string without_reuse = RunProjections(reuse_history_project, false);
+  ASSERT_FALSE(HasFailure());
+
+  vector<string::size_type> starts;
+  for (auto start = with_reuse.find("*project[future_catches]"); start != string::npos; start = with_reuse.find("*project[future_catches]", start + 1))
+    starts.push_back(start);
+  ASSERT_EQ(4u, starts.size());
+
+  // each projection draws its own values
+  EXPECT_NE(with_reuse.substr(starts[0], starts[1] - starts[0]), with_reuse.substr(starts[1], starts[2] - starts[1]));
+  EXPECT_EQ(without_reuse, with_reuse);
+}
+
+/**
+ * Reports for a historical year are only produced for the first projection
+ * when the historical years are reused, so reusing them has to be turned on
+ */
+TEST_F(ProjectionHistory, Projection_Reuse_History_Year_Report) {
+  const string partition_report =
+R"(
+@report partition_2005
+type partition
+time_step Sep_Feb
+years 2005
+)";
+
+  auto count_reports = [](const string& output) {
+    unsigned count = 0;
+    for (auto start = output.find("*partition[partition_2005]"); start != string::npos; start = output.find("*partition[partition_2005]", start + 1))
+      ++count;
+    return count;
+  };
+
+  string with_reuse = RunProjections(reuse_history_project + partition_report, true);
+  EXPECT_TRUE(supports_snapshot_);
+  string without_reuse = RunProjections(reuse_history_project + partition_report, false);
+  ASSERT_FALSE(HasFailure());
+
+  // the historical years are run twice for each projection, the first time to store the projected parameters
+  EXPECT_EQ(2u, count_reports(with_reuse));
+  EXPECT_EQ(8u, count_reports(without_reuse));
+}
+
+/**
+ * Time varying parameters drawn from the random number generator change the
+ * historical years for each projection so they must not be reused
+ */
+TEST_F(ProjectionHistory, Projection_Reuse_History_Random_Draw) {
+  string with_reuse = RunProjections(reuse_history_project + random_draw_time_varying, true);
+  EXPECT_FALSE(supports_snapshot_);
+  string without_reuse = RunProjections(reuse_history_project + random_draw_time_varying, false);
+  ASSERT_FALSE(HasFailure());
+
+  EXPECT_EQ(without_reuse, with_reuse);
+}
+
+/**
+ * With -i values a thread model restores the historical years for a candidate
+ * only if it ran the earlier candidate with the same values. The projected
+ * values must not depend on this so they must not depend on the number of threads
+ */
+TEST_F(ProjectionHistory, Projection_Reuse_History_Input_File_Threads) {
+  auto add_values = [](shared_ptr<Model> model) {
+    Estimables& estimables = *model->managers()->estimables();
+    for (double r0 : { 900000.0, 997386.0, 1100000.0 })
+      estimables.AddValue("process[Recruitment].r0", r0);
+  };
+
+  string single_thread = RunProjections(reuse_history_project, true, 1, add_values);
+  string three_threads = RunProjections(reuse_history_project, true, 3, add_values);
+  string without_reuse = RunProjections(reuse_history_project, false, 3, add_values);
+  ASSERT_FALSE(HasFailure());
+
+  unsigned count = 0;
+  for (auto start = single_thread.find("*project[future_catches]"); start != string::npos; start = single_thread.find("*project[future_catches]", start + 1))
+    ++count;
+  EXPECT_EQ(12u, count);
+
+  EXPECT_EQ(single_thread, three_threads);
+  EXPECT_EQ(single_thread, without_reuse);
+}
+
 
 } /* namespace projects */
 } /* namespace niwa */
@@ -12,6 +12,7 @@
 #include "Project.h"
 
 #include "../Model/Objects.h"
+#include "../Utilities/Map.h"
 #include "../Utilities/To.h"
 
 // namespaces
@@ -162,6 +163,33 @@ void Project::StoreValue(unsigned current_year) {
   LOG_FINEST() << "Storing value = " << stored_values_[current_year];
 }
 
+/**
+ * Store the current value of our addressable so it can be
+ * restored before each projection
+ */
+void Project::SaveSnapshot() {
+  if (addressable_ != nullptr)
+    snapshot_value_ = *addressable_;
+  else if (addressable_map_ != nullptr)
+    snapshot_map_ = *addressable_map_;
+  else if (addressable_vector_ != nullptr)
+    snapshot_vector_ = *addressable_vector_;
+  snapshot_projected_values_ = projected_values_;
+}
+
+/**
+ * Restore the value of our addressable stored by SaveSnapshot()
+ */
+void Project::RestoreSnapshot() {
+  if (addressable_ != nullptr)
+    *addressable_ = snapshot_value_;
+  else if (addressable_map_ != nullptr)
+    utilities::Map::assign(*addressable_map_, snapshot_map_);
+  else if (addressable_vector_ != nullptr)
+    *addressable_vector_ = snapshot_vector_;
+  utilities::Map::assign(projected_values_, snapshot_projected_values_);
+}
+
 } /* namespace niwa */
 
 
@@ -41,9 +41,12 @@ public:
   void                        Reset();
   void                        Update(unsigned current_year);
   void                        StoreValue(unsigned current_year);
+  void                        SaveSnapshot();
+  void                        RestoreSnapshot();
 
   // accessors
   string                      parameter() { return parameter_; };
+  const vector<unsigned>&     years() const { return years_; }
   map<unsigned,Double>&       projected_parameters() { return projected_values_; };
 
 protected:
@@ -74,6 +77,10 @@ protected:
   vector<Double>*             addressable_vector_ = nullptr;
   map<unsigned, Double>       projected_values_;
   map<unsigned, Double>       stored_values_;
+  Double                      snapshot_value_ = 0;
+  vector<Double>              snapshot_vector_;
+  map<unsigned, Double>       snapshot_map_;
+  map<unsigned, Double>       snapshot_projected_values_;
   bool                        final_phase_ = false;
 
 private:
@@ -72,14 +72,14 @@ void AgeLength::DoExecute(shared_ptr<Model> model) {
   cache_ << "\n";
 
   unsigned start_year = model->start_year();
-  auto age_lengths = model->partition().age_length_proportions(category_); // map<category, vector<year, time_step, age, length, proportion>>;
-  for (unsigned i = 0; i < age_lengths.size(); ++i) {
+  auto& age_lengths = model->partition().age_length_proportions(category_); // proportions[year][time_step][age][length]
+  for (unsigned i = 0; i < age_lengths.year_count(); ++i) {
     if (std::find(years_.begin(), years_.end(), i + start_year) != years_.end()) {
-      for (unsigned j = 0; j < age_lengths[i].size(); ++j) {
-        for (unsigned k = 0; k < age_lengths[i][j].size(); ++k) {
+      for (unsigned j = 0; j < age_lengths.time_step_count(); ++j) {
+        for (unsigned k = 0; k < age_lengths.age_count(); ++k) {
           cache_ << (start_year + i) << " " << j << " " << (min_age + k) << " ";
-          for (unsigned l = 0; l < age_lengths[i][j][k].size(); ++l) {
-            cache_ << age_lengths[i][j][k][l] << " ";
+          for (unsigned l = 0; l < age_lengths.length_bin_count(); ++l) {
+            cache_ << age_lengths(i, j, k, l) << " ";
           }
           cache_ << "\n";
         }
@@ -41,7 +41,7 @@ void AgeingErrorMatrix::DoExecute(shared_ptr<Model> model) {
   auto ageingerror = model->managers()->ageing_error()->GetAgeingError(ageingerror_label_);
   if (!ageingerror)
     LOG_CODE_ERROR() << "!ageingerror: " << ageingerror_label_;
-  vector<vector<Double>>& mis_matrix = ageingerror->mis_matrix();
+  const vector<vector<Double>>& mis_matrix = ageingerror->mis_matrix();
 
   cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
   cache_ << "values "<< REPORT_R_MATRIX<<"\n";
@@ -0,0 +1,123 @@
+/**
+ * @file MCMCConvergence.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "MCMCConvergence.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../Estimates/Manager.h"
+#include "../../MCMCs/Manager.h"
+#include "../../MCMCs/MCMC.h"
+#include "../../Model/Managers.h"
+#include "../../ThreadPool/ThreadPool.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default constructor
+ */
+MCMCConvergence::MCMCConvergence() {
+  model_state_ = State::kFinalise;
+  run_mode_    = RunMode::kMCMC;
+}
+
+/**
+ * Execute the report
+ *
+ * We use the second half of each chain (the first half is treated
+ * as burn-in) and truncate the chains to the same length. With m chains
+ * of n samples the within-chain variance W is the mean of the chain
+ * variances and the between-chain variance B is n times the variance
+ * of the chain means. R-hat is then sqrt(((n - 1) / n * W + B / n) / W)
+ *
+ * The chains only hold their most recent links (chain_buffer_size), so if
+ * the second half of a chain is longer than that we use the links we have.
+ */
+void MCMCConvergence::DoExecute(shared_ptr<Model> model) {
+  if (!model->is_primary_thread_model())
+    return;
+
+  MCMC* mcmc = model->managers()->mcmc()->active_mcmc();
+  if (!mcmc)
+    LOG_CODE_ERROR() << "(!mcmc)";
+
+  auto thread_pool = model->thread_pool();
+  unsigned chain_count = mcmc->chains();
+  if (chain_count < 2 || !thread_pool || thread_pool->Threads().size() < chain_count) {
+    LOG_WARNING() << "The " << PARAM_MCMC_CONVERGENCE << " report " << label_ << " requires at least 2 MCMC chains";
+    return;
+  }
+
+  vector<mcmc::Chain*> chains;
+  unsigned length = 0;
+  unsigned first_held = 0;
+  for (unsigned i = 0; i < chain_count; ++i) {
+    MCMC* chain_mcmc = thread_pool->Threads()[i]->model()->managers()->mcmc()->active_mcmc();
+    chains.push_back(&chain_mcmc->chain());
+    length = i == 0 ? chains[i]->total() : std::min<unsigned>(length, chains[i]->total());
+    first_held = std::max<unsigned>(first_held, chains[i]->first_index());
+  }
+
+  unsigned start = std::max<unsigned>(length / 2, first_held);
+  if (start > length)
+    start = length;
+  unsigned n = length - start;
+  if (n < 2) {
+    LOG_WARNING() << "The " << PARAM_MCMC_CONVERGENCE << " report " << label_ << " requires each chain to have at least 2 samples after the first half of the chain is discarded as burn-in";
+    return;
+  }
+
+  vector<Estimate*> estimates = model->managers()->estimate()->GetIsEstimated();
+  double m = (double)chain_count;
+
+  cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
+  cache_ << PARAM_CHAINS << ": " << chain_count << "\n";
+  cache_ << "samples_per_chain: " << n << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "parameter mean within_chain_variance between_chain_variance r_hat\n";
+  for (unsigned p = 0; p < estimates.size(); ++p) {
+    vector<double> means(chain_count, 0.0);
+    vector<double> variances(chain_count, 0.0);
+    for (unsigned c = 0; c < chain_count; ++c) {
+      for (unsigned k = start; k < length; ++k)
+        means[c] += AS_DOUBLE(chains[c]->at(k).values_[p]);
+      means[c] /= n;
+      for (unsigned k = start; k < length; ++k)
+        variances[c] += pow(AS_DOUBLE(chains[c]->at(k).values_[p]) - means[c], 2);
+      variances[c] /= (n - 1);
+    }
+
+    double grand_mean = 0.0;
+    double within = 0.0;
+    for (unsigned c = 0; c < chain_count; ++c) {
+      grand_mean += means[c] / m;
+      within += variances[c] / m;
+    }
+    double between = 0.0;
+    for (unsigned c = 0; c < chain_count; ++c)
+      between += pow(means[c] - grand_mean, 2);
+    between *= n / (m - 1.0);
+
+    double r_hat = 1.0;
+    if (within > 0.0)
+      r_hat = sqrt((((n - 1.0) / n) * within + between / n) / within);
+
+    cache_ << estimates[p]->parameter() << " " << grand_mean << " " << within << " " << between << " " << r_hat << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
@@ -0,0 +1,46 @@
+/**
+ * @file MCMCConvergence.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report prints the Gelman-Rubin potential scale reduction
+ * factor (R-hat) for each estimate once all of the MCMC chains
+ * have finished. Values close to 1 indicate the chains have
+ * converged to the same distribution.
+ */
+#ifndef SOURCE_REPORTS_COMMON_MCMCCONVERGENCE_H_
+#define SOURCE_REPORTS_COMMON_MCMCCONVERGENCE_H_
+
+// headers
+#include "../../Reports/Report.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Class definition
+ */
+class MCMCConvergence : public niwa::Report {
+public:
+  // methods
+  MCMCConvergence();
+  virtual                     ~MCMCConvergence() = default;
+
+protected:
+  // pure methods
+  void                        DoValidate(shared_ptr<Model> model) final { };
+  void                        DoBuild(shared_ptr<Model> model) final { };
+  void                        DoExecute(shared_ptr<Model> model) final;
+  void                        DoExecuteTabular(shared_ptr<Model> model) final { };
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_COMMON_MCMCCONVERGENCE_H_ */
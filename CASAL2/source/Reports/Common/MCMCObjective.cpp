@@ -28,6 +28,8 @@ MCMCObjective::MCMCObjective() {
   run_mode_     = RunMode::kMCMC;
   model_state_  = State::kIterationComplete;
   skip_tags_    = true;
+
+  parameters_.Bind<unsigned>(PARAM_CHAIN, &chain_, "The MCMC chain to print when running multiple chains", "", 1u)->set_lower_bound(1u);
 }
 
 /**
@@ -37,6 +39,8 @@ void MCMCObjective::DoBuild(shared_ptr<Model> model) {
   mcmc_ = model->managers()->mcmc()->active_mcmc();
   if (!mcmc_)
     LOG_CODE_ERROR() << "mcmc_ = model_->managers()->mcmc()->active_mcmc();";
+  if (chain_ > mcmc_->chains())
+    LOG_ERROR_P(PARAM_CHAIN) << "(" << chain_ << ") cannot be greater than the number of chains (" << mcmc_->chains() << ") in the MCMC";
 }
 
 /**
@@ -50,16 +54,23 @@ void MCMCObjective::DoPrepare(shared_ptr<Model> model) {
 
 /**
  *    Print out Chain after each iteration
+ *
+ *    Each chain runs on its own model so we only print
+ *    when called by the model running our chain
  */
 void MCMCObjective::DoExecute(shared_ptr<Model> model) {
   if (!mcmc_)
     LOG_CODE_ERROR() << "if (!mcmc_)";
 
+  MCMC* mcmc = model->managers()->mcmc()->active_mcmc();
+  if (mcmc->chain_number() != chain_)
+    return;
+
   if (first_write_ && !model->global_configuration().resume()) {
   	/// Up here!!!!!!!!!
   	vector<Estimate*>  estimates = model->managers()->estimate()->GetIsEstimated();
     cache_ << "starting_covariance_matrix {m}\n";
-    auto covariance = mcmc_->covariance_matrix();
+    auto covariance = mcmc->covariance_matrix();
     if (estimates.size() != covariance.size1())
       LOG_CODE_ERROR() << "different number of estimates to what are in the covariance matrix. estimates.size() != covariance.size1()";
     for (unsigned i = 0; i < estimates.size(); ++i) {
@@ -76,18 +87,18 @@ void MCMCObjective::DoExecute(shared_ptr<Model> model) {
     first_write_ = false;
   }
 
-  auto chain = mcmc_->chain();
-  unsigned element = chain.size() - 1;
-    cache_ << chain[element].iteration_ << " "
-        << AS_DOUBLE(chain[element].score_) << " "
-        << AS_DOUBLE(chain[element].prior_) << " "
-        << AS_DOUBLE(chain[element].likelihood_) << " "
-        << AS_DOUBLE(chain[element].penalty_) << " "
-        << AS_DOUBLE(chain[element].additional_priors_) << " "
-        << AS_DOUBLE(chain[element].jacobians_) << " "
-        << AS_DOUBLE(chain[element].step_size_) << " "
-        << AS_DOUBLE(chain[element].acceptance_rate_) << " "
-        << AS_DOUBLE(chain[element].acceptance_rate_since_adapt_) << "\n";
+  // only the most recent links are kept so we print each link as it's added
+  const mcmc::ChainLink& link = mcmc->chain().back();
+  cache_ << link.iteration_ << " "
+      << AS_DOUBLE(link.score_) << " "
+      << AS_DOUBLE(link.prior_) << " "
+      << AS_DOUBLE(link.likelihood_) << " "
+      << AS_DOUBLE(link.penalty_) << " "
+      << AS_DOUBLE(link.additional_priors_) << " "
+      << AS_DOUBLE(link.jacobians_) << " "
+      << AS_DOUBLE(link.step_size_) << " "
+      << AS_DOUBLE(link.acceptance_rate_) << " "
+      << AS_DOUBLE(link.acceptance_rate_since_adapt_) << "\n";
 
   ready_for_writing_ = true;
 }
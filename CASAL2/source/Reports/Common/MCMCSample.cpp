@@ -29,6 +29,8 @@ MCMCSample::MCMCSample() {
   run_mode_ = RunMode::kMCMC;
   model_state_ = State::kIterationComplete;
   skip_tags_ = true;
+
+  parameters_.Bind<unsigned>(PARAM_CHAIN, &chain_, "The MCMC chain to print when running multiple chains", "", 1u)->set_lower_bound(1u);
 }
 
 /**
@@ -38,6 +40,8 @@ void MCMCSample::DoBuild(shared_ptr<Model> model) {
   mcmc_ = model->managers()->mcmc()->active_mcmc();
   if (!mcmc_)
     LOG_CODE_ERROR() << "mcmc_ = model_->managers()->mcmc()->active_mcmc();";
+  if (chain_ > mcmc_->chains())
+    LOG_ERROR_P(PARAM_CHAIN) << "(" << chain_ << ") cannot be greater than the number of chains (" << mcmc_->chains() << ") in the MCMC";
 }
 
 /**
@@ -55,14 +59,21 @@ void MCMCSample::DoPrepare(shared_ptr<Model> model) {
 
 /**
  *    Print out Chain after each iteration
+ *
+ *    Each chain runs on its own model so we only print
+ *    when called by the model running our chain
  */
 void MCMCSample::DoExecute(shared_ptr<Model> model) {
   if (!mcmc_)
     LOG_CODE_ERROR() << "if (!mcmc_)";
 
-  auto chain = mcmc_->chain();
-  unsigned element = chain.size() - 1;
-    cache_ << utilities::String::join<Double>(chain[element].values_, " ") << "\n";
+  MCMC* mcmc = model->managers()->mcmc()->active_mcmc();
+  if (mcmc->chain_number() != chain_)
+    return;
+
+  // only the most recent links are kept so we print each link as it's added
+  const mcmc::ChainLink& link = mcmc->chain().back();
+  cache_ << utilities::String::join<Double>(link.values_, " ") << "\n";
 
   ready_for_writing_ = true;
 }
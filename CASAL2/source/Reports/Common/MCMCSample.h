@@ -37,6 +37,7 @@ public:
 
 private:
   MCMC*                       mcmc_ = nullptr;
+  unsigned                    chain_ = 1;
 };
 
 } /* namespace reports */
@@ -67,6 +67,10 @@ void Observation::DoBuild(shared_ptr<Model> model) {
  *	Execute the report
  */
 void Observation::DoExecute(shared_ptr<Model> model) {
+  observation_ = model->managers()->observation()->GetObservation(observation_label_);
+  if (!observation_)
+    LOG_CODE_ERROR() << "(!observation_): " << observation_label_;
+
   cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
   cache_ << "observation_type: " << observation_->type() << "\n";
   cache_ << "likelihood: " << observation_->likelihood() << "\n";
@@ -78,7 +82,7 @@ void Observation::DoExecute(shared_ptr<Model> model) {
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score pearsons_residuals\n";
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if(observation_->likelihood() == PARAM_BINOMIAL){
           resid =(comparison.observed_ - comparison.expected_) / sqrt((math::ZeroFun(comparison.expected_, comparison.delta_) * (1 - math::ZeroFun(comparison.expected_, comparison.delta_))) / comparison.adjusted_error_);
         } else if (observation_->likelihood() == PARAM_MULTINOMIAL) {
@@ -102,7 +106,7 @@ void Observation::DoExecute(shared_ptr<Model> model) {
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score normalised_residuals\n";
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
@@ -121,7 +125,7 @@ void Observation::DoExecute(shared_ptr<Model> model) {
     Double pearson_resid, normalised_resid;
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score pearsons_residuals normalised_residuals\n";
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           normalised_resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
@@ -141,7 +145,7 @@ void Observation::DoExecute(shared_ptr<Model> model) {
     // report raw residuals
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score\n";
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         cache_ << iter->first << " " << comparison.category_ << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
              << " " << AS_DOUBLE(comparison.observed_) - AS_DOUBLE(comparison.expected_) << " " << AS_DOUBLE(comparison.error_value_) << " " << AS_DOUBLE(comparison.process_error_)  << " "
              << AS_DOUBLE(comparison.adjusted_error_) << " " << AS_DOUBLE(comparison.score_) << "\n";
@@ -155,6 +159,10 @@ void Observation::DoExecute(shared_ptr<Model> model) {
  *	Execute tabular report
  */
 void Observation::DoExecuteTabular(shared_ptr<Model> model) {
+  observation_ = model->managers()->observation()->GetObservation(observation_label_);
+  if (!observation_)
+    LOG_CODE_ERROR() << "(!observation_): " << observation_label_;
+
   map<unsigned, vector<obs::Comparison>>& comparisons = observation_->comparisons();
   if (first_run_) {
     first_run_ = false;
@@ -170,7 +178,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       		bin = "1";
@@ -193,7 +201,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       	} else if ((comparison.length_ == 0) & (comparison.age_ != 0)) {
@@ -215,7 +223,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       	} else if ((comparison.length_ == 0) & (comparison.age_ != 0)) {
@@ -238,7 +246,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
       for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
         if (!utilities::To<unsigned, string>(iter->first, year))
           LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-        for (obs::Comparison comparison : iter->second) {
+        for (const obs::Comparison& comparison : iter->second) {
         	if((comparison.length_ == 0) && (comparison.age_ == 0)) {
         		// Biomass/abundance
         	} else if ((comparison.length_ == 0) && (comparison.age_ != 0)) {
@@ -262,7 +270,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
       for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
         if (!utilities::To<unsigned, string>(iter->first, year))
           LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-        for (obs::Comparison comparison : iter->second) {
+        for (const obs::Comparison& comparison : iter->second) {
         	if((comparison.length_ == 0) && (comparison.age_ == 0)) {
         		// Biomass/abundance
         	} else if ((comparison.length_ == 0) && (comparison.age_ != 0)) {
@@ -288,20 +296,20 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
    */
   // Print fits
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	cache_ << comparison.expected_ << " ";
     }
   }
   // Print obs
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	cache_ << comparison.observed_ << " ";
     }
   }
   // Print resids
   Double resid = 0.0;
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	resid = comparison.observed_ - comparison.expected_;
     	cache_ << AS_DOUBLE(resid) << " ";
     }
@@ -310,7 +318,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
     // Generate labels for the pearsons resids
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if(observation_->likelihood() == PARAM_BINOMIAL){
           resid =(comparison.observed_ - comparison.expected_) / sqrt((math::ZeroFun(comparison.expected_, comparison.delta_) * (1 - math::ZeroFun(comparison.expected_, comparison.delta_))) / comparison.adjusted_error_);
         } else if (observation_->likelihood() == PARAM_MULTINOMIAL) {
@@ -332,7 +340,7 @@ void Observation::DoExecuteTabular(shared_ptr<Model> model) {
     // Generate labels for the normalised resids
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
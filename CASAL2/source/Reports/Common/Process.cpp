@@ -78,6 +78,10 @@ void Process::DoExecute(shared_ptr<Model> model) {
  * Execute this tabular report
  */
 void Process::DoExecuteTabular(shared_ptr<Model> model) {
+  process_ = model->managers()->process()->GetProcess(process_label_);
+  if (!process_)
+    LOG_CODE_ERROR() << "(!process): " << process_label_;
+
   if (first_run_) {
     first_run_ = false;
     cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
@@ -13,6 +13,7 @@
 #include "RandomNumberSeed.h"
 
 #include "../../GlobalConfiguration/GlobalConfiguration.h"
+#include "../../ThreadPool/ThreadPool.h"
 
 // namespaces
 namespace niwa {
@@ -23,7 +24,7 @@ namespace reports {
  */
 RandomNumberSeed::RandomNumberSeed() {
   model_state_ = State::kFinalise;
-  run_mode_    = (RunMode::Type)(RunMode::kEstimation | RunMode::kBasic | RunMode::kProjection | RunMode::kSimulation);
+  run_mode_    = (RunMode::Type)(RunMode::kEstimation | RunMode::kBasic | RunMode::kMCMC | RunMode::kProjection | RunMode::kSimulation);
 }
 
 /**
@@ -34,6 +35,18 @@ void RandomNumberSeed::DoExecute(shared_ptr<Model> model) {
   //cache_ << CONFIG_ARRAY_START << label_ << CONFIG_ARRAY_END << "\n";
   cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
   cache_ << PARAM_RANDOM_NUMBER_SEED << ": " << model->global_configuration().random_seed() << "\n";
+
+  // Each thread model has its own stream seeded from the seed above
+  auto thread_pool = model->thread_pool();
+  if (thread_pool) {
+    cache_ << "streams " << REPORT_R_DATAFRAME << "\n";
+    cache_ << "model stream seed\n";
+    for (auto thread : thread_pool->Threads()) {
+      auto thread_model = thread->model();
+      unsigned stream = thread_model->id() > 1 ? thread_model->id() - 1 : 0;
+      cache_ << thread_model->id() << " " << stream << " " << thread_model->random_number_seed() << "\n";
+    }
+  }
   ready_for_writing_ = true;
 }
 
@@ -41,6 +41,10 @@ void Selectivity::DoBuild(shared_ptr<Model> model) {
 
 void Selectivity::DoExecute(shared_ptr<Model> model) {
   LOG_TRACE();
+  selectivity_ = model->managers()->selectivity()->GetSelectivity(selectivity_label_);
+  if (!selectivity_)
+    LOG_CODE_ERROR() << "(!selectivity_): " << selectivity_label_;
+
   if (!selectivity_->IsSelectivityLengthBased()) {
     LOG_FINEST() << "Printing age based selectivity";
     cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
@@ -64,6 +68,10 @@ void Selectivity::DoExecute(shared_ptr<Model> model) {
 }
 
 void Selectivity::DoExecuteTabular(shared_ptr<Model> model) {
+  selectivity_ = model->managers()->selectivity()->GetSelectivity(selectivity_label_);
+  if (!selectivity_)
+    LOG_CODE_ERROR() << "(!selectivity_): " << selectivity_label_;
+
   if (!selectivity_->IsSelectivityLengthBased()) {
     if (first_run_) {
       first_run_ = false;
@@ -39,9 +39,14 @@ void SimulatedObservation::DoBuild(shared_ptr<Model> model) {
 }
 
 /**
- * execute method
+ * execute method. The observation is found on the model being executed as
+ * each thread model simulates its own observations.
  */
 void SimulatedObservation::DoExecute(shared_ptr<Model> model) {
+  observation_ = model->managers()->observation()->GetObservation(observation_label_);
+  if (!observation_)
+    LOG_CODE_ERROR() << "(!observation_): " << observation_label_;
+
   cache_ << CONFIG_SECTION_SYMBOL << PARAM_OBSERVATION << " " << label_ << "\n";
   bool biomass_abundance_obs = false;
   ParameterList& parameter_list = observation_->parameters();
@@ -81,7 +86,7 @@ void SimulatedObservation::DoExecute(shared_ptr<Model> model) {
     // biomass obs
     cache_ << PARAM_OBS << " ";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second)
+      for (const obs::Comparison& comparison : iter->second)
         cache_ << comparison.observed_ << " ";
     }
     cache_ << "\n";
@@ -90,7 +95,7 @@ void SimulatedObservation::DoExecute(shared_ptr<Model> model) {
     cache_ << PARAM_TABLE << " " << PARAM_OBS << "\n";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
       cache_ << iter->first << " ";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         cache_ << AS_DOUBLE(comparison.observed_) << " ";
       }
       cache_ << "\n";
@@ -105,7 +110,7 @@ void SimulatedObservation::DoExecute(shared_ptr<Model> model) {
     // biomass error
     cache_ << PARAM_ERROR_VALUE << " ";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second)
+      for (const obs::Comparison& comparison : iter->second)
         cache_ << comparison.error_value_ << " ";
     }
     cache_ << "\n";
@@ -114,7 +119,7 @@ void SimulatedObservation::DoExecute(shared_ptr<Model> model) {
     cache_ << PARAM_TABLE << " " << PARAM_ERROR_VALUES << "\n";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
       cache_ << iter->first << " ";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         cache_ << AS_DOUBLE(comparison.error_value_) << " ";
       }
       cache_ << "\n";
@@ -0,0 +1,66 @@
+/**
+ * @file ThreadStatistics.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "ThreadStatistics.h"
+
+#include "../../ThreadPool/ThreadPool.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default constructor
+ */
+ThreadStatistics::ThreadStatistics() {
+  model_state_ = State::kFinalise;
+  run_mode_    = (RunMode::Type)(RunMode::kEstimation | RunMode::kBasic | RunMode::kMCMC | RunMode::kProjection | RunMode::kSimulation);
+}
+
+/**
+ * Execute the report
+ */
+void ThreadStatistics::DoExecute(shared_ptr<Model> model) {
+  if (!model->is_primary_thread_model())
+    return;
+
+  auto thread_pool = model->thread_pool();
+  if (!thread_pool) {
+    LOG_WARNING() << "The " << PARAM_THREAD_STATISTICS << " report " << label_ << " has no thread pool to report on";
+    return;
+  }
+
+  ThreadPoolStatistics statistics = thread_pool->statistics();
+
+  cache_ << "*"<< type_ << "[" << label_ << "]" << "\n";
+  cache_ << PARAM_THREADS << ": " << statistics.thread_busy_time_.size() << "\n";
+  cache_ << "batches: " << statistics.batches_ << "\n";
+  cache_ << "candidates: " << statistics.candidates_ << "\n";
+  cache_ << "wall_time: " << statistics.wall_time_ << "\n";
+  cache_ << "idle_time: " << statistics.idle_time_ << "\n";
+  cache_ << "last_wall_time: " << statistics.last_wall_time_ << "\n";
+  cache_ << "last_idle_time: " << statistics.last_idle_time_ << "\n";
+  cache_ << "last_imbalance_ratio: " << statistics.last_imbalance_ratio_ << "\n";
+  cache_ << "mean_imbalance_ratio: " << statistics.mean_imbalance_ratio_ << "\n";
+  cache_ << "max_imbalance_ratio: " << statistics.max_imbalance_ratio_ << "\n";
+
+  cache_ << "threads " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "thread busy_time candidates steals\n";
+  for (unsigned i = 0; i < statistics.thread_busy_time_.size(); ++i) {
+    cache_ << i + 1 << " " << statistics.thread_busy_time_[i] << " " << statistics.thread_candidates_[i]
+        << " " << statistics.thread_steals_[i] << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
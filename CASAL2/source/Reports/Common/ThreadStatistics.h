@@ -0,0 +1,45 @@
+/**
+ * @file ThreadStatistics.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report prints the timing information gathered by the thread pool
+ * while running batches of candidates. It shows how much time the threads
+ * spent idle and how evenly the work was spread across them.
+ */
+#ifndef SOURCE_REPORTS_COMMON_THREADSTATISTICS_H_
+#define SOURCE_REPORTS_COMMON_THREADSTATISTICS_H_
+
+// headers
+#include "../../Reports/Report.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Class definition
+ */
+class ThreadStatistics : public niwa::Report {
+public:
+  // methods
+  ThreadStatistics();
+  virtual                     ~ThreadStatistics() = default;
+
+protected:
+  // pure methods
+  void                        DoValidate(shared_ptr<Model> model) final { };
+  void                        DoBuild(shared_ptr<Model> model) final { };
+  void                        DoExecute(shared_ptr<Model> model) final;
+  void                        DoExecuteTabular(shared_ptr<Model> model) final { };
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_COMMON_THREADSTATISTICS_H_ */
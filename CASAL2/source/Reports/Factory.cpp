@@ -36,6 +36,7 @@
 #include "../Reports/Common/EstimateValue.h"
 #include "../Reports/Common/EstimationResult.h"
 #include "../Reports/Common/HessianMatrix.h"
+#include "../Reports/Common/MCMCConvergence.h"
 #include "../Reports/Common/MCMCCovariance.h"
 #include "../Reports/Common/MCMCObjective.h"
 #include "../Reports/Common/MCMCSample.h"
@@ -49,6 +50,7 @@
 #include "../Reports/Common/OutputParameters.h"
 #include "../Reports/Common/SimulatedObservation.h"
 #include "../Reports/Common/Selectivity.h"
+#include "../Reports/Common/ThreadStatistics.h"
 #include "../Reports/Common/TimeVarying.h"
 #include "../Reports/Length/InitialisationPartitionMeanWeight.h"
 #include "../Reports/Length/PartitionMeanWeight.h"
@@ -95,6 +97,8 @@ Report* Factory::Create(shared_ptr<Model> model, const string& object_type, cons
       result = new EstimationResult();
     else if (sub_type == PARAM_HESSIAN_MATRIX)
       result = new HessianMatrix();
+    else if (sub_type == PARAM_MCMC_CONVERGENCE)
+      result = new MCMCConvergence();
     else if (sub_type == PARAM_MCMC_COVARIANCE)
       result = new MCMCCovariance();
     else if (sub_type == PARAM_MCMC_OBJECTIVE)
@@ -119,6 +123,8 @@ Report* Factory::Create(shared_ptr<Model> model, const string& object_type, cons
       result = new SimulatedObservation();
     else if (sub_type == PARAM_SELECTIVITY)
       result = new Selectivity();
+    else if (sub_type == PARAM_THREAD_STATISTICS)
+      result = new ThreadStatistics();
     else if (sub_type == PARAM_TIME_VARYING)
       result = new TimeVarying();
     else if (sub_type == PARAM_INITIALISATION_PARTITION)
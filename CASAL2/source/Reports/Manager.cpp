@@ -29,10 +29,6 @@ std::mutex Manager::lock_;
  * Default Constructor
  */
 Manager::Manager() {
-  run_.test_and_set();
-  pause_ = false;
-  is_paused_ = false;
-  waiting_ = false;
 }
 
 /**
@@ -122,6 +118,8 @@ void Manager::Execute(shared_ptr<Model> model, State::Type model_state) {
           report->ExecuteTabular(model);
         else
           report->Execute(model);
+        TakeIterationOutput(model, report);
+        QueueReport(report);
       } else
         LOG_MEDIUM() << "Skipping report: " << report->label() << " because run mode is incorrect";
   }
@@ -158,6 +156,8 @@ void Manager::Execute(shared_ptr<Model> model, unsigned year, const string& time
       report->ExecuteTabular(model);
     else
       report->Execute(model);
+    TakeIterationOutput(model, report);
+    QueueReport(report);
   }
   LOG_TRACE();
 }
@@ -184,6 +184,7 @@ void Manager::Prepare(shared_ptr<Model> model) {
       report->PrepareTabular(model);
     else
       report->Prepare(model);
+    QueueReport(report);
   }
 
   has_prepared_ = true;
@@ -218,6 +219,7 @@ void Manager::Finalise(shared_ptr<Model> model) {
       report->FinaliseTabular(model);
     else
       report->Finalise(model);
+    QueueReport(report);
   }
 
   LOG_TRACE();
@@ -226,70 +228,245 @@ void Manager::Finalise(shared_ptr<Model> model) {
 
 /**
  * This method can be called from the main thread to ensure
- * we wait for all reports to finish
+ * we wait for all reports to finish. The report thread is woken
+ * and we sleep until it has written everything that was ready
+ * when we asked and flushed the files to disk.
  */
 void Manager::WaitForReportsToFinish() {
-#ifndef TESTMODE
-	std::scoped_lock l(lock_);
-  waiting_ = true;
+	std::unique_lock<std::mutex> l(lock_);
+	if (!thread_running_)
+		return;
+
+  unsigned request = ++flush_requests_;
   LOG_FINE() << "Waiting for reports";
-  while(waiting_);
-#endif
-  return;
+  flush_condition_.notify_one();
+  flushed_condition_.wait(l, [this, request]() { return flushes_completed_ >= request || !thread_running_; });
+}
+
+/**
+ * Prepare to run iterations concurrently on the thread models. Anything the
+ * reports have cached so far (e.g. headers) is written with the first iteration.
+ */
+void Manager::StartIterations() {
+  std::scoped_lock l(lock_);
+  model_iterations_.clear();
+  iterations_.clear();
+  next_iteration_ = 0;
+
+  IterationOutput& first_iteration = iterations_[0];
+  for (auto report : objects_) {
+    string output = report->TakeCache();
+    if (output != "") {
+      first_iteration.reports_.push_back(report);
+      first_iteration.output_[report] = output;
+    }
+  }
+}
+
+/**
+ * Flag that a model is about to run an iteration. Until EndIteration() is
+ * called the output of any report executed by this model is held for the
+ * iteration instead of being left in the report's cache.
+ *
+ * @param model The model running the iteration
+ * @param iteration The iteration number (starting at 0)
+ * @param suffix The report suffix for the iteration
+ */
+void Manager::StartIteration(shared_ptr<Model> model, unsigned iteration, const string& suffix) {
+  std::scoped_lock l(lock_);
+  model_iterations_[model->id()] = iteration;
+  iterations_[iteration].suffix_ = suffix;
+}
+
+/**
+ * Flag that a model has finished its iteration. The report thread
+ * will write it once every iteration before it has been written.
+ *
+ * @param model The model that ran the iteration
+ */
+void Manager::EndIteration(shared_ptr<Model> model) {
+  std::scoped_lock l(lock_);
+  auto iterator = model_iterations_.find(model->id());
+  if (iterator == model_iterations_.end())
+    LOG_CODE_ERROR() << "Model " << model->id() << " is not running an iteration";
+
+  iterations_[iterator->second].complete_ = true;
+  model_iterations_.erase(iterator);
+  iteration_ready_ = true;
+  flush_condition_.notify_one();
+}
+
+/**
+ * Throw away the output held so far for the iteration the model is running.
+ * This does nothing if the model is not running an iteration.
+ *
+ * @param model The model running the iteration
+ */
+void Manager::DiscardIterationOutput(shared_ptr<Model> model) {
+  std::scoped_lock l(lock_);
+  auto iterator = model_iterations_.find(model->id());
+  if (iterator == model_iterations_.end())
+    return;
+
+  iterations_[iterator->second].reports_.clear();
+  iterations_[iterator->second].output_.clear();
+}
+
+/**
+ * If the model is running an iteration, move the output of the report
+ * into the iteration. Note: The caller must hold the lock.
+ *
+ * @param model The model that executed the report
+ * @param report The report that was executed
+ */
+void Manager::TakeIterationOutput(shared_ptr<Model> model, Report* report) {
+  auto iterator = model_iterations_.find(model->id());
+  if (iterator == model_iterations_.end())
+    return;
+
+  string output = report->TakeCache();
+  if (output == "")
+    return;
+
+  IterationOutput& iteration = iterations_[iterator->second];
+  if (iteration.output_.find(report) == iteration.output_.end())
+    iteration.reports_.push_back(report);
+  iteration.output_[report] += output;
+}
+
+/**
+ * Queue the report to be written if it has output ready and wake
+ * the report thread. Note: The caller must hold the lock.
+ *
+ * @param report The report that was executed
+ */
+void Manager::QueueReport(Report* report) {
+  if (!report->ready_for_writing())
+    return;
+
+  ready_reports_.push_back(report);
+  flush_condition_.notify_one();
+}
+
+/**
+ * Take any completed iterations in order so they can be written. We
+ * stop at the first iteration that has not finished.
+ * Note: The caller must hold the lock.
+ *
+ * @param completed The container to move the completed iterations in to
+ */
+void Manager::TakeCompletedIterations(vector<IterationOutput>& completed) {
+  auto iterator = iterations_.find(next_iteration_);
+  while (iterator != iterations_.end() && iterator->second.complete_) {
+    completed.push_back(std::move(iterator->second));
+    iterations_.erase(iterator);
+    iterator = iterations_.find(++next_iteration_);
+  }
+  iteration_ready_ = false;
 }
 
 /**
  * This method will flush all of the reports to stdout or a file depending on each
  * report when it has finished caching it's output internally.
  *
+ * The thread sleeps until a report has been queued, an iteration has finished
+ * or someone is waiting for the reports. The output is written without holding
+ * the lock so the models are not held up while we write. Files are kept open
+ * between writes and closed when the thread is stopped. They are flushed when
+ * there is nothing left to write, before we go back to sleep.
+ *
  * NOTE: This method is called in it's own thread so we can continue to run the model
  * without having to wait for the reports to be ready.
  */
 void Manager::FlushReports() {
   // WARNING: DO NOT CALL THIS ANYWHERE. IT'S THREADED
- bool do_break = run_.test_and_set();
- waiting_ = false;
- bool record_waiting = false;
-  while(true) {
-    while (pause_) {
-      is_paused_ = true;
-      continue;
+  std::unique_lock<std::mutex> l(lock_);
+  thread_running_ = true;
+
+  vector<Report*>         ready_reports;
+  vector<IterationOutput> completed_iterations;
+  while (true) {
+    flush_condition_.wait(l, [this]() {
+      return !pause_ && (!run_ || ready_reports_.size() != 0 || iteration_ready_ || flush_requests_ != flushes_completed_);
+    });
+
+    bool     stop    = !run_;
+    unsigned request = flush_requests_;
+    bool     waiting = request != flushes_completed_;
+    flushing_ = true;
+
+    TakeCompletedIterations(completed_iterations);
+    ready_reports.swap(ready_reports_);
+    if (stop || waiting) {
+      // Catch any reports that were executed without going through us
+      for (auto report : objects_) {
+        if (report->ready_for_writing())
+          ready_reports.push_back(report);
+      }
     }
+    l.unlock();
 
-    is_paused_ = false;
-
-    if (waiting_)
-      record_waiting = true;
-
-    do_break = !run_.test_and_set();
-    {
-    	std::scoped_lock l(lock_);
-			for (auto report : objects_) {
-				if (report->ready_for_writing())
-					report->FlushCache();
-			}
+    for (auto& iteration : completed_iterations) {
+      for (auto report : iteration.reports_)
+        report->FlushIteration(iteration.output_[report], iteration.suffix_);
     }
-
-    if (record_waiting) {
-      record_waiting = false;
-      waiting_ = false;
+    completed_iterations.clear();
+
+    for (auto report : ready_reports)
+      report->FlushCache();
+    ready_reports.clear();
+
+    l.lock();
+    bool idle = ready_reports_.size() == 0 && !iteration_ready_;
+    if (stop || waiting || idle) {
+      for (auto report : objects_) {
+        if (stop)
+          report->CloseFile();
+        else
+          report->FlushFile();
+      }
     }
 
-    if (do_break)
+    flushing_ = false;
+    flushes_completed_ = request;
+    flushed_condition_.notify_all();
+    if (stop)
       break;
   }
+
+  // allow the thread to be started again
+  run_ = true;
+  thread_running_ = false;
+  flushed_condition_.notify_all();
 }
 
 /**
- *
+ * Stop the report thread. Anything left to write is written and
+ * the report files are closed before the thread finishes.
+ */
+void Manager::StopThread() {
+  std::scoped_lock l(lock_);
+  run_ = false;
+  flush_condition_.notify_one();
+}
+
+/**
+ * Pause the report thread. When this returns the report thread
+ * is not writing and will not write until Resume() is called.
  */
 void Manager::Pause() {
-#ifndef TESTMODE
+  std::unique_lock<std::mutex> l(lock_);
   pause_ = true;
-  while(!is_paused_) {
-  	continue;
-  }
-#endif
+  flushed_condition_.wait(l, [this]() { return !flushing_; });
+}
+
+/**
+ * Resume the report thread after a Pause()
+ */
+void Manager::Resume() {
+  std::scoped_lock l(lock_);
+  pause_ = false;
+  flush_condition_.notify_one();
 }
 
 /**
@@ -17,9 +17,10 @@
 #define REPORTS_MANAGER_H_
 
 // Headers
-#include <atomic>
+#include <condition_variable>
 #include <thread>
 #include <mutex>
+#include <map>
 
 #include "../BaseClasses/Manager.h"
 #include "../Reports/Report.h"
@@ -49,10 +50,14 @@ public:
   void                        Prepare(shared_ptr<Model> model);
   void                        Finalise(shared_ptr<Model> model);
   void                        FlushReports();
-  void                        StopThread() { run_.clear(); }
+  void                        StopThread();
   void                        Pause();
-  void                        Resume() { pause_ = false; }
+  void                        Resume();
   void                        WaitForReportsToFinish();
+  void                        StartIterations();
+  void                        StartIteration(shared_ptr<Model> model, unsigned iteration, const string& suffix);
+  void                        EndIteration(shared_ptr<Model> model);
+  void                        DiscardIterationOutput(shared_ptr<Model> model);
 
   // accessors
   void                        set_report_suffix(const string& suffix);
@@ -63,20 +68,42 @@ protected:
   Manager();
 
 private:
+  // structs
+  struct IterationOutput {
+    string                          suffix_ = "";
+    vector<Report*>                 reports_;
+    map<Report*, string>            output_;
+    bool                            complete_ = false;
+  };
+
+  // methods
+  void                        QueueReport(Report* report);
+  void                        TakeIterationOutput(shared_ptr<Model> model, Report* report);
+  void                        TakeCompletedIterations(vector<IterationOutput>& completed);
+
   // Members
   map<State::Type, vector<Report*>> state_reports_;
   map<string, vector<Report*>>      time_step_reports_;
   string                            report_suffix_ = "";
-  std::atomic<bool>                 pause_;
-  std::atomic<bool>                 is_paused_;
-  std::atomic_flag                  run_;
-  std::atomic<bool>                 waiting_;
+  bool                              pause_ = false;
+  bool                              run_ = true;
+  bool                              thread_running_ = false;
+  bool                              flushing_ = false;
+  bool                              iteration_ready_ = false;
+  unsigned                          flush_requests_ = 0;
+  unsigned                          flushes_completed_ = 0;
+  vector<Report*>                   ready_reports_;
+  std::condition_variable           flush_condition_;
+  std::condition_variable           flushed_condition_;
   std::string                       std_header_ = "";
   static std::mutex           			lock_;
   bool															has_validated_ = false;
   bool															has_built_ = false;
   bool															has_prepared_ = false;
   bool															has_finalised_ = false;
+  map<unsigned, unsigned>           model_iterations_;
+  map<unsigned, IterationOutput>    iterations_;
+  unsigned                          next_iteration_ = 0;
 };
 
 } /* namespace reports */
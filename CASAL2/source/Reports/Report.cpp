@@ -33,6 +33,11 @@ using std::endl;
 using std::ios_base;
 
 std::mutex Report::lock_;
+map<string, std::weak_ptr<Report::OutputFile>> Report::open_files_;
+std::recursive_mutex Report::file_lock_;
+
+// The size of the write buffer for each open report file
+const unsigned kFileBufferSize = 1 << 20;
 
 inline bool DoesFileExist(const string& file_name) {
   LOG_FINEST() << "Checking if file exists: " << file_name;
@@ -200,44 +205,167 @@ void Report::set_suffix(string_view suffix) {
 }
 
 /**
- * Flush the contents of the cache to the file or stdout/stderr
+ * Flush the contents of the cache to the file or stdout/stderr.
+ *
+ * The cache is taken while holding the lock and written after it has
+ * been released so the models can keep executing reports while the
+ * report thread is busy writing.
  */
 void Report::FlushCache() {
   Report::lock_.lock();
+  if (!ready_for_writing_) {
+    // already written by an earlier request
+    Report::lock_.unlock();
+    return;
+  }
+  string output = cache_.str();
+  string suffix = suffix_;
+  cache_.clear();
+  cache_.str("");
+  ready_for_writing_ = false;
+  Report::lock_.unlock();
+
+  WriteOutput(output, suffix);
+}
+
+/**
+ * Take the contents of the cache so it can be written later. This is used
+ * when iterations run concurrently on the thread models and each
+ * iteration's output must be written in order with its own suffix.
+ *
+ * @return The contents of the cache
+ */
+string Report::TakeCache() {
+  Report::lock_.lock();
+  string output = cache_.str();
+  cache_.clear();
+  cache_.str("");
+  ready_for_writing_ = false;
+  Report::lock_.unlock();
+  return output;
+}
+
+/**
+ * Write the output that was taken from the cache for an iteration. The
+ * output is written as if it had been in the cache with the suffix
+ * of the iteration. Anything in our cache now is left for the next flush.
+ *
+ * @param output The output to write
+ * @param suffix The report suffix for the iteration
+ */
+void Report::FlushIteration(const string& output, const string& suffix) {
+  WriteOutput(output, suffix);
+}
+
+/**
+ * Flush anything buffered for our file to disk
+ */
+void Report::FlushFile() {
+  std::scoped_lock l(file_lock_);
+  if (file_)
+    file_->stream_.flush();
+}
+
+/**
+ * Flush every open report file to disk. This is called before we exit
+ * on a fatal error so the output buffered for the files is not lost.
+ */
+void Report::FlushAllFiles() {
+  std::scoped_lock l(file_lock_);
+  for (auto& iter : open_files_) {
+    auto file = iter.second.lock();
+    if (file)
+      file->stream_.flush();
+  }
+}
+
+/**
+ * Stop using our file. The file is closed once every
+ * report writing to it has closed it.
+ */
+void Report::CloseFile() {
+  std::scoped_lock l(file_lock_);
+  file_.reset();
+  open_file_name_ = "";
+
+  for (auto iter = open_files_.begin(); iter != open_files_.end();) {
+    if (iter->second.expired())
+      iter = open_files_.erase(iter);
+    else
+      ++iter;
+  }
+}
+
+/**
+ * Open the file we are writing to. Files are kept open between writes
+ * and shared between reports writing to the same file so their output
+ * is kept in the order it was written.
+ *
+ * When we have to overwrite a file another report already has open,
+ * the shared file is reopened so that report continues to write
+ * in to the new file.
+ *
+ * @param file_name The name of the file to open
+ * @param overwrite True if the file is to be overwritten instead of appended to
+ */
+void Report::OpenFile(const string& file_name, bool overwrite) {
+  ios_base::openmode mode = ios_base::out;
+  if (!overwrite)
+    mode = ios_base::app;
+
+  file_ = open_files_[file_name].lock();
+  if (file_ && !overwrite) {
+    open_file_name_ = file_name;
+    return;
+  }
 
+  if (!file_) {
+    file_.reset(new OutputFile());
+    file_->buffer_.resize(kFileBufferSize);
+    open_files_[file_name] = file_;
+  } else
+    file_->stream_.close();
+
+  file_->stream_.rdbuf()->pubsetbuf(file_->buffer_.data(), file_->buffer_.size());
+  file_->stream_.open(file_name.c_str(), mode);
+  if (!file_->stream_.is_open())
+    LOG_ERROR() << "Unable to open file: " << file_name;
+  open_file_name_ = file_name;
+}
+
+/**
+ * Write output to the file or stdout/stderr. This is only called
+ * by the report thread, so it keeps its own record of the first write
+ * instead of using first_write_, which the reports use on the model threads.
+ *
+ * @param output The output to write
+ * @param suffix The report suffix to write with
+ */
+void Report::WriteOutput(const string& output, const string& suffix) {
   /**
    * Are we writing to a file?
    */
   if (file_name_ != "") {
+    std::scoped_lock l(file_lock_);
     bool overwrite = false;
-    if (first_write_ || suffix_ != last_suffix_)
+    if (file_first_write_ || suffix != file_last_suffix_)
       overwrite = overwrite_;
 
-    last_suffix_ = suffix_;
-    string file_name = file_name_ + suffix_;
-
-    ios_base::openmode mode = ios_base::out;
-    if (!overwrite)
-      mode = ios_base::app;
-
-    // Try to Open our File
-    ofstream file;
-    file.open(file_name.c_str(), mode);
-    if (!file.is_open())
-      LOG_ERROR() << "Unable to open file: " << file_name;
+    file_last_suffix_ = suffix;
+    string file_name = file_name_ + suffix;
+    if (!file_ || overwrite || file_name != open_file_name_)
+      OpenFile(file_name, overwrite);
 
     LOG_MEDIUM() << "skip tags = " << skip_tags_;
-    if (!skip_tags_) {
-      cache_ << CONFIG_END_REPORT << "\n";
-      //cerr << "end report\n";
-    }
-    file << cache_.str();
-    file.close();
+    ofstream& file = file_->stream_;
+    file << output;
+    if (!skip_tags_)
+      file << CONFIG_END_REPORT << "\n";
 
-    first_write_ = false;
+    file_first_write_ = false;
 
   } else {
-    cout << cache_.str();
+    cout << output;
     if (!skip_tags_) {
       cout << CONFIG_END_REPORT << "\n";
     }
@@ -245,13 +373,8 @@ void Report::FlushCache() {
     cout << endl;
     cout.flush();
 
-    first_write_ = false;
+    file_first_write_ = false;
   }
-
-  cache_.clear();
-  cache_.str("");
-  ready_for_writing_ = false;
-  Report::lock_.unlock();
 }
 
 } /* namespace niwa */
@@ -27,6 +27,7 @@
 #include <ostream>
 #include <thread>
 #include <mutex>
+#include <memory>
 
 #include "../BaseClasses/Object.h"
 #include "../Model/Model.h"
@@ -64,6 +65,11 @@ public:
   void                        FinaliseTabular(shared_ptr<Model> model);
   bool                        HasYear(unsigned year);
   void                        FlushCache();
+  string                      TakeCache();
+  void                        FlushIteration(const string& output, const string& suffix);
+  void                        FlushFile();
+  static void                 FlushAllFiles();
+  void                        CloseFile();
 
   // Accessors
   RunMode::Type               run_mode() const { return run_mode_; }
@@ -76,6 +82,7 @@ public:
 protected:
   // methods
   void                        SetUpInternalStates();
+  void                        WriteOutput(const string& output, const string& suffix);
   // pure methods
   virtual void                DoValidate(shared_ptr<Model> model) = 0;
   virtual void                DoBuild(shared_ptr<Model> model) = 0;
@@ -95,13 +102,30 @@ protected:
   string                      file_name_   = "";
   bool                        first_write_ = true;
   bool                        overwrite_   = true;
-  string                      last_suffix_ = "";
   string                      write_mode_ = "";
   vector<unsigned>            years_;
   ostringstream               cache_;
   bool                        ready_for_writing_ = false;
   bool                        skip_tags_ = false;
   string											suffix_ = "";
+
+private:
+  // structs
+  struct OutputFile {
+    ofstream                  stream_;
+    vector<char>              buffer_;
+  };
+
+  // methods
+  void                        OpenFile(const string& file_name, bool overwrite);
+
+  // members, only used by the report thread
+  std::shared_ptr<OutputFile> file_;
+  string                      open_file_name_ = "";
+  bool                        file_first_write_ = true;
+  string                      file_last_suffix_ = "";
+  static map<string, std::weak_ptr<OutputFile>> open_files_;
+  static std::recursive_mutex file_lock_; // held while the files are opened, written, flushed or closed
 };
 
 // Typedef
@@ -17,7 +17,9 @@
 
 #include <string>
 #include <iostream>
+#include <algorithm>
 #include <memory>
+#include <thread>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim_all.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -132,7 +134,8 @@ int Runner::Go() {
 	unsigned thread_count = master_model_->threads();
 
 	/**
-	 * Now we spawn our threads and populate the models
+	 * Now we spawn our threads and populate the models. The models
+	 * share the read-only data (e.g. tables) built by the master model
 	 */
 	LOG_MEDIUM() << "number of threads specified for model: " << master_model_->threads();
 	for (unsigned i = 1; i < thread_count; ++i) {
@@ -142,6 +145,7 @@ int Runner::Go() {
 		model->managers()->set_reports(reports_manager);
 		model->managers()->set_minimiser(minimiser_manager);
 		model->set_run_mode(run_mode);
+		model->set_shared_data(master_model_->shared_data());
 		model_list.push_back(model);
 	}
 
@@ -160,8 +164,14 @@ int Runner::Go() {
 
 	// override any config file values from our command line parameters
 	master_model_->global_configuration().ParseOptions(master_model_);
-	master_model_->global_configuration().set_run_parameters(run_parameters_); // TODO: Set global_configuration for models too from Runner
-	utilities::RandomNumberGenerator::Instance().Reset(master_model_->global_configuration().random_seed());
+	for (auto model : model_list)
+		model->global_configuration().set_run_parameters(run_parameters_);
+
+	// Give every model its own random number stream. They are all seeded from the
+	// master seed so runs are reproducible regardless of the number of threads
+	unsigned random_seed = master_model_->global_configuration().random_seed();
+	for (auto model : model_list)
+		model->set_random_number_seed(random_seed);
 
 	// Thread off the reports
 	// Must be done before we validate and build below
@@ -172,18 +182,36 @@ int Runner::Go() {
 	/**
 	 * Prep each of the models for being run
 	 * i.e. Validate and Build them
+	 *
+	 * The master model is done first so it builds the data shared with the
+	 * other models and any errors in the configuration are only reported once.
+	 * The rest of the models are only prepared if the master model was, as they
+	 * use the shared data (e.g. table rows) without validating it again. They
+	 * are prepared at the same time.
 	 */
-	for (auto model : model_list) {
-		if (!model->PrepareForIterations()) {
-			if (logging.errors().size() > 0) {
-				logging.FlushErrors();
-				return -1;
-			}
+	vector<char> prepared(model_list.size(), true);
+	prepared[0] = master_model_->PrepareForIterations();
+	if (prepared[0]) {
+		vector<std::thread> prepare_threads;
+		for (unsigned i = 1; i < model_list.size(); ++i) {
+			auto model = model_list[i];
+			char* result = &prepared[i];
+			prepare_threads.push_back(std::thread([model, result]() { *result = model->PrepareForIterations(); }));
 		}
+		for (auto& thread : prepare_threads)
+			thread.join();
+	}
+
+	if (logging.error_count() > 0 || std::find(prepared.begin(), prepared.end(), false) != prepared.end()) {
+		reports_manager->StopThread();
+		report_thread.join();
+		logging.FlushErrors();
+		return -1;
 	}
 
 	thread_pool_.reset(new ThreadPool());
 	thread_pool_->CreateThreads(model_list);
+	master_model_->set_thread_pool(thread_pool_);
 
 //	thread_pool_->CheckThreads();
 
@@ -218,6 +246,7 @@ int Runner::Go() {
 
 	// we're finished. Terminate our threads to cleanup memory
 	thread_pool_->TerminateAll();
+	master_model_->set_thread_pool(nullptr);
 
 	// finish report thread
 	reports_manager->StopThread();
@@ -301,7 +330,10 @@ bool Runner::RunEstimation() {
 	unsigned iterations_to_do = estimables_manager->GetValueCount() == 0 ? 1 : estimables_manager->GetValueCount();
 	for (unsigned i = 0; i < iterations_to_do; ++i) {
 		if (use_addressable_file) {
-			estimables_manager->LoadValues(i);
+			// Load the values in to each model so any parameters that are not being
+			// estimated have the same value on the threads evaluating the candidates
+			for (auto thread : thread_pool_->Threads())
+				thread->model()->managers()->estimables()->LoadValues(i);
 //			master_model_->Reset();
 		}
 
@@ -311,10 +343,13 @@ bool Runner::RunEstimation() {
 		unsigned phases = managers->estimate()->GetNumberOfPhases();
 		for (unsigned j = 1; j <= phases; ++j) {
 			LOG_MEDIUM() << "model.estimation_phase: " << j;
-			managers->estimate()->SetActivePhase(j);
+			for (auto thread : thread_pool_->Threads())
+				thread->model()->managers()->estimate()->SetActivePhase(j);
 			minimiser->ExecuteThreaded(thread_pool_);
 		}
 
+		if (minimiser->numerical_hessian())
+			minimiser->BuildNumericalHessian(thread_pool_);
 		minimiser->BuildCovarianceMatrix();
 
 		master_model_->set_run_mode(RunMode::kBasic);
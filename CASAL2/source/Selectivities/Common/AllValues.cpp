@@ -73,7 +73,7 @@ void AllValues::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void AllValues::RebuildCache() {
+void AllValues::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     unsigned min_age = model_->min_age();
     for (unsigned i = 0; i < v_.size(); ++i) {
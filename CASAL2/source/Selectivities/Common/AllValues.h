@@ -32,7 +32,7 @@ public:
   explicit AllValues(shared_ptr<Model> model);
   virtual                     ~AllValues() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -97,7 +97,7 @@ void AllValuesBounded::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void AllValuesBounded::RebuildCache() {
+void AllValuesBounded::DoRebuildCache() {
   /**
    * Resulting age map should look like
    * While Age < Low :: Value = 0.0
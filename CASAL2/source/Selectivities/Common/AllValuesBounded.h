@@ -32,7 +32,7 @@ public:
   explicit AllValuesBounded(shared_ptr<Model> model);
   virtual                     ~AllValuesBounded() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
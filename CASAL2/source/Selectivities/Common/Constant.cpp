@@ -33,7 +33,7 @@ Constant::Constant(shared_ptr<Model> model)
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void Constant::RebuildCache() {
+void Constant::DoRebuildCache() {
   values_.assign(model_->age_spread(), c_);
 }
 
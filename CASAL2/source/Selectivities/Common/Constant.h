@@ -34,7 +34,7 @@ public:
   void                        DoValidate() override final { };
   Double                      GetAgeResult(unsigned age, AgeLength* age_length) override final;
   Double                      GetLengthResult(unsigned length_bin) override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -79,7 +79,7 @@ void DoubleExponential::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void DoubleExponential::RebuildCache() {
+void DoubleExponential::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age) {
       if ((Double)age <= x0_) {
@@ -32,7 +32,7 @@ public:
   explicit DoubleExponential(shared_ptr<Model> model);
   virtual                     ~DoubleExponential() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -66,7 +66,7 @@ void DoubleNormal::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void DoubleNormal::RebuildCache() {
+void DoubleNormal::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age) {
       Double temp = (Double)age;
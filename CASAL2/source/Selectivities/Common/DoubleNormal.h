@@ -32,7 +32,7 @@ public:
   explicit DoubleNormal(shared_ptr<Model> model);
   virtual                     ~DoubleNormal() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -95,7 +95,7 @@ void Increasing::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void Increasing::RebuildCache() {
+void Increasing::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age) {
 
@@ -32,7 +32,7 @@ public:
   explicit Increasing(shared_ptr<Model> model);
   virtual                     ~Increasing() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -62,7 +62,7 @@ void InverseLogistic::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void InverseLogistic::RebuildCache() {
+void InverseLogistic::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     Double threshold = 0.0;
 
@@ -32,7 +32,7 @@ public:
   explicit InverseLogistic(shared_ptr<Model> model);
   virtual                     ~InverseLogistic() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -44,7 +44,7 @@ KnifeEdge::KnifeEdge(shared_ptr<Model> model)
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void KnifeEdge::RebuildCache() {
+void KnifeEdge::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age) {
       Double temp = age * 1.0;
@@ -32,7 +32,7 @@ public:
   explicit KnifeEdge(shared_ptr<Model> model);
   virtual                     ~KnifeEdge() = default;
   void                        DoValidate() override final { };
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -62,7 +62,7 @@ void Logistic::DoValidate() {
  * This method will rebuild the cache of selectivity values
  * for each age in the model.
  */
-void Logistic::RebuildCache() {
+void Logistic::DoRebuildCache() {
   if (model_->partition_type() == PartitionType::kAge) {
     Double threshold = 0.0;
 
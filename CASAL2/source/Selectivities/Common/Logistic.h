@@ -32,7 +32,7 @@ public:
   explicit Logistic(shared_ptr<Model> model);
   virtual                     ~Logistic() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -32,7 +32,7 @@ public:
   explicit LogisticProducing(shared_ptr<Model> model);
   virtual                     ~LogisticProducing() = default;
   void                        DoValidate() override final;
-  void                        RebuildCache() override final;
+  void                        DoRebuildCache() override final;
 
 protected:
   //Methods
@@ -95,82 +95,94 @@ void Selectivity::Reset() {
  * @return The value stored in the map or 0.0 as default
  */
 
-Double Selectivity::GetAgeResult(unsigned age, AgeLength* age_length) {
-  if (!length_based_) {
-    if (age - age_index_ >= values_.size())
-      LOG_CODE_ERROR() << "if (age - age_index_ >= values_.size()) : age: " << age << "; label: " << label_ << "; type: " << type_;
-    if (age < age_index_)
-      LOG_CODE_ERROR() << "if (age < age_index)";
-    return values_[age - age_index_];
-  }
-
-  return GetLengthBasedResult(age, age_length);
-}
-
 /**
- *
+ * Rebuild the cached values for this selectivity. This is called when
+ * the selectivity is built, when it is reset while being estimated and
+ * by time varying objects. Any length based results we have cached are
+ * thrown away so they'll be recalculated the next time they're asked for.
  */
-Double Selectivity::GetLengthResult(unsigned length_bin_index) {
-  return length_values_[length_bin_index];
+void Selectivity::RebuildCache() {
+  for (auto& cache : length_based_cache_)
+    cache.built_.assign(cache.built_.size(), false);
+  DoRebuildCache();
 }
 
-
 /**
- * This method will return a pointer to a 4D vector object
- * containing age length cached values for the target age_length object.
+ * Return the selectivity for an age. If this is a length based selectivity
+ * the result is looked up in a cache for the age length, year and time step.
+ * The first lookup for a year and time step calculates all of the ages in it.
+ * Lookups while the model is initialising use their own slice for each time
+ * step, because an age length can return different mean lengths then.
  *
- * If the target object does not exist, then it will build it.
+ * The cache for an age length is thrown away when the age length is reset
+ * or rebuilt, or this selectivity's cache is rebuilt.
+ *
+ * @param age The age (not the index)
+ * @param age_length The age length for the category
+ * @return The selectivity for the age
  */
-Vector3* Selectivity::GetCache(AgeLength* age_length) {
-  RebuildCache();
-  // size varies for multi-dimensional vector
-  unsigned year_count = model_->years().size();
-  unsigned time_step_count = model_->managers()->time_step()->size();
-  unsigned age_count = model_->age_spread();
-
+Double Selectivity::GetAgeResult(unsigned age, AgeLength* age_length) {
   if (!length_based_) {
-    Vector3* new_vector = &cached_age_length_values_[PARAM_NONE];
-    utilities::allocate_vector3(new_vector, year_count, time_step_count, age_count);
-
-//    cout << "v: " << label_ << " | ";
-//    for (unsigned i = 0; i < values_.size(); ++i)
-//      cout << values_[i] << ", ";
-//    cout << endl;
-
-    for (unsigned i = 0; i < year_count; ++i)
-      for (unsigned j = 0; j < time_step_count; ++j) {
-        for (unsigned k = 0; k < age_count; ++k)
-        (*new_vector)[i][j].assign(values_.begin(), values_.end());
-      }
-
-    return new_vector;
-
+    if (age - age_index_ >= values_.size())
+      LOG_CODE_ERROR() << "if (age - age_index_ >= values_.size()) : age: " << age << "; label: " << label_ << "; type: " << type_;
+    if (age < age_index_)
+      LOG_CODE_ERROR() << "if (age < age_index)";
+    return values_[age - age_index_];
   }
 
-  // This is age length code now.
   if (age_length == nullptr)
     LOG_CODE_ERROR() << "(age_length == nullptr)";
 
-  if (cached_age_length_values_.find(age_length->label()) != cached_age_length_values_.end()) {
-    // return existing cache
-    return &cached_age_length_values_.find(age_length->label())->second;
+  LengthBasedCache* cache = nullptr;
+  for (auto& iter : length_based_cache_) {
+    if (iter.age_length_ == age_length) {
+      cache = &iter;
+      break;
+    }
   }
 
-  // It does not exist, let's build it.
-  Vector3* new_vector = &cached_age_length_values_[age_length->label()];
-  utilities::allocate_vector3(new_vector, year_count, time_step_count, age_count);
-
-  for (unsigned i = 0; i < year_count; ++i) {
-    unsigned year = model_->start_year() + i;
-    for (unsigned j = 0; j < time_step_count; ++j) {
-      for (unsigned k = 0; k < age_count; ++k) {
-        unsigned age = model_->min_age() + k;
-        (*new_vector)[i][j][k] = this->GetLengthBasedResult(age, age_length, year, j);
-      }
-    }
+  if (cache == nullptr) {
+    length_based_cache_.emplace_back();
+    cache = &length_based_cache_.back();
+    cache->age_length_      = age_length;
+    cache->year_count_      = model_->years().size();
+    cache->time_step_count_ = model_->time_steps().size();
+    cache->age_count_       = model_->age_spread();
+    cache->built_.assign((cache->year_count_ + 1) * cache->time_step_count_, false);
+    cache->values_.assign(cache->built_.size() * cache->age_count_, 0.0);
+    cache->age_length_revision_ = age_length->revision();
+  } else if (cache->age_length_revision_ != age_length->revision()) {
+    cache->built_.assign(cache->built_.size(), false);
+    cache->age_length_revision_ = age_length->revision();
   }
 
-  return new_vector;
+  unsigned year       = model_->current_year();
+  unsigned time_step  = model_->managers()->time_step()->current_time_step();
+  unsigned year_index = year - model_->start_year();
+  if (year < model_->start_year() || year_index >= cache->year_count_ || time_step >= cache->time_step_count_
+      || age < age_index_ || age - age_index_ >= cache->age_count_)
+    return GetLengthBasedResult(age, age_length);
+
+  // the initialisation phases use the extra year after the last one
+  if (model_->state() == State::kInitialise)
+    year_index = cache->year_count_;
+  unsigned slice = year_index * cache->time_step_count_ + time_step;
+  Double* values = &cache->values_[slice * cache->age_count_];
+  if (!cache->built_[slice]) {
+    for (unsigned age_offset = 0; age_offset < cache->age_count_; ++age_offset)
+      values[age_offset] = GetLengthBasedResult(age_index_ + age_offset, age_length, year, time_step);
+    cache->built_[slice] = true;
+  }
+
+  return values[age - age_index_];
 }
 
+/**
+ *
+ */
+Double Selectivity::GetLengthResult(unsigned length_bin_index) {
+  return length_values_[length_bin_index];
+}
+
+
 } /* namespace niwa */
@@ -23,7 +23,6 @@ class AgeLength;
 // Using
 using std::map;
 using niwa::utilities::Double;
-using utilities::Vector3;
 
 /**
  * Class Definition
@@ -37,10 +36,10 @@ public:
   void                        Validate();
   virtual void                Build() { RebuildCache(); };
   void                        Reset();
+  void                        RebuildCache() override final;
   virtual Double              GetAgeResult(unsigned age, AgeLength* age_length);
   virtual Double              GetLengthResult(unsigned length_bin_index);
   bool                        IsSelectivityLengthBased() const { return length_based_; }
-  Vector3*                    GetCache(AgeLength* age_length);
 
   bool                        length_based() const { return length_based_; }
 
@@ -48,6 +47,23 @@ protected:
   // pure methods
   virtual Double              GetLengthBasedResult(unsigned age, AgeLength* age_length, unsigned year = 0, int time_step_index = -1) = 0;
   virtual void                DoValidate() = 0;
+  virtual void                DoRebuildCache() = 0;
+
+  /**
+   * Length based results for one age length, built lazily one
+   * year and time step at a time. values_ is [year][time_step][age]
+   * with an extra year at the end for the initialisation phases
+   */
+  struct LengthBasedCache {
+    AgeLength*                age_length_ = nullptr;
+    unsigned                  age_length_revision_ = 0;
+    unsigned                  year_count_ = 0;
+    unsigned                  time_step_count_ = 0;
+    unsigned                  age_count_ = 0;
+    vector<bool>              built_; // built_[year][time_step]
+    vector<Double>            values_;
+  };
+
   // Members
   shared_ptr<Model>                      model_ = nullptr;
   unsigned                    n_quant_ = 5;
@@ -60,7 +76,7 @@ protected:
   string                      partition_type_label_ = "";
   PartitionType               partition_type_ = PartitionType::kInvalid;
   unsigned                    age_index_;
-  map<string, Vector3>        cached_age_length_values_; // map<age_length_label, cache(year x time_step x age)>
+  vector<LengthBasedCache>    length_based_cache_;
 };
 } /* namespace niwa */
 #endif /* SELECTIVITY_H_ */
@@ -184,7 +184,7 @@ int Run(int argc, char * argv[], niwa::utilities::RunParameters& options) {
 
       // override any config file values from our command line
       model->global_configuration().ParseOptions(model);
-      utilities::RandomNumberGenerator::Instance().Reset(model->global_configuration().random_seed());
+      model->set_random_number_seed(model->global_configuration().random_seed());
 
       // Thread off the reports
       auto report_manager = model->managers()->report();
@@ -11,6 +11,13 @@
 
 #include "CasalComplex1.h"
 
+#include <thread>
+#include <boost/algorithm/string/replace.hpp>
+
+#include "../../Estimables/Estimables.h"
+#include "../../Estimates/Manager.h"
+#include "../../Model/Managers.h"
+#include "../../Model/SharedData.h"
 #include "../../Model/Models/Age.h"
 #include "../../ObjectiveFunction/ObjectiveFunction.h"
 #include "../../Observations/Manager.h"
@@ -51,6 +58,57 @@ TEST_F(InternalEmptyModel, Model_CasalComplex1_Estimation) {
   EXPECT_DOUBLE_EQ(70082.72043536164, obj_function.score());
 }
 
+/**
+ * Check warm starting the initialisation from the previous candidate's
+ * equilibrium. The partition is only converged to within lambda, so
+ * running the full 200 years from the start at the estimate found with
+ * a warm start must give the same score to within a small tolerance.
+ */
+TEST_F(InternalEmptyModel, Model_CasalComplex1_Estimation_Warm_Start) {
+  string configuration = test_cases_casal_complex_1;
+  boost::replace_first(configuration, "years 200", "years 200\nwarm_start true\nlambda 1e-12");
+  AddConfigurationLine(configuration, "CasalComplex1.h", 31);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kEstimation);
+  Double warm_start_score = model_->objective_function().score();
+
+  // running again starts from the partition the last candidate converged to
+  model_->FullIteration();
+  model_->objective_function().CalculateScore();
+  EXPECT_NEAR(warm_start_score, model_->objective_function().score(), 1e-6);
+
+  map<string, Double> estimate_values;
+  for (auto estimate : model_->managers()->estimate()->objects())
+    estimate_values[estimate->parameter()] = estimate->value();
+  ASSERT_NE(0u, estimate_values.size());
+
+  TearDown();
+  SetUp();
+  AddConfigurationLine(test_cases_casal_complex_1, "CasalComplex1.h", 31);
+  LoadConfiguration();
+  for (auto iter : estimate_values)
+    model_->managers()->estimables()->AddValue(iter.first, iter.second);
+
+  model_->Start(RunMode::kBasic);
+  EXPECT_NEAR(warm_start_score, model_->objective_function().score(), 1e-6);
+}
+
+/**
+ * With more than one thread each thread model would warm start from the
+ * candidate it ran last, which depends on how the candidates were scheduled,
+ * so the objective function would not be reproducible. This is rejected.
+ */
+TEST_F(InternalEmptyModel, Model_CasalComplex1_Estimation_Warm_Start_Threads) {
+  string configuration = test_cases_casal_complex_1;
+  boost::replace_first(configuration, "@model\n", "@model\nthreads 2\n");
+  boost::replace_first(configuration, "years 200", "years 200\nwarm_start true\nlambda 1e-12");
+  AddConfigurationLine(configuration, "CasalComplex1.h", 31);
+  LoadConfiguration();
+
+  EXPECT_THROW(model_->Start(RunMode::kEstimation), std::string);
+}
+
 /**
  *
  */
@@ -90,6 +148,166 @@ TEST_F(InternalEmptyModel, Model_CasalComplex1_Simulation) {
   EXPECT_DOUBLE_EQ(0.056026019079491715,  comparisons[1992][9].observed_);
 }
 
+/**
+ * Run the model with the number of threads given and return the report
+ * output. The fixture is set up again for each run.
+ */
+class CasalComplex1Threads : public InternalEmptyModel {
+protected:
+  string Run(unsigned threads, string configuration, utilities::RunParameters& parameters, std::function<void(shared_ptr<Model>)> set_up = nullptr) {
+    TearDown();
+    SetUp();
+
+    boost::replace_first(configuration, "@model\n", "@model\nthreads " + std::to_string(threads) + "\n");
+    AddConfigurationLine(configuration, "CasalComplex1.h", 31);
+    LoadConfiguration();
+
+    LoadThreadModels(parameters, set_up);
+    if (HasFatalFailure())
+      return "";
+
+    return StartAndCaptureOutput(parameters.run_mode_);
+  }
+
+  string RunSimulations(unsigned threads, unsigned candidates) {
+    utilities::RunParameters parameters;
+    parameters.run_mode_ = RunMode::kSimulation;
+    parameters.simulation_candidates_ = candidates;
+    string reports = "@report simulated_chatTANage\ntype simulated_observation\nobservation chatTANage\n";
+    return Run(threads, test_cases_casal_complex_1 + reports, parameters);
+  }
+};
+
+/**
+ * The simulated observations and their reports must not depend on the number of threads
+ */
+TEST_F(CasalComplex1Threads, Model_CasalComplex1_Simulation_Threads) {
+  string single_thread = RunSimulations(1, 5);
+  string three_threads = RunSimulations(3, 5);
+  ASSERT_FALSE(HasFailure());
+
+  vector<string::size_type> starts;
+  for (auto start = single_thread.find("@observation"); start != string::npos; start = single_thread.find("@observation", start + 1))
+    starts.push_back(start);
+  ASSERT_EQ(5u, starts.size());
+  starts.push_back(single_thread.size());
+
+  // each simulation has its own random number stream
+  EXPECT_NE(single_thread.substr(starts[0], starts[1] - starts[0]), single_thread.substr(starts[1], starts[2] - starts[1]));
+  EXPECT_EQ(single_thread, three_threads);
+}
+
+/**
+ * Each row of -i values run across the threads must be reported with the
+ * values of the model that ran it. The values are given to the models as
+ * they would be loaded from the -i file.
+ */
+TEST_F(CasalComplex1Threads, Model_CasalComplex1_Input_File_Threads) {
+  vector<double> a50s = { 6.0, 7.5, 9.0, 10.5, 12.0 };
+  auto add_values = [&a50s](shared_ptr<Model> model) {
+    Estimables& estimables = *model->managers()->estimables();
+    for (unsigned i = 0; i < a50s.size(); ++i) {
+      estimables.AddValue("selectivity[chatTANselMale].a50", a50s[i]);
+      estimables.AddValue("selectivity[chatTANselMale].ato95", 3.0 + i * 0.5);
+    }
+  };
+
+  string configuration = test_cases_casal_complex_1 + R"(
+@report selectivity_male
+type selectivity
+selectivity chatTANselMale
+
+@report recruitment
+type process
+process recruitment
+
+@report observation_chatTANage
+type observation
+observation chatTANage
+)";
+
+  utilities::RunParameters parameters;
+  parameters.run_mode_ = RunMode::kBasic;
+  string single_thread = Run(1, configuration, parameters, add_values);
+  string three_threads = Run(3, configuration, parameters, add_values);
+  ASSERT_FALSE(HasFailure());
+
+  vector<double> reported_a50s;
+  for (auto start = three_threads.find("a50: "); start != string::npos; start = three_threads.find("a50: ", start + 1))
+    reported_a50s.push_back(std::stod(three_threads.substr(start + 5)));
+  EXPECT_EQ(a50s, reported_a50s);
+
+  EXPECT_EQ(single_thread, three_threads);
+}
+
+/**
+ * Build and prepare the models for many threads at the same time. Each
+ * model creates its objects from its own factory, logs from its own thread
+ * and shares the table rows with the others, so every model must finish
+ * with the same shared data and the same score as a model built on its own.
+ */
+TEST_F(InternalEmptyModel, Model_CasalComplex1_Concurrent_Build) {
+  const unsigned model_count = 8;
+  AddConfigurationLine(test_cases_casal_complex_1, "CasalComplex1.h", 31);
+
+  auto shared_data = std::make_shared<SharedData>();
+  auto reports = model_->managers()->report();
+  auto minimisers = model_->managers()->minimiser();
+  vector<shared_ptr<Model>> models;
+  for (unsigned i = 0; i < model_count; ++i) {
+    shared_ptr<Model> model(new model::Age());
+    model->set_id(i + 2);
+    model->managers()->set_reports(reports);
+    model->managers()->set_minimiser(minimisers);
+    model->set_run_mode(RunMode::kBasic);
+    model->set_shared_data(shared_data);
+    model->global_configuration().flag_skip_config_file();
+    models.push_back(model);
+  }
+
+  // Errors are thrown in unit tests so catch them on the thread that builds each model
+  vector<string> errors(model_count, "");
+  vector<Double> scores(model_count, 0.0);
+  vector<std::thread> threads;
+  for (unsigned i = 0; i < model_count; ++i) {
+    threads.push_back(std::thread([this, i, &models, &errors, &scores]() {
+      try {
+        shared_ptr<Model> model = models[i];
+        configuration::Loader loader;
+        for (configuration::FileLine file_line : configuration_file_)
+          loader.AddFileLine(file_line);
+        loader.LoadConfigFile(model->global_configuration());
+        loader.ParseFileLines();
+        vector<shared_ptr<Model>> model_list = { model };
+        loader.Build(model_list);
+
+        if (!model->PrepareForIterations()) {
+          errors[i] = "PrepareForIterations() failed";
+          return;
+        }
+        model->FullIteration();
+        model->objective_function().CalculateScore();
+        scores[i] = model->objective_function().score();
+      } catch (const string& message) {
+        errors[i] = message;
+      }
+    }));
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  LoadConfiguration();
+  model_->Start(RunMode::kBasic);
+  Double score = model_->objective_function().score();
+  ASSERT_NE(0u, shared_data->size());
+  EXPECT_EQ(model_->shared_data()->size(), shared_data->size());
+
+  for (unsigned i = 0; i < model_count; ++i) {
+    EXPECT_EQ("", errors[i]) << "for model " << models[i]->id();
+    EXPECT_DOUBLE_EQ(score, scores[i]) << "for model " << models[i]->id();
+  }
+}
+
 } /* namespace testcases */
 } /* namespace niwa */
 
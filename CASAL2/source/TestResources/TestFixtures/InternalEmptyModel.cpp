@@ -33,6 +33,7 @@
 #include "../../Processes/Manager.h"
 #include "../../Reports/Manager.h"
 #include "../../Selectivities/Manager.h"
+#include "../../ThreadPool/ThreadPool.h"
 #include "../../TimeSteps/Manager.h"
 #include "../../Logging/Logging.h"
 #include "../../Utilities/RandomNumberGenerator.h"
@@ -54,6 +55,21 @@ void InternalEmptyModel::SetUp() {
   model_->flag_primary_thread_model();
 }
 
+/**
+ * Stop the thread pool and report thread if the test started them
+ */
+void InternalEmptyModel::TearDown() {
+  if (thread_pool_) {
+    thread_pool_->TerminateAll();
+    model_->set_thread_pool(nullptr);
+    thread_pool_.reset();
+  }
+  thread_models_.clear();
+  StopReportThread();
+
+  Base::TearDown();
+}
+
 /**
  * Add a new line to our internal configuration vector so we can load it.
  *
@@ -95,6 +111,143 @@ void InternalEmptyModel::LoadConfiguration() {
   loader.Build(model_list);
 }
 
+/**
+ * Load our internal configuration file in to a new model, e.g. to
+ * compare with model_ after it has been changed
+ *
+ * @return The new model
+ */
+shared_ptr<Model> InternalEmptyModel::LoadConfigurationInToNewModel() {
+  shared_ptr<Model> model(new model::Age());
+  model->global_configuration().flag_skip_config_file();
+  model->flag_primary_thread_model();
+
+  configuration::Loader loader;
+  for (config::FileLine file_line : configuration_file_)
+    loader.AddFileLine(file_line);
+
+  loader.LoadConfigFile(model->global_configuration());
+  loader.ParseFileLines();
+  vector<shared_ptr<Model>> model_list = { model };
+  loader.Build(model_list);
+  return model;
+}
+
+/**
+ * Create the models for the extra threads the configuration asks for and build them
+ * from the same configuration, then prepare them and give the master model a thread
+ * pool. This follows what the runner does: the master model is prepared first so it
+ * builds the shared data, then the other models are prepared at the same time.
+ *
+ * @param run_parameters The run parameters given to every model
+ * @param set_up Optional method called on every model before it is prepared
+ */
+void InternalEmptyModel::LoadThreadModels(utilities::RunParameters& run_parameters, std::function<void(shared_ptr<Model>)> set_up) {
+  RunMode::Type run_mode = run_parameters.run_mode_;
+  model_->set_id(1);
+  model_->set_run_mode(run_mode);
+  for (unsigned i = 1; i < model_->threads(); ++i) {
+    shared_ptr<Model> model(new model::Age());
+    model->set_id(i + 1);
+    model->managers()->set_reports(model_->managers()->report());
+    model->managers()->set_minimiser(model_->managers()->minimiser());
+    model->set_run_mode(run_mode);
+    model->set_shared_data(model_->shared_data());
+    model->global_configuration().flag_skip_config_file();
+    thread_models_.push_back(model);
+  }
+
+  if (thread_models_.size() > 0) {
+    configuration::Loader loader;
+    for (config::FileLine file_line : configuration_file_)
+      loader.AddFileLine(file_line);
+
+    loader.LoadConfigFile(model_->global_configuration());
+    loader.ParseFileLines();
+    loader.Build(thread_models_);
+  }
+
+  vector<shared_ptr<Model>> model_list = thread_models_;
+  model_list.insert(model_list.begin(), model_);
+  unsigned seed = model_->random_number_seed();
+  for (auto model : model_list) {
+    model->global_configuration().set_run_parameters(run_parameters);
+    model->set_random_number_seed(seed);
+    if (set_up)
+      set_up(model);
+  }
+
+  ASSERT_TRUE(model_->PrepareForIterations());
+
+  // Errors are thrown in unit tests so catch them on the thread that prepares each model
+  vector<string> errors(thread_models_.size(), "");
+  vector<std::thread> prepare_threads;
+  for (unsigned i = 0; i < thread_models_.size(); ++i) {
+    auto model = thread_models_[i];
+    string* error = &errors[i];
+    prepare_threads.push_back(std::thread([model, error]() {
+      try {
+        if (!model->PrepareForIterations())
+          *error = "PrepareForIterations() failed";
+      } catch (const string& message) {
+        *error = message;
+      }
+    }));
+  }
+  for (auto& thread : prepare_threads)
+    thread.join();
+  for (unsigned i = 0; i < errors.size(); ++i)
+    ASSERT_EQ("", errors[i]) << "for model " << thread_models_[i]->id();
+
+  thread_pool_.reset(new ThreadPool());
+  thread_pool_->CreateThreads(model_list);
+  model_->set_thread_pool(thread_pool_);
+}
+
+/**
+ * Start writing the reports on their own thread the same way the runner does
+ */
+void InternalEmptyModel::StartReportThread() {
+  auto reports = model_->managers()->report();
+  report_thread_ = std::thread([reports]() {
+    reports->FlushReports();
+  });
+}
+
+/**
+ * Stop the report thread once it has written everything it has been given
+ */
+void InternalEmptyModel::StopReportThread() {
+  if (!report_thread_.joinable())
+    return;
+
+  model_->managers()->report()->StopThread();
+  report_thread_.join();
+}
+
+/**
+ * Start the model with the report thread running and return
+ * what the reports printed. Errors are thrown in test mode so
+ * they are caught to stop capturing the output.
+ *
+ * @param run_mode The run mode to start the model in
+ * @return the output from the reports
+ */
+string InternalEmptyModel::StartAndCaptureOutput(RunMode::Type run_mode) {
+  string error = "";
+  testing::internal::CaptureStdout();
+  StartReportThread();
+  try {
+    model_->Start(run_mode);
+  } catch (const string& message) {
+    error = message;
+  }
+  StopReportThread();
+  string output = testing::internal::GetCapturedStdout();
+  EXPECT_EQ("", error);
+  return output;
+}
+
 } /* namespace sizeweights */
 } /* namespace niwa */
 #endif /* TESTMODE */
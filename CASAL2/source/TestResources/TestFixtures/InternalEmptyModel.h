@@ -17,15 +17,19 @@
 #define TESTFIXTURES_INTERNALEMPTYMODEL_H_
 
 // Headers
+#include <functional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../../ConfigurationLoader/Loader.h"
 #include "../../TestResources/TestFixtures/Base.h"
+#include "../../Utilities/RunParameters.h"
 
 // Namespaces
 namespace niwa {
 namespace model { class Age; }
+class ThreadPool;
 
 namespace testfixtures {
 using std::string;
@@ -41,12 +45,21 @@ public:
   InternalEmptyModel() = default;
   virtual                     ~InternalEmptyModel() = default;
   void                        SetUp() override final;
+  void                        TearDown() override final;
   void                        AddConfigurationLine(const string& line, const string& file_name, unsigned line_number);
   void                        LoadConfiguration();
+  shared_ptr<Model>           LoadConfigurationInToNewModel();
+  void                        LoadThreadModels(utilities::RunParameters& run_parameters, std::function<void(shared_ptr<Model>)> set_up = nullptr);
+  void                        StartReportThread();
+  void                        StopReportThread();
+  string                      StartAndCaptureOutput(RunMode::Type run_mode);
 
 protected:
   // members
   vector<config::FileLine>    configuration_file_;
+  vector<shared_ptr<Model>>   thread_models_;
+  shared_ptr<ThreadPool>      thread_pool_;
+  std::thread                 report_thread_;
 };
 
 } /* namespace testfixtures */
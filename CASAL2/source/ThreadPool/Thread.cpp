@@ -10,8 +10,11 @@
 // headers
 #include "Thread.h"
 
+#include <chrono>
+
 #include "../Logging/Logging.h"
 #include "../Model/Model.h"
+#include "../ThreadPool/ThreadPool.h"
 
 // TODO: Move this to the model
 #include "../Estimates/Manager.h"
@@ -25,9 +28,12 @@ namespace niwa {
 /**
  * Our default constructor
  *
+ * @param thread_pool The pool we take our work from
+ * @param index Our index in the thread pool
  * @param Shared Pointer to the model this thread is responsible for
  */
-Thread::Thread(shared_ptr<Model> model) : model_(model) {
+Thread::Thread(ThreadPool& thread_pool, unsigned index, shared_ptr<Model> model)
+	: thread_pool_(thread_pool), index_(index), model_(model) {
 }
 
 /**
@@ -57,107 +63,181 @@ void Thread::Join() {
  * WARNING: This function is to only be called by the thread spawned
  * in the this->Launch() method. Do not write any other code to
  * call this function
+ *
+ * The thread asks the pool for the next job. This will block (sleeping)
+ * until there is work available in our deque or another thread's deque,
+ * or the pool has been terminated.
  */
 void Thread::Loop() {
-	// Loop while not terminate
-	// Note: No lock cause terminate_ is atomic
-	while(!terminate_) {
-		// Check to see if we have any candidates available for running
+	Job job;
+	while (thread_pool_.NextJob(index_, job)) {
+		is_finished_ = false;
+		LOG_FINEST() << "Thread " << std::this_thread::get_id() << " has model " << model_.get();
+
+		auto start = std::chrono::steady_clock::now();
+		double score = 0.0;
+		std::exception_ptr error;
+		try {
+			if (job.task_)
+				job.task_(model_);
+			else
+				score = RunModel(job.candidates_);
+		} catch (...) {
+			error = std::current_exception();
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		// Record our timing before we hand the score back so the pool sees it when the batch completes
 		{
 			std::scoped_lock l(lock_);
-			try {
-				if (new_candidates_.size() > 0) {
-					LOG_FINEST() << "Thread " << thread_->get_id() << " has model " << model_.get();
-
-					is_finished_ = false;
-					candidates_ = new_candidates_;
-					new_candidates_.clear();
-
-//					string cl = "";
-//					for (auto candidate : candidates_)
-//						cl += utilities::ToInline<double, string>(candidate) + ", ";
-//					LOG_MEDIUM() << "[Thread# " << thread_->get_id() << "] Running candidates: " << cl;
-
-					// TODO: Move this to the model
-					auto estimates = model_->managers()->estimate()->GetIsEstimated();
-					if (candidates_.size() != estimates.size()) {
-						LOG_CODE_ERROR() << "The number of enabled estimates does not match the number of test solution values";
-					}
-
-					for (unsigned i = 0; i < candidates_.size(); ++i)
-						estimates[i]->set_value(candidates_[i]);
-
-					model_->managers()->estimate_transformation()->RestoreEstimates();
-					model_->FullIteration();
-
-					ObjectiveFunction& objective = model_->objective_function();
-					objective.CalculateScore();
-//					cout << "Pushing Score: " << objective.score() << " to stack" << endl;
-					scores_.push(objective.score());
-
-					model_->managers()->estimate_transformation()->TransformEstimates();
-
-					is_finished_ = true;
-				}
-			}
-			catch (...) {
-				cout << "Some shit went wrong" << endl;
-			}
-
-			is_finished_ = true;
-			// Nothing to do, yield control back to CPU
-			std::this_thread::yield();
+			busy_time_ += elapsed.count();
+			++candidates_run_;
+			if (job.stolen_)
+				++steals_;
 		}
+
+		if (error)
+			job.score_.set_exception(error);
+		else
+			job.score_.set_value(score);
+
+		job = Job();
+		is_finished_ = true;
 	}
 }
 
 /**
- * Accept some new candidates to be run by our thread.
- * Store them in new candidates so they can be copied into a
- * current candidate vector before we run.
+ * Run our model with a set of candidates and return the objective score
+ *
+ * @param candidates The candidates to set on the estimates before running
+ * @return The objective function score
+ */
+double Thread::RunModel(const vector<double>& candidates) {
+	// The candidates are in transformed space. Our model may not have
+	// been transformed yet, this is ignored if it already has been.
+	model_->managers()->estimate_transformation()->TransformEstimates();
+
+	// TODO: Move this to the model
+	auto estimates = model_->managers()->estimate()->GetIsEstimated();
+	if (candidates.size() != estimates.size()) {
+		LOG_CODE_ERROR() << "The number of enabled estimates does not match the number of test solution values";
+	}
+
+	for (unsigned i = 0; i < candidates.size(); ++i)
+		estimates[i]->set_value(candidates[i]);
+
+	model_->managers()->estimate_transformation()->RestoreEstimates();
+	model_->FullIteration();
+
+	ObjectiveFunction& objective = model_->objective_function();
+	objective.CalculateScore();
+	double score = objective.score();
+
+	model_->managers()->estimate_transformation()->TransformEstimates();
+	return score;
+}
+
+/**
+ * Accept some new candidates to be run. They're pushed on to the back of our deque
+ * and will be picked up by us, or stolen by another thread if we're busy.
+ *
+ * Note: This should only be called by the ThreadPool as it's responsible for waking
+ * the threads once the work has been queued.
  *
  * @param candidates The new candidates we want to run a model against
+ * @return A future that will hold the objective score once the model has been run
+ */
+std::future<double> Thread::QueueCandidates(const vector<double>& candidates) {
+	std::scoped_lock l(lock_);
+	Job job;
+	job.candidates_ = candidates;
+	std::future<double> result = job.score_.get_future();
+	jobs_.push_back(std::move(job));
+	return result;
+}
+
+/**
+ * Accept a task to be run against a model. Like candidates, tasks can be
+ * stolen by other threads so the task must not care which model it's given.
+ *
+ * @param task The task to run
+ * @return A future that will be set (to 0) once the task has finished
  */
-void Thread::RunCandidates(const vector<double>& candidates) {
+std::future<double> Thread::QueueTask(std::function<void(shared_ptr<Model>)> task) {
 	std::scoped_lock l(lock_);
-	new_candidates_ = candidates;
-	is_finished_ = false;
+	Job job;
+	job.task_ = task;
+	std::future<double> result = job.score_.get_future();
+	jobs_.push_back(std::move(job));
+	return result;
 }
 
 /**
- * Flag our terminate variable. This is called when we need to wrap up all threads.
+ * Take the next job off the front of our deque. This is called by
+ * the thread that owns this deque.
  *
- * Note: We don't need a lock because terminate_ is atomic
+ * @param job The job to populate
+ * @return true if we found a job, false otherwise
  */
-void Thread::flag_terminate() {
-	//std::scoped_lock l(lock_);
-	terminate_ = true;
+bool Thread::PopFront(Job& job) {
+	std::scoped_lock l(lock_);
+	if (jobs_.empty())
+		return false;
+
+	job = std::move(jobs_.front());
+	jobs_.pop_front();
+	return true;
 }
 
 /**
- * Check to see if we've finished the current iteration
+ * Take a job off the back of our deque. This is called by
+ * other threads that have run out of work and are stealing from us.
+ *
+ * @param job The job to populate
+ * @return true if we found a job, false otherwise
+ */
+bool Thread::PopBack(Job& job) {
+	std::scoped_lock l(lock_);
+	if (jobs_.empty())
+		return false;
+
+	job = std::move(jobs_.back());
+	jobs_.pop_back();
+	return true;
+}
+
+/**
+ * Check to see if we're not currently running a model
  *
  * Note: We don't need a lock because is_finished_ is atomic
  */
 bool Thread::is_finished() {
-//	std::scoped_lock l(lock_);
 	return is_finished_;
 }
 
 /**
- * Return the objective score for the model iteration we just ran
+ * Return the total amount of time (seconds) spent running models
  */
-double Thread::objective_score() {
+double Thread::busy_time() {
 	std::scoped_lock l(lock_);
-	if (scores_.size() == 0)
-		LOG_CODE_ERROR() << "(scores_.size() == 0)";
+	return busy_time_;
+}
 
-	double score = scores_.front();
-//	cout << "score is " << score << endl;
-	scores_.pop();
-	return score;
+/**
+ * Return the number of candidates this thread has run
+ */
+unsigned Thread::candidates_run() {
+	std::scoped_lock l(lock_);
+	return candidates_run_;
 }
 
+/**
+ * Return the number of candidates this thread has stolen from other threads
+ */
+unsigned Thread::steals() {
+	std::scoped_lock l(lock_);
+	return steals_;
+}
 
 shared_ptr<Model>	Thread::model() {
 	std::scoped_lock l(lock_);
@@ -5,6 +5,14 @@
  * @section LICENSE
  *
  * Copyright NIWA Science 2019 - www.niwa.co.nz
+ *
+ * @description
+ * A thread owns a single model and a deque of jobs. The owning
+ * thread pops work from the front of its deque while other threads
+ * are allowed to steal from the back once their own deque is empty.
+ * Each candidate set is paired with a promise so the caller can
+ * collect the objective score through a future. A job can also be a
+ * task that is given the thread's model to run (e.g. a simulation).
  */
 #ifndef SOURCE_THREADPOOL_THREAD_H_
 #define SOURCE_THREADPOOL_THREAD_H_
@@ -12,16 +20,20 @@
 // headers
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <future>
 #include <vector>
 #include <memory>
 #include <atomic>
-#include <queue>
+#include <deque>
+#include <functional>
 
 #include "../Utilities/NoCopy.h"
 
 // namespaces
 namespace niwa {
 class Model;
+class ThreadPool;
 using std::vector;
 using std::mutex;
 using std::thread;
@@ -30,29 +42,47 @@ using std::shared_ptr;
 // class declaration
 class Thread {
 public:
+	// structs
+	struct Job {
+		vector<double>						candidates_;
+		std::function<void(shared_ptr<Model>)> task_;
+		std::promise<double>			score_;
+		bool											stolen_ = false;
+	};
+
+	// methods
 	Thread() = delete;
-	explicit Thread(shared_ptr<Model> model);
+	explicit Thread(ThreadPool& thread_pool, unsigned index, shared_ptr<Model> model);
 	virtual ~Thread() = default;
 	void												Launch();
 	void												Join();
-	void												RunCandidates(const vector<double>& candidates);
+	std::future<double>					QueueCandidates(const vector<double>& candidates);
+	std::future<double>					QueueTask(std::function<void(shared_ptr<Model>)> task);
+	bool												PopFront(Job& job);
+	bool												PopBack(Job& job);
 	void												Loop();
 
 	// accessors
-	void												flag_terminate();
 	bool												is_finished();
-	double											objective_score();
+	double											busy_time();
+	unsigned										candidates_run();
+	unsigned										steals();
 	shared_ptr<Model>						model();
 
 private:
+	// methods
+	double											RunModel(const vector<double>& candidates);
+
 	// members
+	ThreadPool&									thread_pool_;
+	unsigned										index_ = 0;
 	shared_ptr<std::thread>			thread_;
 	shared_ptr<Model>						model_;
-	std::atomic<bool>						is_finished_ = false;
-	std::atomic<bool>						terminate_ = false;
-	vector<double>							new_candidates_;
-	vector<double>							candidates_;
-	std::queue<double>					scores_;
+	std::atomic<bool>						is_finished_ = true;
+	std::deque<Job>							jobs_;
+	double											busy_time_ = 0.0;
+	unsigned										candidates_run_ = 0;
+	unsigned										steals_ = 0;
 	std::mutex									lock_;
 
 	DISALLOW_COPY_AND_ASSIGN(Thread);
@@ -11,6 +11,7 @@
 #include "ThreadPool.h"
 
 #include <chrono>
+#include <future>
 
 #include "../Logging/Logging.h"
 #include "../Model/Model.h"
@@ -28,9 +29,12 @@ namespace niwa {
 void ThreadPool::CreateThreads(vector<shared_ptr<Model>> models) {
 	// Create our Thread class objects
 	for(auto model : models) {
-		auto thread = shared_ptr<Thread>(new Thread(model));
+		auto thread = shared_ptr<Thread>(new Thread(*this, threads_.size(), model));
 		threads_.push_back(thread);
 	}
+	statistics_.thread_busy_time_.assign(threads_.size(), 0.0);
+	statistics_.thread_candidates_.assign(threads_.size(), 0);
+	statistics_.thread_steals_.assign(threads_.size(), 0);
 
 	// Launch our threads
 	for (auto thread : threads_) {
@@ -39,61 +43,139 @@ void ThreadPool::CreateThreads(vector<shared_ptr<Model>> models) {
 }
 
 /**
- * Run a collection of candidates. This method will iterate over our threads
- * and give any that are not currently processing a set of candidates. Then it'll
- * return a vector of equal length to the candidates containing the objective scores for each
+ * Run a collection of candidates. The candidates are dealt out across the
+ * thread deques and every thread is woken up. Threads that finish their own
+ * work early will steal candidates from the threads that are still busy.
+ * We then block on the future for each candidate and return a vector of equal
+ * length to the candidates containing the objective scores for each.
+ *
+ * Timing information for the batch is added to our statistics.
  *
  * @param candidates A vector of candidates (vector of doubles)
- * @return A vector of objective scores matching the length of the candidates vector
+ * @param scores A vector of objective scores matching the length of the candidates vector
  */
 void ThreadPool::RunCandidates(const vector<vector<double>>& candidates, vector<double>& scores) {
-
-	vector<int> thread_ids(candidates.size(), -1); // Track which thread is doing the work for each candidate
-	using namespace std::chrono_literals;
 	LOG_MEDIUM() << "Running a collection of " << candidates.size() << " candidates";
-//	cout << "candidates.size(): " << candidates.size() << endl;
-//	std::this_thread::sleep_for(5s);
-	// loop over our candidates, then find a thread for each one to be run in
-	unsigned last_thread = 0;
-	for (unsigned i = 0; i < candidates.size(); ++i) {
-		bool found_thread = false;
-		LOG_MEDIUM() << "Looking for thread for candidate set " << i+1;
-		while (!found_thread) {
-			if (last_thread >= threads_.size())
-				last_thread = 0;
-			for (int thread_idx = last_thread; thread_idx < (int)threads_.size(); ++thread_idx) {
-				auto& thread = threads_[thread_idx];
-				// is this thread available?
-				if (thread->is_finished()) {
-//					cout << "Found thread " << thread_idx << " for candidate set " << i << endl;
-					LOG_MEDIUM() << "Found thread " << thread_idx << " for candidate set " << i;
-					LOG_MEDIUM() << "candidates[i].size(): " << candidates[i].size();
-
-//					std::this_thread::sleep_for(5s);
-					found_thread = true;
-					thread->RunCandidates(candidates[i]);
-					thread_ids[i] = thread_idx;
-					last_thread = thread_idx + 1;
-					break;
-				}
-			}
-		}
-	}
+	RunBatch(candidates.size(), [&candidates](Thread& thread, unsigned index) {
+		return thread.QueueCandidates(candidates[index]);
+	}, scores);
+}
+
+/**
+ * Run a collection of tasks. Each task is given the model of the thread
+ * that picks it up, and tasks are balanced across the threads the same
+ * way as candidates. This blocks until every task has finished.
+ *
+ * @param tasks The tasks to run
+ */
+void ThreadPool::RunTasks(const vector<std::function<void(shared_ptr<Model>)>>& tasks) {
+	LOG_MEDIUM() << "Running a collection of " << tasks.size() << " tasks";
+	vector<double> scores;
+	RunBatch(tasks.size(), [&tasks](Thread& thread, unsigned index) {
+		return thread.QueueTask(tasks[index]);
+	}, scores);
+}
 
-	LOG_MEDIUM() << "All candidates assigned to threads";
-	// We've assigned each candidate to a thread, now we'll wait until they're all finished
-	for (unsigned i = 0; i < candidates.size(); ++i) {
-		auto& thread = threads_[thread_ids[i]];
-		// Wait until the thread is finished
-		while(!thread->is_finished())
-			std::this_thread::yield();
+/**
+ * Queue a batch of jobs across the threads, wake them up and wait
+ * for them all to finish. Timing information for the batch is added
+ * to our statistics.
+ *
+ * @param count The number of jobs in the batch
+ * @param queue Function that queues job index on the given thread
+ * @param scores The scores returned by each job
+ */
+void ThreadPool::RunBatch(unsigned count, std::function<std::future<double>(Thread&, unsigned)> queue, vector<double>& scores) {
+	if (threads_.size() == 0)
+		LOG_CODE_ERROR() << "(threads_.size() == 0)";
+
+	vector<double> busy_time_start(threads_.size(), 0.0);
+	for (unsigned i = 0; i < threads_.size(); ++i)
+		busy_time_start[i] = threads_[i]->busy_time();
+	auto start = std::chrono::steady_clock::now();
+
+	vector<std::future<double>> futures;
+	futures.reserve(count);
+	for (unsigned i = 0; i < count; ++i)
+		futures.push_back(queue(*threads_[i % threads_.size()], i));
+
+	{
+		std::scoped_lock l(lock_);
+		pending_jobs_ += count;
+	}
+	condition_.notify_all();
+
+	LOG_MEDIUM() << "All jobs queued on threads";
+	// Wait for every job before we collect any of them. A job that failed will rethrow
+	// its error below and the rest of the batch must not still be running when it does
+	for (auto& future : futures)
+		future.wait();
+
+	scores.resize(count);
+	for (unsigned i = 0; i < futures.size(); ++i) {
+		scores[i] = futures[i].get();
+		LOG_MEDIUM() << "Job " << i << " has returned score " << scores[i];
+	}
 
-		scores[i] = thread->objective_score();
+	// Work out how well balanced this batch was
+	std::chrono::duration<double> wall_time = std::chrono::steady_clock::now() - start;
+	double total_busy = 0.0;
+	double max_busy   = 0.0;
+	for (unsigned i = 0; i < threads_.size(); ++i) {
+		double busy = threads_[i]->busy_time() - busy_time_start[i];
+		total_busy += busy;
+		max_busy = busy > max_busy ? busy : max_busy;
+	}
+	double mean_busy = total_busy / threads_.size();
+	double imbalance = mean_busy > 0.0 ? max_busy / mean_busy : 1.0;
+	double idle_time = (wall_time.count() * threads_.size()) - total_busy;
+	idle_time = idle_time > 0.0 ? idle_time : 0.0;
+	LOG_MEDIUM() << "Batch took " << wall_time.count() << "s with " << idle_time << "s idle thread time and an imbalance ratio of " << imbalance;
+
+	std::scoped_lock l(lock_);
+	statistics_.batches_++;
+	statistics_.candidates_ += count;
+	statistics_.wall_time_ += wall_time.count();
+	statistics_.idle_time_ += idle_time;
+	statistics_.last_wall_time_ = wall_time.count();
+	statistics_.last_idle_time_ = idle_time;
+	statistics_.last_imbalance_ratio_ = imbalance;
+	statistics_.mean_imbalance_ratio_ += (imbalance - statistics_.mean_imbalance_ratio_) / statistics_.batches_;
+	statistics_.max_imbalance_ratio_ = imbalance > statistics_.max_imbalance_ratio_ ? imbalance : statistics_.max_imbalance_ratio_;
+}
 
-		LOG_MEDIUM() << "Thread " << thread_ids[i] << " has returned score " << scores[i];
+/**
+ * WARNING: This is only to be called from Thread::Loop() by the thread asking for work.
+ *
+ * Block until there is a job available or we've been terminated. When a job is
+ * available we reserve it by decrementing the pending count. This guarantees one
+ * is sitting in a deque for us, so we check our own deque first and then steal
+ * from the back of the other threads' deques.
+ *
+ * @param thread_index The index of the thread asking for work
+ * @param job The job to populate
+ * @return true if we have a job to run, false if the thread should exit
+ */
+bool ThreadPool::NextJob(unsigned thread_index, Thread::Job& job) {
+	{
+		std::unique_lock l(lock_);
+		condition_.wait(l, [this]() { return terminate_ || pending_jobs_ > 0; });
+		if (terminate_)
+			return false;
+		--pending_jobs_;
 	}
 
-	return;
+	while (true) {
+		if (threads_[thread_index]->PopFront(job))
+			return true;
+
+		for (unsigned offset = 1; offset < threads_.size(); ++offset) {
+			if (threads_[(thread_index + offset) % threads_.size()]->PopBack(job)) {
+				job.stolen_ = true;
+				return true;
+			}
+		}
+	}
 }
 
 /**
@@ -110,8 +192,12 @@ void ThreadPool::TerminateAll() {
  * Terminate all threads
  */
 void ThreadPool::Terminate() {
-	for (auto& thread : threads_)
-		thread->flag_terminate();
+	{
+		std::scoped_lock l(lock_);
+		terminate_ = true;
+	}
+
+	condition_.notify_all();
 }
 
 /**
@@ -144,8 +230,19 @@ void ThreadPool::CheckThreads() {
 
 }
 
-void ThreadPool::StressTest() {
+/**
+ * Return a copy of the timing statistics for the batches
+ * we've run, including the totals for each thread
+ */
+ThreadPoolStatistics ThreadPool::statistics() {
+	std::scoped_lock l(lock_);
+	for (unsigned i = 0; i < threads_.size(); ++i) {
+		statistics_.thread_busy_time_[i]  = threads_[i]->busy_time();
+		statistics_.thread_candidates_[i] = threads_[i]->candidates_run();
+		statistics_.thread_steals_[i]     = threads_[i]->steals();
+	}
 
+	return statistics_;
 }
 
 
@@ -11,14 +11,23 @@
  * given to the Minimisers/MCMC etc. When a class gives this
  * class a container of candidates it'll run the model and return
  * the objective function values.
+ *
+ * Candidates are spread across a deque per thread. Each thread takes
+ * work from the front of its own deque and, once that is empty, steals
+ * from the back of the other threads' deques. This keeps every thread
+ * busy until the whole batch has been run, even when some model
+ * iterations are much more expensive than others.
  */
 #ifndef SOURCE_THREADPOOL_THREADPOOL_H_
 #define SOURCE_THREADPOOL_THREADPOOL_H_
 
 // headers
 #include <mutex>
+#include <condition_variable>
 #include <vector>
 #include <string>
+#include <functional>
+#include <future>
 
 #include "../ThreadPool/Thread.h"
 
@@ -29,6 +38,25 @@ using std::string;
 using std::vector;
 using std::mutex;
 
+/**
+ * Timing information gathered over every batch of candidates
+ * the thread pool has run. Times are in seconds.
+ */
+struct ThreadPoolStatistics {
+	unsigned										batches_ = 0;
+	unsigned										candidates_ = 0;
+	double											wall_time_ = 0.0;
+	double											idle_time_ = 0.0;
+	double											last_wall_time_ = 0.0;
+	double											last_idle_time_ = 0.0;
+	double											last_imbalance_ratio_ = 0.0;
+	double											mean_imbalance_ratio_ = 0.0;
+	double											max_imbalance_ratio_ = 0.0;
+	vector<double>							thread_busy_time_;
+	vector<unsigned>						thread_candidates_;
+	vector<unsigned>						thread_steals_;
+};
+
 // class declaration
 class ThreadPool {
 public:
@@ -37,20 +65,29 @@ public:
 	virtual ~ThreadPool() = default;
 	void												CreateThreads(vector<shared_ptr<Model>> models);
 	void												RunCandidates(const vector<vector<double>>& candidates, vector<double>& scores);
+	void												RunTasks(const vector<std::function<void(shared_ptr<Model>)>>& tasks);
+	bool												NextJob(unsigned thread_index, Thread::Job& job);
 	void												TerminateAll();
 	void												CheckThreads();
-	void												StressTest();
 
+	// accessors
 	vector<shared_ptr<Thread>>	Threads() { return threads_; }
+	ThreadPoolStatistics				statistics();
 
 private:
 	// methods
+	void												RunBatch(unsigned count, std::function<std::future<double>(Thread&, unsigned)> queue, vector<double>& scores);
 	void												Terminate();
 	void												JoinAll();
 
 	// members
 	vector<shared_ptr<Thread>>	threads_;
 	double											scores_[100] = {0};
+	std::mutex									lock_;
+	std::condition_variable			condition_;
+	unsigned										pending_jobs_ = 0;
+	bool												terminate_ = false;
+	ThreadPoolStatistics				statistics_;
 
 	DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 };
@@ -32,6 +32,8 @@ RandomDraw::RandomDraw(shared_ptr<Model> model) : TimeVarying(model) {
 
   RegisterAsAddressable(PARAM_MEAN, &mu_);
   RegisterAsAddressable(PARAM_SIGMA, &sigma_);
+
+  stochastic_ = true;
 }
 
 /**
@@ -66,7 +68,7 @@ void RandomDraw::DoBuild() {
  *
  */
 void RandomDraw::DoReset() {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   Double new_value = 0.0;
   // Draw from the random distribution
   if (distribution_ == PARAM_NORMAL) {
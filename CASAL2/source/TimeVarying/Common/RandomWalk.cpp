@@ -35,6 +35,8 @@ RandomWalk::RandomWalk(shared_ptr<Model> model) : TimeVarying(model) {
 
   RegisterAsAddressable(PARAM_MEAN, &mu_);
   RegisterAsAddressable(PARAM_SIGMA, &sigma_);
+
+  stochastic_ = true;
 }
 
 /**
@@ -63,7 +65,7 @@ void RandomWalk::DoBuild() {
  */
 void RandomWalk::DoUpdate() {
   LOG_FINEST() << "value = " << *addressable_;
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->rng();
   Double value = *addressable_;
   Double deviate = rng.normal(AS_DOUBLE(mu_), AS_DOUBLE(sigma_));
   value += value * rho_ + deviate;
@@ -50,5 +50,20 @@ TimeVarying* Manager::GetTimeVarying(const string& label) {
   return nullptr;
 }
 
+/**
+ * Check if any of the time varying objects draw their values
+ * from the random number generator
+ *
+ * @return true if at least one time varying is stochastic
+ */
+bool Manager::HasStochasticValues() const {
+  for (auto time_varying : objects_) {
+    if (time_varying->stochastic())
+      return true;
+  }
+
+  return false;
+}
+
 } /* namespace processes */
 } /* namespace niwa */
@@ -33,6 +33,7 @@ public:
   virtual                     ~Manager() = default;
   void                        Update(unsigned current_year);
   TimeVarying*                GetTimeVarying(const string& label);
+  bool                        HasStochasticValues() const;
 
 protected:
   // methods
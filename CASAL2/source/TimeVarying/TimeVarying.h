@@ -38,6 +38,7 @@ public:
 
   //accessors
   map<unsigned, Double>&      get_parameter_by_year() { return parameter_by_year_; }
+  bool                        stochastic() const { return stochastic_; }
 
 protected:
   // methods
@@ -68,6 +69,7 @@ protected:
   vector<Double>*             addressable_vector_ = 0;
   Double*                     addressable_ = 0;
   map<unsigned, Double>       parameter_by_year_;
+  bool                        stochastic_ = false; // true if the values are drawn from the random number generator
 };
 
 typedef std::shared_ptr<TimeVarying> TimeVaryingPtr;
@@ -137,10 +137,12 @@
 #define PARAM_AGEING_LABEL                        "ageing_label"
 #define PARAM_AGEING_ERROR                        "ageing_error"
 #define PARAM_AGEING_ERRORS                       "ageing_errors"
+#define PARAM_ACCELERATION                        "acceleration"
 #define PARAM_ALGORITHM														"algorithm"
 #define PARAM_ALL_VALUES_BOUNDED                  "all_values_bounded"
 #define PARAM_ALL_VALUES                          "all_values"
 #define PARAM_ALPHA                               "alpha"
+#define PARAM_ANDERSON                            "anderson"
 #define PARAM_ANNUAL_MORTALITY_RATE               "annual_mortality_rate"
 #define PARAM_ANNUAL_SHIFT                        "annual_shift"
 #define PARAM_APPEND                              "append"
@@ -195,6 +197,11 @@
 #define PARAM_CATEGORY_LABELS                     "category_labels"
 #define PARAM_CINITIAL                            "cinitial"
 #define PARAM_CELL_LENGTH                         "cell_length"
+#define PARAM_CHAIN                               "chain"
+#define PARAM_CHAINS                              "chains"
+#define PARAM_CHAIN_BUFFER_SIZE                   "chain_buffer_size"
+#define PARAM_CHECKPOINT_FILE                     "checkpoint_file"
+#define PARAM_CHECKPOINT_FREQUENCY                "checkpoint_frequency"
 #define PARAM_CLASS_MINIMUMS                      "class_minimums"
 #define PARAM_COLUMN                              "column"
 #define PARAM_COLUMN_INDEX                        "column_index"
@@ -392,6 +399,7 @@
 #define PARAM_MAX_ITERATIONS                      "iterations"
 #define PARAM_MCMC                                "mcmc"
 #define PARAM_MCMC_CHAIN                          "mcmc_chain"
+#define PARAM_MCMC_CONVERGENCE                    "mcmc_convergence"
 #define PARAM_MCMC_COVARIANCE                     "mcmc_covariance"
 #define PARAM_MCMC_FIXED                          "mcmc_fixed"
 #define PARAM_MCMC_OBJECTIVE                      "mcmc_objective"
@@ -444,6 +452,8 @@
 #define PARAM_NUISANCE                            "nuisance"
 #define PARAM_NUMBERS                             "numbers"
 #define PARAM_NUMBER_OF_GROWTH_EPISODES           "number_of_growth_episodes"
+#define PARAM_NUMERICAL_HESSIAN                   "numerical_hessian"
+#define PARAM_NUMERICAL_HESSIAN_STEP_SIZE         "numerical_hessian_step_size"
 #define PARAM_NROWS                               "nrows"
 #define PARAM_OBJECTIVE                           "objective"
 #define PARAM_OBJECTIVE_FUNCTION                  "objective_function"
@@ -504,6 +514,7 @@
 #define PARAM_PROCESS_REMOVALS_BY_AGE             "process_removals_by_age"
 #define PARAM_PROCESS_REMOVALS_BY_LENGTH          "process_removals_by_length"
 #define PARAM_PROJECTION_FINAL_YEAR               "projection_final_year"
+#define PARAM_PROJECTION_REUSE_HISTORY            "projection_reuse_history"
 #define PARAM_PROPORTION                          "proportion"
 #define PARAM_PROPORTIONS                         "proportions"
 #define PARAM_PROPORTIONS_AT_AGE                  "proportions_at_age"
@@ -617,6 +628,7 @@
 #define PARAM_TARGET_SELECTIVITIES                "selectivities2"
 #define PARAM_TERMINAL_YEAR                       "terminal_year"
 #define PARAM_THREADS															"threads"
+#define PARAM_THREAD_STATISTICS                   "thread_statistics"
 #define PARAM_THRESHOLD                           "threshold"
 #define PARAM_THRESHOLD_BIOMASS                   "threshold_biomass"
 #define PARAM_THETA_ONE                           "theta1"
@@ -661,6 +673,7 @@
 #define PARAM_VALUES                              "values"
 #define PARAM_VERBOSE                             "verbose"
 #define PARAM_WIDTH                               "width"
+#define PARAM_WARM_START                          "warm_start"
 #define PARAM_WEIGHTS                             "weights"
 #define PARAM_WEIGHTED_PRODUCT                    "weighted_product"
 #define PARAM_WEIGHTED_SUM                        "weighted_sum"
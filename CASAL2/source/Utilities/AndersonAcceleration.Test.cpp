@@ -0,0 +1,96 @@
+/**
+ * @file AndersonAcceleration.Test.cpp
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "AndersonAcceleration.h"
+
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace utilities {
+
+/**
+ * One year of a simple age structured population: constant
+ * recruitment, mortality and ageing in to a plus group
+ */
+void AgeOneYear(const vector<Double>& input, vector<Double>& output, Double survival) {
+  unsigned size = input.size();
+  output.assign(size, 0.0);
+  output[0] = 1.0;
+  for (unsigned i = 1; i < size; ++i)
+    output[i] = input[i - 1] * survival;
+  output[size - 1] += input[size - 1] * survival;
+}
+
+/**
+ * Check the acceleration finds the equilibrium of the population in far
+ * fewer years than iterating would. The acceleration is only started once
+ * every age has been filled by recruitment, leaving just the plus group
+ * to converge.
+ */
+TEST(AndersonAcceleration, AgeStructuredEquilibrium) {
+  unsigned ages = 20;
+  Double survival = 0.95;
+  vector<Double> expected(ages, 0.0);
+  for (unsigned i = 0; i < ages; ++i)
+    expected[i] = pow(survival, i);
+  expected[ages - 1] /= 1.0 - survival;
+
+  // plain iteration is still a long way off after 50 years
+  vector<Double> input(ages, 0.0);
+  vector<Double> output;
+  for (unsigned year = 0; year < 50; ++year) {
+    AgeOneYear(input, output, survival);
+    input = output;
+  }
+  EXPECT_GT(fabs(expected[ages - 1] - input[ages - 1]), 1.0);
+
+  AndersonAcceleration acceleration;
+  input.assign(ages, 0.0);
+  unsigned years = 0;
+  for (; years < 50; ++years) {
+    AgeOneYear(input, output, survival);
+    Double difference = 0.0;
+    for (unsigned i = 0; i < ages; ++i)
+      difference += fabs(output[i] - input[i]);
+    if (difference < 1e-10)
+      break;
+    if (years + 1 >= ages)
+      acceleration.Update(input, output);
+    input = output;
+  }
+
+  EXPECT_LT(years, ages + 5);
+  for (unsigned i = 0; i < ages; ++i)
+    EXPECT_NEAR(expected[i], input[i], 1e-8) << " for age index " << i;
+}
+
+/**
+ * Check extrapolations that would go negative are rejected
+ */
+TEST(AndersonAcceleration, RejectsNegativeValues) {
+  AndersonAcceleration acceleration(2);
+  vector<Double> input = { 1.0 };
+  vector<Double> output = { 0.5 };
+  EXPECT_FALSE(acceleration.Update(input, output));
+
+  // residuals 0.5 -> -0.5 and -1.0, the extrapolation goes negative
+  input = { 0.5 };
+  output = { 0.1 };
+  EXPECT_FALSE(acceleration.Update(input, output));
+  EXPECT_DOUBLE_EQ(0.1, output[0]);
+  EXPECT_EQ(0u, acceleration.history_size());
+}
+
+} /* namespace utilities */
+} /* namespace niwa */
+#endif /* TESTMODE */
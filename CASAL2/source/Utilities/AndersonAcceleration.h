@@ -0,0 +1,212 @@
+/**
+ * @file AndersonAcceleration.h
+ * @author agent (agent@local)
+ * @date 17/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class accelerates a fixed point iteration x = g(x), e.g. running the
+ * annual cycle until the partition reaches equilibrium, with Anderson
+ * acceleration (Walker & Ni 2011).
+ *
+ * After each iteration it is given the input x and the output g(x). It keeps
+ * the differences between the last few iterations and replaces the output
+ * with the combination of the previous outputs that minimises the least
+ * squares residual g(x) - x. For an affine iteration (like an annual cycle
+ * with constant recruitment) this finds the fixed point in roughly as many
+ * iterations as there are slow modes instead of waiting for them to decay.
+ *
+ * Ageing moves values along the partition one age a year, which is not
+ * something a short history can extrapolate. Callers should iterate until
+ * every age has been filled by recruitment before using the acceleration so
+ * only the slow plus group modes are left.
+ *
+ * Extrapolations that would make a value negative are rejected and the
+ * history is cleared so the iteration carries on from the plain output.
+ */
+#ifndef SOURCE_UTILITIES_ANDERSONACCELERATION_H_
+#define SOURCE_UTILITIES_ANDERSONACCELERATION_H_
+
+// headers
+#include <cmath>
+#include <vector>
+
+#include "../Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace utilities {
+
+using std::vector;
+
+/**
+ * Class definition
+ */
+class AndersonAcceleration {
+public:
+  // methods
+  explicit AndersonAcceleration(unsigned depth = 5) : depth_(depth == 0 ? 1 : depth) { };
+  virtual                     ~AndersonAcceleration() = default;
+
+  /**
+   * Forget every previous iteration
+   */
+  void Reset() {
+    history_size_ = 0;
+    next_ = 0;
+    has_previous_ = false;
+  }
+
+  /**
+   * Add an iteration and extrapolate the next input
+   *
+   * @param input The input to the iteration (x)
+   * @param output The output of the iteration (g(x)). This is replaced with the next input to use
+   * @return True if the output was replaced
+   */
+  bool Update(const vector<Double>& input, vector<Double>& output) {
+    unsigned size = output.size();
+    if (has_previous_ && previous_output_.size() != size)
+      Reset();
+
+    residual_.resize(size);
+    for (unsigned i = 0; i < size; ++i)
+      residual_[i] = output[i] - input[i];
+
+    // store the change in the residual and output since the last iteration
+    if (has_previous_) {
+      if (delta_residuals_.size() < depth_) {
+        delta_residuals_.resize(depth_);
+        delta_outputs_.resize(depth_);
+      }
+      vector<Double>& delta_residual = delta_residuals_[next_];
+      vector<Double>& delta_output   = delta_outputs_[next_];
+      delta_residual.resize(size);
+      delta_output.resize(size);
+      for (unsigned i = 0; i < size; ++i) {
+        delta_residual[i] = residual_[i] - previous_residual_[i];
+        delta_output[i]   = output[i] - previous_output_[i];
+      }
+      next_ = (next_ + 1) % depth_;
+      if (history_size_ < depth_)
+        ++history_size_;
+    }
+
+    previous_residual_ = residual_;
+    previous_output_   = output;
+    has_previous_      = true;
+
+    if (history_size_ == 0 || !SolveCoefficients())
+      return false;
+
+    extrapolated_ = output;
+    for (unsigned j = 0; j < history_size_; ++j) {
+      const vector<Double>& delta_output = delta_outputs_[j];
+      for (unsigned i = 0; i < size; ++i)
+        extrapolated_[i] -= coefficients_[j] * delta_output[i];
+    }
+
+    for (unsigned i = 0; i < size; ++i) {
+      if (extrapolated_[i] < 0.0) {
+        Reset();
+        return false;
+      }
+    }
+
+    output.swap(extrapolated_);
+    return true;
+  }
+
+  // accessors
+  unsigned                    depth() const { return depth_; }
+  unsigned                    history_size() const { return history_size_; }
+
+private:
+  /**
+   * Solve the least squares problem min || residual - delta_residuals * coefficients ||
+   * with the normal equations. There are only a handful of coefficients so this is cheap.
+   *
+   * @return False if the problem is singular and no extrapolation should be done
+   */
+  bool SolveCoefficients() {
+    unsigned m = history_size_;
+    unsigned size = residual_.size();
+    matrix_.assign(m * (m + 1), 0.0);  // augmented [m][m + 1]
+
+    Double largest_diagonal = 0.0;
+    for (unsigned j = 0; j < m; ++j) {
+      for (unsigned k = 0; k <= j; ++k) {
+        Double sum = 0.0;
+        for (unsigned i = 0; i < size; ++i)
+          sum += delta_residuals_[j][i] * delta_residuals_[k][i];
+        matrix_[j * (m + 1) + k] = sum;
+        matrix_[k * (m + 1) + j] = sum;
+      }
+      Double sum = 0.0;
+      for (unsigned i = 0; i < size; ++i)
+        sum += delta_residuals_[j][i] * residual_[i];
+      matrix_[j * (m + 1) + m] = sum;
+      if (matrix_[j * (m + 1) + j] > largest_diagonal)
+        largest_diagonal = matrix_[j * (m + 1) + j];
+    }
+    if (largest_diagonal <= 0.0)
+      return false;
+
+    // a little regularisation keeps nearly parallel differences from blowing up
+    for (unsigned j = 0; j < m; ++j)
+      matrix_[j * (m + 1) + j] += largest_diagonal * 1e-10;
+
+    // gaussian elimination with partial pivoting
+    for (unsigned column = 0; column < m; ++column) {
+      unsigned pivot = column;
+      for (unsigned row = column + 1; row < m; ++row) {
+        if (fabs(matrix_[row * (m + 1) + column]) > fabs(matrix_[pivot * (m + 1) + column]))
+          pivot = row;
+      }
+      if (fabs(matrix_[pivot * (m + 1) + column]) <= largest_diagonal * 1e-14)
+        return false;
+      if (pivot != column) {
+        for (unsigned k = 0; k <= m; ++k)
+          std::swap(matrix_[pivot * (m + 1) + k], matrix_[column * (m + 1) + k]);
+      }
+
+      for (unsigned row = column + 1; row < m; ++row) {
+        Double factor = matrix_[row * (m + 1) + column] / matrix_[column * (m + 1) + column];
+        for (unsigned k = column; k <= m; ++k)
+          matrix_[row * (m + 1) + k] -= factor * matrix_[column * (m + 1) + k];
+      }
+    }
+
+    coefficients_.resize(m);
+    for (unsigned j = m; j-- > 0;) {
+      Double sum = matrix_[j * (m + 1) + m];
+      for (unsigned k = j + 1; k < m; ++k)
+        sum -= matrix_[j * (m + 1) + k] * coefficients_[k];
+      coefficients_[j] = sum / matrix_[j * (m + 1) + j];
+    }
+
+    return true;
+  }
+
+  // members
+  unsigned                    depth_ = 5;
+  unsigned                    history_size_ = 0;
+  unsigned                    next_ = 0;
+  bool                        has_previous_ = false;
+  vector<vector<Double>>      delta_residuals_; // [history][value]
+  vector<vector<Double>>      delta_outputs_; // [history][value]
+  vector<Double>              residual_;
+  vector<Double>              previous_residual_;
+  vector<Double>              previous_output_;
+  vector<Double>              extrapolated_;
+  vector<Double>              coefficients_;
+  vector<Double>              matrix_;
+};
+
+} /* namespace utilities */
+} /* namespace niwa */
+
+#endif /* SOURCE_UTILITIES_ANDERSONACCELERATION_H_ */
@@ -179,13 +179,16 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
   else if (parameters.count("mcmc")) {
     options.run_mode_ = RunMode::kMCMC;
     if (parameters.count("resume")) {
-      if (!parameters.count("objective-file") || !parameters.count("sample-file")) {
-        LOG_ERROR() << "Resuming an MCMC chain requires the objective-file and sample-file parameters";
+      // Without the files the chain is resumed from the checkpoint_file of the @mcmc block
+      if (parameters.count("objective-file") != parameters.count("sample-file")) {
+        LOG_ERROR() << "Resuming an MCMC chain requires both the objective-file and sample-file parameters";
         return;
       }
 
-      options.mcmc_objective_file_ = parameters["objective-file"].as<string>();
-      options.mcmc_sample_file_    = parameters["sample-file"].as<string>();
+      if (parameters.count("objective-file")) {
+        options.mcmc_objective_file_ = parameters["objective-file"].as<string>();
+        options.mcmc_sample_file_    = parameters["sample-file"].as<string>();
+      }
       options.resume_mcmc_chain_   = true;
     }
   } else if (parameters.count("profiling"))
@@ -141,6 +141,30 @@ public:
     return result;
   }
 
+  /**
+   * Copy the values of one map in to another. Unlike assignment the
+   * elements of target that have a key in source are updated in place
+   * so any pointers held to their values (e.g. addressables) stay valid.
+   *
+   * @param target The map to copy the values in to
+   * @param source The map to copy the values from
+   */
+  template<typename _Key, typename _Tp>
+  static void assign(std::map<_Key, _Tp>& target, const std::map<_Key, _Tp>& source) {
+    auto target_iter = target.begin();
+    for (auto source_iter = source.begin(); source_iter != source.end(); ++source_iter) {
+      while (target_iter != target.end() && target_iter->first < source_iter->first)
+        target_iter = target.erase(target_iter);
+
+      if (target_iter != target.end() && target_iter->first == source_iter->first) {
+        target_iter->second = source_iter->second;
+        ++target_iter;
+      } else
+        target.emplace_hint(target_iter, source_iter->first, source_iter->second);
+    }
+    target.erase(target_iter, target.end());
+  }
+
 }; // class
 
 template<class A, class B, class C>
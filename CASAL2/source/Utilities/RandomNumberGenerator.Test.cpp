@@ -16,6 +16,8 @@ namespace utilities {
 
 using std::cout;
 using std::endl;
+using std::string;
+using std::vector;
 
 
 TEST(RandomNumberGenerator, Reset) {
@@ -107,6 +109,51 @@ TEST(RandomNumberGenerator, Reset) {
   EXPECT_DOUBLE_EQ(0.70000371866995148,  rng.chi_square(2.0));
 }
 
+TEST(RandomNumberGenerator, Streams) {
+  // stream 0 is the master stream and uses the seed unchanged
+  EXPECT_EQ(2468u, RandomNumberGenerator::StreamSeed(2468, 0));
+
+  // the other streams are repeatable and distinct
+  EXPECT_EQ(RandomNumberGenerator::StreamSeed(2468, 1), RandomNumberGenerator::StreamSeed(2468, 1));
+  EXPECT_NE(RandomNumberGenerator::StreamSeed(2468, 1), RandomNumberGenerator::StreamSeed(2468, 2));
+  EXPECT_NE(RandomNumberGenerator::StreamSeed(2468, 1), RandomNumberGenerator::StreamSeed(2469, 1));
+  EXPECT_NE(2469u, RandomNumberGenerator::StreamSeed(2468, 1));
+
+  RandomNumberGenerator& master = RandomNumberGenerator::Instance();
+  master.Reset(2468);
+  RandomNumberGenerator stream_0(RandomNumberGenerator::StreamSeed(2468, 0));
+  EXPECT_EQ(2468u, stream_0.seed());
+  EXPECT_DOUBLE_EQ(master.uniform(), stream_0.uniform());
+
+  RandomNumberGenerator stream_1(RandomNumberGenerator::StreamSeed(2468, 1));
+  RandomNumberGenerator stream_1_copy(RandomNumberGenerator::StreamSeed(2468, 1));
+  RandomNumberGenerator stream_2(RandomNumberGenerator::StreamSeed(2468, 2));
+  for (unsigned i = 0; i < 5; ++i) {
+    double value = stream_1.uniform();
+    EXPECT_DOUBLE_EQ(value, stream_1_copy.uniform());
+    EXPECT_NE(value, stream_2.uniform());
+  }
+}
+
+TEST(RandomNumberGenerator, State) {
+  RandomNumberGenerator rng(2468);
+  for (unsigned i = 0; i < 10; ++i)
+    rng.normal();
+
+  // continuing from a saved state gives the same stream
+  string state = rng.state();
+  vector<double> expected;
+  for (unsigned i = 0; i < 5; ++i)
+    expected.push_back(rng.normal());
+
+  RandomNumberGenerator restored(1);
+  ASSERT_TRUE(restored.set_state(state));
+  EXPECT_EQ(2468u, restored.seed());
+  for (unsigned i = 0; i < 5; ++i)
+    EXPECT_DOUBLE_EQ(expected[i], restored.normal());
+
+  EXPECT_FALSE(restored.set_state("not a state"));
+}
 
 } /* namespace utilities */
 } /* namespace niwa */
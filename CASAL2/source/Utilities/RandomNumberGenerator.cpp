@@ -13,6 +13,8 @@
 // Headers
 #include "RandomNumberGenerator.h"
 
+#include <sstream>
+
 #include "../Model/Model.h"
 
 // Namespaces
@@ -25,6 +27,17 @@ namespace utilities {
 RandomNumberGenerator::RandomNumberGenerator() {
 }
 
+/**
+ * Create a stand-alone generator with its own stream. This is used
+ * when more than one thread needs random numbers at the same time
+ * (i.e. each thread model) as the singleton cannot be shared.
+ *
+ * @param seed The seed for this generator
+ */
+RandomNumberGenerator::RandomNumberGenerator(unsigned seed) {
+  Reset(seed);
+}
+
 /**
  * Destructor
  */
@@ -44,9 +57,65 @@ RandomNumberGenerator& RandomNumberGenerator::Instance() {
  *
  */
 void RandomNumberGenerator::Reset(unsigned new_seed) {
+  seed_ = new_seed;
   generator_.seed(new_seed);
 }
 
+/**
+ * Work out the seed for a stream of random numbers. Stream 0 uses the
+ * seed unchanged. Every other stream mixes the seed and stream number
+ * (splitmix64) so streams with neighbouring numbers, or seeds, do not
+ * produce correlated sequences. The same seed and stream will always
+ * give the same result, regardless of how many threads are running.
+ *
+ * @param seed The master random number seed
+ * @param stream The stream number
+ * @return the seed for the stream
+ */
+unsigned RandomNumberGenerator::StreamSeed(unsigned seed, unsigned stream) {
+  if (stream == 0)
+    return seed;
+
+  uint64_t value = ((uint64_t)seed << 32) | stream;
+  value += 0x9E3779B97F4A7C15ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  value = value ^ (value >> 31);
+  return (unsigned)(value ^ (value >> 32));
+}
+
+/**
+ * Get the state of the generator so it can be saved and the
+ * stream of random numbers continued later with set_state()
+ *
+ * @return The state of the generator
+ */
+std::string RandomNumberGenerator::state() const {
+  std::ostringstream stream;
+  // the trailing space stops the generator from reading past the end when restored
+  stream << seed_ << " " << generator_ << " ";
+  return stream.str();
+}
+
+/**
+ * Restore the state of the generator from state()
+ *
+ * @param state The state to restore
+ * @return true on success, false if the state could not be read
+ */
+bool RandomNumberGenerator::set_state(const std::string& state) {
+  std::istringstream stream(state);
+  unsigned seed = 0;
+  boost::mt19937 generator;
+  stream >> seed >> generator;
+  if (stream.fail())
+    return false;
+
+  seed_ = seed;
+  generator_ = generator;
+  return true;
+}
+
 /**
  * Get a random uniform between min and max
  *
@@ -18,6 +18,7 @@
 #define UTILITIES_RANDOMNUMBERGENERATOR_H_
 
 // Headers
+#include <string>
 #include <boost/random.hpp>
 
 #include "../Utilities/Types.h"
@@ -32,8 +33,10 @@ namespace utilities {
 class RandomNumberGenerator {
 public:
   static RandomNumberGenerator& Instance();
+  explicit                      RandomNumberGenerator(unsigned seed);
   virtual                       ~RandomNumberGenerator();
   void                          Reset(unsigned new_seed = 12345u);
+  static unsigned               StreamSeed(unsigned seed, unsigned stream);
 
   // Accessors
   double                        uniform(double min = 0.0, double max = 1.0);
@@ -42,6 +45,9 @@ public:
   double                        binomial(double p, double n);
   double                        chi_square(unsigned df);
   double                        gamma(double shape);
+  unsigned                      seed() const { return seed_; }
+  std::string                   state() const;
+  bool                          set_state(const std::string& state);
 
 private:
   // Methods
@@ -49,6 +55,7 @@ private:
 
   // Members
   boost::mt19937                generator_;
+  unsigned                      seed_ = 5489u;
 };
 
 } /* namespace utilities */